@@ -158,23 +158,39 @@ typedef Uint16 SDL_AudioFormat;
  *
  *  You can choose to avoid callbacks and use SDL_QueueAudio() instead, if
  *  you like. Just open your audio device with a NULL callback.
+ *
+ *  For capture devices, the callback receives recorded audio instead, and
+ *  SDL_DequeueAudio() takes the place of SDL_QueueAudio().
  */
 typedef void (SDLCALL * SDL_AudioCallback) (void *userdata, Uint8 * stream,
                                             int len);
 
 /**
  *  The calculated values in this structure are calculated by SDL_OpenAudio().
+ *
+ *  Multichannel audio is interleaved, one sample frame after another, and
+ *  the channels of each frame are in this order:
+ *    - 1:  mono
+ *    - 2:  front left, front right
+ *    - 4:  front left, front right, back left, back right
+ *    - 6:  front left, front right, front center, LFE, back left, back right
+ *    - 8:  as 6, then side left, side right
+ *
+ *  Conversions between these layouts keep the speakers they share, mix
+ *  the others into their neighbors, and are scaled so they can't clip.
+ *  Other channel counts just keep the channels they have in common, and
+ *  SDL_AudioStreamSetChannelMatrix() can override any of this.
  */
 typedef struct SDL_AudioSpec
 {
     int freq;                   /**< DSP frequency -- samples per second */
     SDL_AudioFormat format;     /**< Audio data format */
-    Uint8 channels;             /**< Number of channels: 1 mono, 2 stereo */
+    Uint8 channels;             /**< Number of channels, see below */
     Uint8 silence;              /**< Audio buffer silence value (calculated) */
     Uint16 samples;             /**< Audio buffer size in samples (power of 2) */
     Uint16 padding;             /**< Necessary for some compile environments */
     Uint32 size;                /**< Audio buffer size in bytes (calculated) */
-    SDL_AudioCallback callback; /**< Callback that feeds the audio device (NULL to use SDL_QueueAudio()). */
+    SDL_AudioCallback callback; /**< Callback that feeds the audio device (NULL to use SDL_QueueAudio() or SDL_DequeueAudio()). */
     void *userdata;             /**< Userdata passed to callback (ignored for NULL callbacks). */
 } SDL_AudioSpec;
 
@@ -429,12 +445,89 @@ extern DECLSPEC SDL_AudioSpec *SDLCALL SDL_LoadWAV_RW(SDL_RWops * src,
  */
 extern DECLSPEC void SDLCALL SDL_FreeWAV(Uint8 * audio_buf);
 
+/**
+ *  \brief Read a WAVE file a piece at a time, instead of all at once.
+ *
+ *  SDL_LoadWAV_RW() decodes the whole file into memory, which adds up
+ *  quickly for long music tracks. A WAV stream parses the header when it
+ *  opens, then decodes PCM, MS-ADPCM or IMA-ADPCM data only as you read
+ *  it, one ADPCM block at a time, so it never holds more than a block or
+ *  two no matter how long the file is. It can also seek to any sample
+ *  frame. The source has to be seekable.
+ */
+struct _SDL_WAVStream;  /* this is opaque to the outside world. */
+typedef struct _SDL_WAVStream SDL_WAVStream;
+
+/**
+ *  Open a WAVE stream from a data source.
+ *
+ *  If \c freesrc is non-zero, the data source is closed when the stream
+ *  is, or right away if this function fails.
+ *
+ *  \param src The data source for the WAVE data
+ *  \param freesrc Non-zero to close the data source with the stream
+ *  \param spec Filled in with the format of the data the stream returns,
+ *              just like SDL_LoadWAV_RW() would
+ *  \return a new stream on success, NULL on error.
+ *
+ *  \sa SDL_WAVStreamRead
+ *  \sa SDL_WAVStreamSeek
+ *  \sa SDL_CloseWAVStream
+ */
+extern DECLSPEC SDL_WAVStream * SDLCALL SDL_OpenWAVStream_RW(SDL_RWops * src,
+                                                             int freesrc,
+                                                             SDL_AudioSpec * spec);
+
+/**
+ *  Opens a WAVE stream from a file.
+ *  Convenience function.
+ */
+#define SDL_OpenWAVStream(file, spec) \
+    SDL_OpenWAVStream_RW(SDL_RWFromFile(file, "rb"), 1, spec)
+
+/**
+ *  Get the length of a WAVE stream, in sample frames, or -1 on error.
+ */
+extern DECLSPEC Sint64 SDLCALL SDL_WAVStreamLength(SDL_WAVStream * stream);
+
+/**
+ *  Get the sample frame the next read starts at, or -1 on error.
+ */
+extern DECLSPEC Sint64 SDLCALL SDL_WAVStreamTell(SDL_WAVStream * stream);
+
+/**
+ *  Move a WAVE stream to a sample frame, from 0 to its length.
+ *
+ *  \return 0 on success, or -1 on error.
+ */
+extern DECLSPEC int SDLCALL SDL_WAVStreamSeek(SDL_WAVStream * stream, Sint64 frame);
+
+/**
+ *  Decode audio from a WAVE stream into a buffer.
+ *
+ *  \param stream The stream the audio is being read from
+ *  \param buf A buffer to fill with audio data
+ *  \param len The maximum number of bytes to fill; only whole sample
+ *             frames are returned
+ *  \return The number of bytes read, 0 at the end of the data, or -1 on
+ *          error.
+ */
+extern DECLSPEC int SDLCALL SDL_WAVStreamRead(SDL_WAVStream * stream, void *buf, int len);
+
+/**
+ *  Close a WAVE stream, and its data source if it was opened to.
+ */
+extern DECLSPEC void SDLCALL SDL_CloseWAVStream(SDL_WAVStream * stream);
+
 /**
  *  This function takes a source format and rate and a destination format
  *  and rate, and initializes the \c cvt structure with information needed
  *  by SDL_ConvertAudio() to convert a buffer of audio data from one format
  *  to the other.
  *
+ *  If the ::SDL_LOG_CATEGORY_AUDIO priority is ::SDL_LOG_PRIORITY_DEBUG or
+ *  lower, each pass of the planned conversion is logged.
+ *
  *  \return -1 if the format conversion is not supported, 0 if there's
  *  no conversion needed, or 1 if the audio filter is set up.
  */
@@ -458,6 +551,123 @@ extern DECLSPEC int SDLCALL SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
  */
 extern DECLSPEC int SDLCALL SDL_ConvertAudio(SDL_AudioCVT * cvt);
 
+/**
+ *  SDL_AudioStream is a stateful audio conversion interface.
+ *
+ *  Unlike SDL_AudioCVT, it:
+ *    - accepts incoming data in any size, a little at a time, and keeps
+ *      resampler state between calls, so chunk boundaries don't click.
+ *    - resamples between arbitrary rates (44100Hz to 48000Hz, etc).
+ *    - manages its own buffers; you don't have to overallocate anything.
+ *
+ *  You push data with SDL_AudioStreamPut() as you have it, and pull
+ *  converted data with SDL_AudioStreamGet() as you need it.
+ */
+struct _SDL_AudioStream;  /* this is opaque to the outside world. */
+typedef struct _SDL_AudioStream SDL_AudioStream;
+
+/**
+ *  Create a new audio stream
+ *
+ *  \param src_format The format of the source audio
+ *  \param src_channels The number of channels of the source audio
+ *  \param src_rate The sampling rate of the source audio
+ *  \param dst_format The format of the desired audio output
+ *  \param dst_channels The number of channels of the desired audio output
+ *  \param dst_rate The sampling rate of the desired audio output
+ *  \return a new stream on success, NULL on error.
+ *
+ *  \sa SDL_AudioStreamPut
+ *  \sa SDL_AudioStreamGet
+ *  \sa SDL_AudioStreamAvailable
+ *  \sa SDL_AudioStreamFlush
+ *  \sa SDL_AudioStreamClear
+ *  \sa SDL_FreeAudioStream
+ */
+extern DECLSPEC SDL_AudioStream * SDLCALL SDL_NewAudioStream(const SDL_AudioFormat src_format,
+                                                             const Uint8 src_channels,
+                                                             const int src_rate,
+                                                             const SDL_AudioFormat dst_format,
+                                                             const Uint8 dst_channels,
+                                                             const int dst_rate);
+
+/**
+ *  Add data to be converted/resampled to the stream
+ *
+ *  \param stream The stream the audio data is being added to
+ *  \param buf A pointer to the audio data to add
+ *  \param len The number of bytes to write to the stream. This must be
+ *             a multiple of the source sample frame size.
+ *  \return 0 on success, or -1 on error.
+ *
+ *  \sa SDL_NewAudioStream
+ *  \sa SDL_AudioStreamGet
+ */
+extern DECLSPEC int SDLCALL SDL_AudioStreamPut(SDL_AudioStream *stream, const void *buf, int len);
+
+/**
+ *  Get converted/resampled data from the stream
+ *
+ *  \param stream The stream the audio is being requested from
+ *  \param buf A buffer to fill with audio data
+ *  \param len The maximum number of bytes to fill
+ *  \return The number of bytes read from the stream, or -1 on error
+ *
+ *  \sa SDL_NewAudioStream
+ *  \sa SDL_AudioStreamPut
+ */
+extern DECLSPEC int SDLCALL SDL_AudioStreamGet(SDL_AudioStream *stream, void *buf, int len);
+
+/**
+ *  Get the number of converted/resampled bytes available. The stream may be
+ *  buffering data behind the scenes until it has enough to resample
+ *  correctly, so this number might be lower than what you expect, or even
+ *  be zero. Add more data or flush the stream if you need the data now.
+ *
+ *  \sa SDL_AudioStreamFlush
+ */
+extern DECLSPEC int SDLCALL SDL_AudioStreamAvailable(SDL_AudioStream *stream);
+
+/**
+ *  Tell the stream that you're done sending data, and anything being buffered
+ *  should be converted/resampled and made available immediately.
+ *
+ *  It is legal to add more data to a stream after flushing, but there will
+ *  be audio gaps in the output. Generally this is intended to signal the
+ *  end of input, so the complete output becomes available.
+ */
+extern DECLSPEC int SDLCALL SDL_AudioStreamFlush(SDL_AudioStream *stream);
+
+/**
+ *  Clear any pending data in the stream without converting it
+ */
+extern DECLSPEC void SDLCALL SDL_AudioStreamClear(SDL_AudioStream *stream);
+
+/**
+ *  Set how the stream remixes its source channels into its destination
+ *  channels.
+ *
+ *  Each destination channel is a weighted sum of the source channels of
+ *  the same sample frame: (matrix) has one row of src_channels gains for
+ *  each of the dst_channels, so the gain from source channel s to
+ *  destination channel d is matrix[(d * src_channels) + s]. The matrix is
+ *  copied, and applies to data put in the stream after this call, even
+ *  if the channel counts match. Pass NULL to go back to the standard
+ *  remix described for SDL_AudioSpec.
+ *
+ *  \param stream The stream to change
+ *  \param matrix dst_channels * src_channels gains, or NULL
+ *  \return 0 on success, or -1 on error.
+ *
+ *  \sa SDL_NewAudioStream
+ */
+extern DECLSPEC int SDLCALL SDL_AudioStreamSetChannelMatrix(SDL_AudioStream *stream, const float *matrix);
+
+/**
+ *  Free an audio stream
+ */
+extern DECLSPEC void SDLCALL SDL_FreeAudioStream(SDL_AudioStream *stream);
+
 #define SDL_MIX_MAXVOLUME 128
 /**
  *  This takes two audio buffers of the playing audio format and mixes
@@ -487,17 +697,24 @@ extern DECLSPEC void SDLCALL SDL_MixAudioFormat(Uint8 * dst,
  *  (pull method), or you can supply no callback, and then SDL will expect
  *  you to supply data at regular intervals (push method) with this function.
  *
- *  There are no limits on the amount of data you can queue, short of
- *  exhaustion of address space. Queued data will drain to the device as
- *  necessary without further intervention from you. If the device needs
- *  audio but there is not enough queued, it will play silence to make up
- *  the difference. This means you will have skips in your audio playback
- *  if you aren't routinely queueing sufficient data.
+ *  By default there are no limits on the amount of data you can queue,
+ *  short of exhaustion of address space: the queue grows as needed. If
+ *  SDL_HINT_AUDIO_QUEUE_GROWTH is "0" when the device is opened, the queue
+ *  holds SDL_HINT_AUDIO_QUEUE_CAPACITY bytes, and this function fails
+ *  without queueing anything if (len) bytes don't fit. Each call also
+ *  stores a small header with the data (24 bytes on 64-bit systems), which
+ *  counts against that capacity but not SDL_GetQueuedAudioSize(), so many
+ *  tiny buffers fit less audio than a few big ones. Queued data will
+ *  drain to the device as necessary without further intervention from you.
+ *  If the device needs audio but there is not enough queued, it will play
+ *  silence to make up the difference. This means you will have skips in
+ *  your audio playback if you aren't routinely queueing sufficient data.
  *
  *  This function copies the supplied data, so you are safe to free it when
  *  the function returns. This function is thread-safe, but queueing to the
  *  same device from two threads at once does not promise which buffer will
- *  be queued first.
+ *  be queued first. It never waits for the audio device's thread, and the
+ *  audio device's thread never waits for it.
  *
  *  You may not queue audio on a device that is using an application-supplied
  *  callback; doing so returns an error. You have to use the audio callback
@@ -516,11 +733,96 @@ extern DECLSPEC void SDLCALL SDL_MixAudioFormat(Uint8 * dst,
  */
 extern DECLSPEC int SDLCALL SDL_QueueAudio(SDL_AudioDeviceID dev, const void *data, Uint32 len);
 
+/**
+ *  Queue audio in any format on non-callback devices.
+ *
+ *  This works like SDL_QueueAudio(), except that (data) is in the format,
+ *  channel count and sample rate you specify here, rather than the ones
+ *  the device was opened with. Each call may use a different format.
+ *
+ *  Nothing is converted when you queue; the audio device's thread converts
+ *  and resamples the data as it plays, so only what is actually played
+ *  costs anything, and SDL_ClearQueuedAudio() throws away the rest for
+ *  free. Consecutive buffers in the same format are resampled as one
+ *  continuous stream. Audio already in the device's format is just copied.
+ *  The converter for a format is set up here, the first time it's queued,
+ *  and kept while it's in use, so the audio thread never allocates.
+ *
+ *  SDL_GetQueuedAudioSize() reports queued data as its size once
+ *  converted to the device's format, which for resampled data is an
+ *  estimate.
+ *
+ *  \param dev The device ID to which we will queue audio.
+ *  \param data The data to queue to the device for later playback.
+ *  \param len The number of bytes (not samples!) to which (data) points.
+ *              Unless the data is in the device's format, this must be
+ *              a whole number of sample frames.
+ *  \param format The audio format of (data).
+ *  \param channels The number of channels in (data).
+ *  \param freq The sample rate of (data).
+ *  \return zero on success, -1 on error, including if SDL can't convert
+ *          from this format to the device's.
+ *
+ *  \sa SDL_QueueAudio
+ *  \sa SDL_GetQueuedAudioSize
+ *  \sa SDL_ClearQueuedAudio
+ */
+extern DECLSPEC int SDLCALL SDL_QueueAudioFormat(SDL_AudioDeviceID dev,
+                                                 const void *data, Uint32 len,
+                                                 SDL_AudioFormat format,
+                                                 Uint8 channels, int freq);
+
+/**
+ *  Dequeue more audio on non-callback devices.
+ *
+ *  (If you are looking to queue audio for output on a non-callback playback
+ *  device, you want SDL_QueueAudio() instead. This will always return 0
+ *  if you use it with playback devices.)
+ *
+ *  SDL offers two ways to retrieve audio from a capture device: you can
+ *  either supply a callback that SDL triggers with some frequency as the
+ *  device records more audio data, (push method), or you can supply no
+ *  callback, and then SDL will expect you to retrieve data at regular
+ *  intervals (pull method) with this function.
+ *
+ *  SDL holds about a second of captured audio for you. If you don't
+ *  dequeue it that often, the newest data is dropped until there is room
+ *  again. If there isn't enough data available, this function returns
+ *  what is there without waiting; it never blocks the capture thread, and
+ *  the capture thread never blocks it.
+ *
+ *  This function copies the data into the buffer you supply. Only one
+ *  thread should dequeue (or clear) a given device at a time.
+ *
+ *  You may not dequeue audio from a device that is using an
+ *  application-supplied callback; doing so returns 0. You have to use the
+ *  audio callback, or dequeue audio with this function, but not both.
+ *
+ *  You should not call SDL_LockAudio() on the device before dequeueing;
+ *  SDL handles this for this function.
+ *
+ *  \param dev The device ID from which we will dequeue audio.
+ *  \param data A pointer into where audio data should be copied.
+ *  \param len The number of bytes (not samples!) to which (data) points.
+ *  \return number of bytes dequeued, which could be less than requested.
+ *
+ *  \sa SDL_GetQueuedAudioSize
+ *  \sa SDL_ClearQueuedAudio
+ */
+extern DECLSPEC Uint32 SDLCALL SDL_DequeueAudio(SDL_AudioDeviceID dev, void *data, Uint32 len);
+
 /**
  *  Get the number of bytes of still-queued audio.
  *
- *  This is the number of bytes that have been queued for playback with
- *  SDL_QueueAudio(), but have not yet been sent to the hardware.
+ *  For playback device:
+ *
+ *    This is the number of bytes that have been queued for playback with
+ *    SDL_QueueAudio(), but have not yet been sent to the hardware.
+ *
+ *  For capture device:
+ *
+ *    This is the number of bytes that have been captured by the device and
+ *    are waiting for you to dequeue with SDL_DequeueAudio().
  *
  *  Once we've sent it to the hardware, this function can not decide the exact
  *  byte boundary of what has been played. It's possible that we just gave the
@@ -532,8 +834,8 @@ extern DECLSPEC int SDLCALL SDL_QueueAudio(SDL_AudioDeviceID dev, const void *da
  *  You have to use the audio callback or queue audio with SDL_QueueAudio(),
  *  but not both.
  *
- *  You should not call SDL_LockAudio() on the device before querying; SDL
- *  handles locking internally for this function.
+ *  You should not call SDL_LockAudio() on the device before querying; this
+ *  function doesn't need to lock anything.
  *
  *  \param dev The device ID of which we will query queued audio size.
  *  \return Number of bytes (not samples!) of queued audio.
@@ -544,10 +846,14 @@ extern DECLSPEC int SDLCALL SDL_QueueAudio(SDL_AudioDeviceID dev, const void *da
 extern DECLSPEC Uint32 SDLCALL SDL_GetQueuedAudioSize(SDL_AudioDeviceID dev);
 
 /**
- *  Drop any queued audio data waiting to be sent to the hardware.
+ *  Drop any queued audio data. For playback devices, this is any queued data
+ *  still waiting to be submitted to the hardware. For capture devices, this
+ *  is any data that was queued by the device that hasn't yet been dequeued by
+ *  the application.
  *
- *  Immediately after this call, SDL_GetQueuedAudioSize() will return 0 and
- *  the hardware will start playing silence if more audio isn't queued.
+ *  Immediately after this call, SDL_GetQueuedAudioSize() will return 0. For
+ *  playback devices, the hardware will start playing silence if more audio
+ *  isn't queued.
  *
  *  This will not prevent playback of queued audio that's already been sent
  *  to the hardware, as we can not undo that, so expect there to be some
@@ -573,6 +879,370 @@ extern DECLSPEC Uint32 SDLCALL SDL_GetQueuedAudioSize(SDL_AudioDeviceID dev);
 extern DECLSPEC void SDLCALL SDL_ClearQueuedAudio(SDL_AudioDeviceID dev);
 
 
+/**
+ *  \name Built-in mixer
+ *
+ *  Each playback device has a simple mixer that plays any number of sounds
+ *  ("voices") on top of what the callback or SDL_QueueAudio() provides,
+ *  on the audio device's thread. A voice holds a copy of a sound, and
+ *  can be played once or looped, with its own gain, pan and playback
+ *  rate, which can all be changed while it plays.
+ *
+ *  Changing a voice's parameters, or playing or stopping it, never waits
+ *  on the audio device's thread, and needs no SDL_LockAudioDevice(). The
+ *  changes are heard from the next buffer the device plays.
+ *
+ *  A device can have SDL_HINT_AUDIO_MIXER_VOICES voices at once. The
+ *  mixer costs nothing until the first voice is created. Voices are
+ *  destroyed when the device is closed.
+ */
+/* @{ */
+
+/**
+ *  A voice of a device's built-in mixer. Zero is never a valid voice.
+ */
+typedef Uint32 SDL_AudioVoiceID;
+
+/**
+ *  Create a voice that plays a copy of a sound.
+ *
+ *  The sound is converted to float once, here; from then on, playing it
+ *  costs about the same whatever format it came in. The voice starts out
+ *  stopped, with a gain of 1, centered, at its normal rate.
+ *
+ *  \param dev The playback device to create the voice on.
+ *  \param data The sound, which SDL copies.
+ *  \param len The number of bytes in (data); a whole number of sample frames.
+ *  \param format The audio format of (data).
+ *  \param channels The number of channels in (data). Sounds with more than
+ *                  two channels are mixed down to stereo, once, here, the
+ *                  same way SDL_BuildAudioCVT() would.
+ *  \param freq The sample rate of (data).
+ *  \return a new voice, or 0 on error (no free voices, for example).
+ *
+ *  \sa SDL_PlayAudioVoice
+ *  \sa SDL_DestroyAudioVoice
+ */
+extern DECLSPEC SDL_AudioVoiceID SDLCALL SDL_CreateAudioVoice(SDL_AudioDeviceID dev,
+                                                              const void *data, Uint32 len,
+                                                              SDL_AudioFormat format,
+                                                              Uint8 channels, int freq);
+
+/**
+ *  Play a voice from the start, once or looping forever.
+ *
+ *  Playing a voice that is already playing starts it over.
+ *
+ *  \return zero on success, -1 on error.
+ */
+extern DECLSPEC int SDLCALL SDL_PlayAudioVoice(SDL_AudioDeviceID dev, SDL_AudioVoiceID voice, SDL_bool loop);
+
+/**
+ *  Play a voice from the start at an exact sample frame, once or looping.
+ *
+ *  (frame) counts sample frames of the device's obtained format from
+ *  when it was opened, the same timeline SDL_GetAudioDevicePosition()
+ *  reports, so the sound is heard when the position gets there. The
+ *  audio thread starts the voice at that frame inside whichever buffer
+ *  holds it. A voice scheduled too late, or whose frame passes while the
+ *  device is paused, starts partway into its sound, as if it had started
+ *  on time.
+ *
+ *  Each voice holds one pending start; scheduling it again replaces it.
+ *  A scheduled voice counts as playing while it waits.
+ *
+ *  \return zero on success, -1 on error.
+ *
+ *  \sa SDL_GetAudioDevicePosition
+ */
+extern DECLSPEC int SDLCALL SDL_PlayAudioVoiceAt(SDL_AudioDeviceID dev, SDL_AudioVoiceID voice,
+                                                 Uint64 frame, SDL_bool loop);
+
+/**
+ *  Stop a voice. It is silent until played again.
+ *
+ *  \return zero on success, -1 on error.
+ */
+extern DECLSPEC int SDLCALL SDL_StopAudioVoice(SDL_AudioDeviceID dev, SDL_AudioVoiceID voice);
+
+/**
+ *  Set a voice's gain, pan and playback rate.
+ *
+ *  \param gain Linear volume; 1.0 plays the sound as it is.
+ *  \param pan -1.0 is left only, 0.0 centered, 1.0 right only.
+ *  \param ratio Playback rate; 2.0 plays twice as fast, an octave up.
+ *  \return zero on success, -1 on error.
+ */
+extern DECLSPEC int SDLCALL SDL_SetAudioVoiceParams(SDL_AudioDeviceID dev, SDL_AudioVoiceID voice,
+                                                    float gain, float pan, float ratio);
+
+/**
+ *  Check whether a voice is playing. A voice that isn't looping stops by
+ *  itself at the end of its sound.
+ */
+extern DECLSPEC SDL_bool SDLCALL SDL_IsAudioVoicePlaying(SDL_AudioDeviceID dev, SDL_AudioVoiceID voice);
+
+/**
+ *  Destroy a voice, stopping it and freeing its copy of the sound.
+ */
+extern DECLSPEC void SDLCALL SDL_DestroyAudioVoice(SDL_AudioDeviceID dev, SDL_AudioVoiceID voice);
+
+/* @} *//* Built-in mixer */
+
+
+/**
+ *  \name Effect chain
+ *
+ *  Each playback device can run a short chain of effects over what it
+ *  plays, on the audio device's thread: either right after the callback
+ *  (and the built-in mixer), in the format SDL_OpenAudioDevice() gave, or
+ *  after SDL's conversion, in the format the hardware takes. Effects work
+ *  in float; with other formats, the audio is converted to float and back
+ *  around the chain.
+ *
+ *  Adding and removing effects locks the device, like a callback does.
+ *  Changing an effect's parameters never waits on the audio device's
+ *  thread; the new ones take over from the next buffer, and effects keep
+ *  their state, so a filter can be swept while it plays.
+ */
+/* @{ */
+
+#define SDL_AUDIO_MAX_EFFECTS 8         /**< Effects a device can have at once */
+#define SDL_AUDIOEFFECT_MAX_TAPS 256    /**< Longest impulse response for convolution */
+
+/**
+ *  An effect in a device's chain. Zero is never a valid effect.
+ */
+typedef Uint32 SDL_AudioEffectID;
+
+/**
+ *  The effects a chain can have, and the parameters each one takes.
+ */
+typedef enum
+{
+    SDL_AUDIOEFFECT_BIQUAD,     /**< b0, b1, b2, a1, a2: a second order IIR
+                                     filter, with a0 normalized to 1. Starts
+                                     out passing audio through unchanged. */
+    SDL_AUDIOEFFECT_LIMITER,    /**< threshold, release: peaks are pulled down
+                                     to (threshold), a linear level above zero,
+                                     at once; the gain recovers halfway in
+                                     (release) milliseconds. Starts at 1, 50. */
+    SDL_AUDIOEFFECT_DCBLOCKER,  /**< pole: a one pole highpass filter that takes
+                                     out any DC offset; (pole) is from 0 to 1,
+                                     higher for a lower cutoff. Starts at 0.995. */
+    SDL_AUDIOEFFECT_CONVOLUTION /**< up to SDL_AUDIOEFFECT_MAX_TAPS taps: a FIR
+                                     filter with this impulse response, first
+                                     tap first. Starts out as a single 1. */
+} SDL_AudioEffectType;
+
+/**
+ *  Add an effect to the end of a playback device's chain.
+ *
+ *  \param dev The playback device.
+ *  \param type Which effect.
+ *  \param after_conversion SDL_FALSE to process the audio as the callback
+ *                          made it, SDL_TRUE to process it as the hardware
+ *                          plays it.
+ *  \return a new effect, or 0 on error (the chain is full, for example).
+ *
+ *  \sa SDL_SetAudioEffectParams
+ *  \sa SDL_RemoveAudioEffect
+ */
+extern DECLSPEC SDL_AudioEffectID SDLCALL SDL_AddAudioEffect(SDL_AudioDeviceID dev,
+                                                             SDL_AudioEffectType type,
+                                                             SDL_bool after_conversion);
+
+/**
+ *  Set an effect's parameters; see SDL_AudioEffectType for what they are.
+ *
+ *  \param dev The playback device.
+ *  \param effect The effect to change.
+ *  \param params The new parameters, which SDL copies.
+ *  \param count How many parameters there are.
+ *  \return zero on success, -1 on error.
+ */
+extern DECLSPEC int SDLCALL SDL_SetAudioEffectParams(SDL_AudioDeviceID dev, SDL_AudioEffectID effect,
+                                                     const float *params, int count);
+
+/**
+ *  Take an effect out of a device's chain. The others keep their order.
+ */
+extern DECLSPEC void SDLCALL SDL_RemoveAudioEffect(SDL_AudioDeviceID dev, SDL_AudioEffectID effect);
+
+/* @} *//* Effect chain */
+
+
+/**
+ *  \name Device performance counters
+ *
+ *  SDL's thread for each open device keeps counters and timings of its
+ *  work, so you can tell whether it is keeping up, even with the "dummy"
+ *  and "disk" drivers. Keeping them never makes the device's thread wait,
+ *  and reading them never waits for it either.
+ *
+ *  Drivers that run the audio callback from a thread of their own (the
+ *  CoreAudio, Haiku, NaCl and Emscripten drivers) don't fill them in.
+ *
+ *  Set SDL_HINT_AUDIO_DEVICE_STATS_LOG to have each device's thread log a
+ *  summary every so often.
+ */
+/* @{ */
+
+#define SDL_AUDIO_TIMING_BUCKETS 20
+
+/**
+ *  The distribution of how long one thing took, in microseconds.
+ */
+typedef struct SDL_AudioTiming
+{
+    Uint32 count;       /**< How many times it was measured */
+    Uint32 min_us;      /**< Shortest time */
+    Uint32 max_us;      /**< Longest time */
+    Uint64 total_us;    /**< All the times added up, for an average */
+    /**
+     *  histogram[i] counts the times of at least 2^i microseconds, and less
+     *  than 2^(i+1). The first bucket also counts anything under a
+     *  microsecond, and the last anything over.
+     */
+    Uint32 histogram[SDL_AUDIO_TIMING_BUCKETS];
+} SDL_AudioTiming;
+
+/**
+ *  Counters and timings for an open audio device, per buffer the device's
+ *  thread handles. "Buffer" means one call of the audio callback.
+ */
+typedef struct SDL_AudioDeviceStats
+{
+    Uint32 buffers;         /**< Buffers handled */
+    Uint32 late_buffers;    /**< Buffers that took longer to make (callback
+                                 and conversion) than they take to play */
+    Uint32 queue_underruns; /**< Times SDL_QueueAudio() data ran out while
+                                 playing; an idle, empty queue isn't counted */
+    Uint32 xruns;           /**< Under- or overruns reported by the driver */
+    SDL_AudioTiming callback;  /**< The audio callback (or queue) */
+    SDL_AudioTiming convert;   /**< Format and rate conversion */
+    SDL_AudioTiming play;      /**< Handing a buffer to the driver */
+    SDL_AudioTiming wait;      /**< Waiting on the driver (or capturing) */
+    SDL_AudioTiming jitter;    /**< How far the time between buffers was
+                                    from the time a buffer takes to play */
+} SDL_AudioDeviceStats;
+
+/**
+ *  Get the performance counters of an open audio device.
+ *
+ *  \param dev The device to query.
+ *  \param stats Filled in with the counters since the device was opened
+ *               or since SDL_ResetAudioDeviceStats().
+ *  \return zero on success, -1 on error.
+ */
+extern DECLSPEC int SDLCALL SDL_GetAudioDeviceStats(SDL_AudioDeviceID dev, SDL_AudioDeviceStats *stats);
+
+/**
+ *  Start an open audio device's performance counters over.
+ *
+ *  The device's thread clears its timings the next time it finishes a
+ *  buffer, so they may still show old data until then.
+ */
+extern DECLSPEC void SDLCALL SDL_ResetAudioDeviceStats(SDL_AudioDeviceID dev);
+
+/**
+ *  Get how long audio takes from the device's buffer to the speaker.
+ *
+ *  This is the buffering the driver settled on with the system when the
+ *  device was opened. Drivers that can't tell report the length of one
+ *  device buffer. Time spent in SDL's own conversion and queueing isn't
+ *  included. With SDL_HINT_AUDIO_ADAPTIVE_LATENCY, this is how much the
+ *  device currently keeps queued, which changes as it adapts.
+ *
+ *  \param dev The device to query.
+ *  \return the latency in microseconds, or -1 on error.
+ *
+ *  \sa SDL_HINT_AUDIO_PULSEAUDIO_LOW_LATENCY
+ *  \sa SDL_HINT_AUDIO_ADAPTIVE_LATENCY
+ */
+extern DECLSPEC int SDLCALL SDL_GetAudioDeviceLatency(SDL_AudioDeviceID dev);
+
+/**
+ *  Get how much audio an open playback device has played, and when.
+ *
+ *  The device's thread measures this once a buffer, taking off whatever
+ *  the driver still holds, so (*frames) is what has actually reached the
+ *  speaker as of (*timestamp). To get the position at another moment, add
+ *  the time since, in frames. Silence played while the device is paused
+ *  or its queue is empty counts too. Drivers that can't tell how much
+ *  they hold are assumed to hold SDL_GetAudioDeviceLatency() worth.
+ *
+ *  \param dev The device to query.
+ *  \param frames Filled in with the sample frames played since the device
+ *                was opened, at the frequency SDL_OpenAudioDevice() gave
+ *                the app.
+ *  \param timestamp Filled in with the SDL_GetPerformanceCounter() value
+ *                   when (*frames) was measured. May be NULL.
+ *  \return zero on success, -1 on error.
+ *
+ *  \sa SDL_GetAudioDeviceLatency
+ */
+extern DECLSPEC int SDLCALL SDL_GetAudioDevicePosition(SDL_AudioDeviceID dev, Uint64 *frames, Uint64 *timestamp);
+
+/* @} *//* Device performance counters */
+
+
+/**
+ *  \name Level meters
+ *
+ *  A device can measure the level of each channel as it goes, on the audio
+ *  device's thread, so a UI doesn't have to scan the audio itself. For
+ *  playback, it measures what the callback, the built-in mixer and the
+ *  effects before conversion made; for capture, what the callback gets.
+ *  Reading the meter never waits on the audio device's thread.
+ */
+/* @{ */
+
+#define SDL_AUDIO_METER_CHANNELS 8
+
+/**
+ *  Levels per channel, as linear values where 1 is full scale, since
+ *  metering started or the meter was last reset.
+ */
+typedef struct SDL_AudioMeter
+{
+    int channels;       /**< How many of the arrays below are in use */
+    Uint32 frames;      /**< Sample frames measured */
+    float peak[SDL_AUDIO_METER_CHANNELS];    /**< The loudest sample */
+    float rms[SDL_AUDIO_METER_CHANNELS];     /**< Root mean square level */
+    Uint32 clips[SDL_AUDIO_METER_CHANNELS];  /**< Samples at or past full scale */
+} SDL_AudioMeter;
+
+/**
+ *  Start or stop measuring an open device's levels. Metering is off until
+ *  this turns it on. While it's on, it costs one pass over each buffer if
+ *  the callback's format is AUDIO_F32SYS or AUDIO_S16SYS. Other formats
+ *  are also copied and converted to float for it, unless effects that run
+ *  before conversion have already done that.
+ *
+ *  \param dev The device.
+ *  \param enable SDL_TRUE to start, SDL_FALSE to stop.
+ *  \return zero on success, -1 on error.
+ */
+extern DECLSPEC int SDLCALL SDL_SetAudioDeviceMetering(SDL_AudioDeviceID dev, SDL_bool enable);
+
+/**
+ *  Get the levels an open device has measured.
+ *
+ *  The meter is updated once a buffer. A UI that draws it every frame
+ *  would pass SDL_TRUE for (reset), to get the levels since the last time.
+ *
+ *  \param dev The device.
+ *  \param meter Filled in with the levels.
+ *  \param reset SDL_TRUE to have the meter start over from the device's
+ *               next buffer.
+ *  \return zero on success, -1 on error.
+ */
+extern DECLSPEC int SDLCALL SDL_GetAudioDeviceMeter(SDL_AudioDeviceID dev, SDL_AudioMeter *meter, SDL_bool reset);
+
+/* @} *//* Level meters */
+
+
 /**
  *  \name Audio lock functions
  *
@@ -637,6 +637,123 @@ extern "C" {
  */
 #define SDL_HINT_WINDOWS_NO_CLOSE_ON_ALT_F4	"SDL_WINDOWS_NO_CLOSE_ON_ALT_F4"
 
+/**
+ *  \brief A variable controlling the speed/quality tradeoff of audio resampling.
+ *
+ *  All sample rate conversion uses a band-limited (windowed sinc) filter;
+ *  higher quality settings use longer filters with a sharper cutoff, which
+ *  costs more CPU time per sample frame.
+ *
+ *  This hint is checked when an SDL_AudioCVT, SDL_AudioStream or audio
+ *  device is set up, so changing it doesn't affect conversions in progress.
+ *
+ *  The variable can be set to the following values:
+ *    "0" or "low"     - Short filter, cheapest to run.
+ *    "1" or "medium"  - Good quality for most uses. (default)
+ *    "2" or "high"    - Long filter for the best quality.
+ */
+#define SDL_HINT_AUDIO_RESAMPLING_MODE   "SDL_AUDIO_RESAMPLING_MODE"
+
+/**
+ *  \brief A variable setting how many bytes an audio device's queue holds.
+ *
+ *  For playback, this is how much SDL_QueueAudio() can hold before the
+ *  queue has to grow (see SDL_HINT_AUDIO_QUEUE_GROWTH); each call uses a
+ *  small header's worth on top of its data. For capture, it is how far
+ *  SDL_DequeueAudio() can fall behind before new data is dropped. The
+ *  value is rounded up to a power of two, and is never less than a few
+ *  audio callbacks' worth. By default playback queues start at four
+ *  callbacks' worth, and capture queues hold about a second of audio.
+ *
+ *  This hint is checked when the audio device is opened.
+ */
+#define SDL_HINT_AUDIO_QUEUE_CAPACITY   "SDL_AUDIO_QUEUE_CAPACITY"
+
+/**
+ *  \brief A variable controlling whether SDL_QueueAudio() grows a full queue.
+ *
+ *  This hint is checked when the audio device is opened.
+ *
+ *  The variable can be set to the following values:
+ *    "0"       - SDL_QueueAudio() fails, and queues nothing, if the data
+ *                doesn't fit in the free space.
+ *    "1"       - The queue grows to hold whatever is queued. (default)
+ */
+#define SDL_HINT_AUDIO_QUEUE_GROWTH   "SDL_AUDIO_QUEUE_GROWTH"
+
+/**
+ *  \brief A variable setting how many voices an audio device's built-in mixer has.
+ *
+ *  The value is a number from 1 to 256; the default is 32. Voices are mixed
+ *  only while playing, so unused ones cost little more than memory.
+ *
+ *  This hint is checked when the first voice is created on a device.
+ */
+#define SDL_HINT_AUDIO_MIXER_VOICES   "SDL_AUDIO_MIXER_VOICES"
+
+/**
+ *  \brief A variable that makes each audio device log its performance counters.
+ *
+ *  The value is how often to log, in milliseconds. By default nothing is
+ *  logged. The summaries go to SDL_LOG_CATEGORY_AUDIO, at the INFO priority,
+ *  so you may also have to set that category's priority to see them.
+ *
+ *  This hint is checked when the audio device is opened.
+ *
+ *  \sa SDL_GetAudioDeviceStats
+ */
+#define SDL_HINT_AUDIO_DEVICE_STATS_LOG   "SDL_AUDIO_DEVICE_STATS_LOG"
+
+/**
+ *  \brief A variable controlling whether audio devices adapt their latency to underruns.
+ *
+ *  In adaptive mode, a playback device starts out with only two buffers of
+ *  the requested size queued. Each time it runs dry, it doubles that, up
+ *  to what the driver can hold, and after ten seconds without running dry
+ *  it gives one buffer back. The callback is always asked for the same
+ *  amount of audio; SDL_GetAudioDeviceLatency() reports the current
+ *  buffering. Drivers that can't do this keep their usual buffering.
+ *
+ *  This hint is checked when the audio device is opened.
+ *
+ *  The variable can be set to the following values:
+ *    "0"       - Keep the buffering chosen at open time. (default)
+ *    "1"       - Adapt the buffering to underruns.
+ */
+#define SDL_HINT_AUDIO_ADAPTIVE_LATENCY   "SDL_AUDIO_ADAPTIVE_LATENCY"
+
+/**
+ *  \brief A variable setting how many threads SDL_LoadWAV_RW() may use to decode ADPCM.
+ *
+ *  ADPCM data is made of blocks that decode independently, so large files
+ *  can be split across several threads. Files too small to benefit always
+ *  decode on the calling thread.
+ *
+ *  The variable can be set to the following values:
+ *    "1"       - Decode everything on the calling thread. (default)
+ *    "0"       - Use up to one thread per CPU.
+ *    "N"       - Use up to N threads, at most 16.
+ */
+#define SDL_HINT_WAVE_DECODE_THREADS   "SDL_WAVE_DECODE_THREADS"
+
+/**
+ *  \brief A variable controlling whether PulseAudio playback is tuned for low latency.
+ *
+ *  By default, the PulseAudio driver mixes in half the requested buffer
+ *  size and lets the server choose generous buffering, to avoid underruns.
+ *  In low latency mode, the server holds two buffers of the requested size
+ *  and starts playing as soon as one arrives, and SDL writes whenever the
+ *  server asks for more. Use SDL_GetAudioDeviceLatency() to see what the
+ *  server agreed to.
+ *
+ *  This hint is checked when the audio device is opened.
+ *
+ *  The variable can be set to the following values:
+ *    "0"       - Buffer for safety. (default)
+ *    "1"       - Buffer as little as the requested buffer size allows.
+ */
+#define SDL_HINT_AUDIO_PULSEAUDIO_LOW_LATENCY   "SDL_AUDIO_PULSEAUDIO_LOW_LATENCY"
+
 /**
  *  \brief  An enumeration of hint priorities
  */
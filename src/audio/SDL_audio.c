@@ -29,6 +29,15 @@
 #include "SDL_sysaudio.h"
 #include "../thread/SDL_systhread.h"
 
+#if SDL_AUDIO_PACE_TIMERFD
+#include <errno.h>
+#include <poll.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#endif
+
 #define _THIS SDL_AudioDevice *_this
 
 static SDL_AudioDriver current_audio;
@@ -38,6 +47,14 @@ static SDL_AudioDevice *open_devices[16];
 #define DEFAULT_OUTPUT_DEVNAME "System audio output device"
 #define DEFAULT_INPUT_DEVNAME "System audio capture device"
 
+/* Adaptive latency: how many buffers the fake stream can hold, and how
+   long a device has to go without underruns to give one back. */
+#define SDL_AUDIO_ADAPTIVE_FAKE_BUFFERS 8
+#define SDL_AUDIO_ADAPTIVE_SHRINK_SECONDS 10
+
+/* How many converters for formats no longer queued a playback queue keeps. */
+#define SDL_AUDIO_QUEUE_IDLE_STREAMS 4
+
 
 /*
  * Not all of these will be compiled and linked in, but it's convenient
@@ -195,12 +212,29 @@ SDL_AudioGetPendingBytes_Default(_THIS)
     return 0;
 }
 
+static int
+SDL_AudioGetPlaybackDelay_Default(_THIS)
+{
+    return -1;  /* don't know; SDL_RunAudio guesses from (latency_us). */
+}
+
 static Uint8 *
 SDL_AudioGetDeviceBuf_Default(_THIS)
 {
     return NULL;
 }
 
+static int
+SDL_AudioCaptureFromDevice_Default(_THIS, void *buffer, int buflen)
+{
+    return -1;  /* just fail immediately. */
+}
+
+static void
+SDL_AudioFlushCapture_Default(_THIS)
+{                               /* no-op. */
+}
+
 static void
 SDL_AudioWaitDone_Default(_THIS)
 {                               /* no-op. */
@@ -277,7 +311,10 @@ finalize_audio_entry_points(void)
     FILL_STUB(WaitDevice);
     FILL_STUB(PlayDevice);
     FILL_STUB(GetPendingBytes);
+    FILL_STUB(GetPlaybackDelay);
     FILL_STUB(GetDeviceBuf);
+    FILL_STUB(CaptureFromDevice);
+    FILL_STUB(FlushCapture);
     FILL_STUB(WaitDone);
     FILL_STUB(CloseDevice);
     FILL_STUB(LockDevice);
@@ -401,195 +438,1698 @@ mark_device_removed(void *handle, SDL_AudioDeviceItem *devices, SDL_bool *remove
     }
 }
 
-/* The audio backends call this when a device is removed from the system. */
+/* The audio backends call this when a device is removed from the system. */
+void
+SDL_RemoveAudioDevice(const int iscapture, void *handle)
+{
+    SDL_LockMutex(current_audio.detectionLock);
+    if (iscapture) {
+        mark_device_removed(handle, current_audio.inputDevices, &current_audio.captureDevicesRemoved);
+    } else {
+        mark_device_removed(handle, current_audio.outputDevices, &current_audio.outputDevicesRemoved);
+    }
+    SDL_UnlockMutex(current_audio.detectionLock);
+    current_audio.impl.FreeDeviceHandle(handle);
+}
+
+
+
+/* The callback the device was opened with, or the queue's. The built-in
+   mixer stands in for it once the app creates a voice. */
+static SDL_AudioCallback
+get_device_callback(SDL_AudioDevice *device)
+{
+    return device->mixer ? device->mixer->callback : device->spec.callback;
+}
+
+/* buffer queueing support... */
+
+/* Single producer, single consumer, so nobody ever waits on a lock. The
+   producer publishes (writepos) only after the data is in place, and the
+   consumer publishes (readpos) only after it's done reading. */
+static SDL_AudioRingBuffer *
+new_audio_ring(const Uint32 minsize)
+{
+    SDL_AudioRingBuffer *ring;
+    Uint32 size = 1;
+
+    while (size < minsize) {
+        size *= 2;
+    }
+
+    /* one allocation: the data lives right after the struct. */
+    ring = (SDL_AudioRingBuffer *) SDL_malloc(sizeof (SDL_AudioRingBuffer) + size);
+    if (ring == NULL) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    ring->data = (Uint8 *) (ring + 1);
+    ring->size = size;
+    SDL_AtomicSet(&ring->readpos, 0);
+    SDL_AtomicSet(&ring->writepos, 0);
+    ring->next = NULL;
+    return ring;
+}
+
+/* this expects that you managed thread safety elsewhere. */
+static void
+free_audio_rings(SDL_AudioRingBuffer *ring)
+{
+    while (ring) {
+        SDL_AudioRingBuffer *next = ring->next;
+        SDL_free(ring);
+        ring = next;
+    }
+}
+
+/* Frees the rings before (head), which the audio thread is done with.
+   Call this with (queue_lock) held. */
+static void
+free_drained_audio_rings(SDL_AudioDevice *device, SDL_AudioRingBuffer *head)
+{
+    while (device->queue_oldest != head) {
+        SDL_AudioRingBuffer *next = device->queue_oldest->next;
+        SDL_free(device->queue_oldest);
+        device->queue_oldest = next;
+    }
+}
+
+static Uint32
+audio_ring_available(SDL_AudioRingBuffer *ring)
+{
+    return (Uint32) SDL_AtomicGet(&ring->writepos) - (Uint32) SDL_AtomicGet(&ring->readpos);
+}
+
+/* Producer side: copies (len) bytes in at (pos), without publishing them. */
+static void
+audio_ring_copy_in(SDL_AudioRingBuffer *ring, const Uint32 pos, const void *data, const Uint32 len)
+{
+    const Uint32 offset = pos & (ring->size - 1);
+    const Uint32 cpy = SDL_min(len, ring->size - offset);
+    SDL_memcpy(ring->data + offset, data, cpy);
+    SDL_memcpy(ring->data, ((const Uint8 *) data) + cpy, len - cpy);
+}
+
+/* Producer side: makes everything before (pos) visible to the consumer. */
+static void
+audio_ring_publish(SDL_AudioRingBuffer *ring, const Uint32 pos)
+{
+    SDL_MemoryBarrierRelease();
+    SDL_AtomicSet(&ring->writepos, (int) pos);
+}
+
+/* Producer side. Returns how much fit; the rest is dropped. */
+static Uint32
+audio_ring_put(SDL_AudioRingBuffer *ring, const Uint8 *data, Uint32 len)
+{
+    const Uint32 writepos = (Uint32) SDL_AtomicGet(&ring->writepos);
+    const Uint32 space = ring->size - (writepos - (Uint32) SDL_AtomicGet(&ring->readpos));
+
+    len = SDL_min(len, space);
+    audio_ring_copy_in(ring, writepos, data, len);
+    audio_ring_publish(ring, writepos + len);
+    return len;
+}
+
+/* Consumer side. Returns how much was read. */
+static Uint32
+audio_ring_get(SDL_AudioRingBuffer *ring, Uint8 *data, Uint32 len)
+{
+    const Uint32 readpos = (Uint32) SDL_AtomicGet(&ring->readpos);
+    const Uint32 avail = (Uint32) SDL_AtomicGet(&ring->writepos) - readpos;
+    const Uint32 offset = readpos & (ring->size - 1);
+    Uint32 cpy;
+
+    SDL_MemoryBarrierAcquire();
+    len = SDL_min(len, avail);
+    cpy = SDL_min(len, ring->size - offset);
+    SDL_memcpy(data, ring->data + offset, cpy);
+    SDL_memcpy(data + cpy, ring->data, len - cpy);
+
+    SDL_MemoryBarrierRelease();
+    SDL_AtomicSet(&ring->readpos, (int) (readpos + len));
+    return len;
+}
+
+/* Consumer side: points (*ptr) at the data that can be read without
+   wrapping around, and returns how much that is. */
+static Uint32
+audio_ring_peek(SDL_AudioRingBuffer *ring, Uint8 **ptr)
+{
+    const Uint32 readpos = (Uint32) SDL_AtomicGet(&ring->readpos);
+    const Uint32 avail = (Uint32) SDL_AtomicGet(&ring->writepos) - readpos;
+    const Uint32 offset = readpos & (ring->size - 1);
+
+    SDL_MemoryBarrierAcquire();
+    *ptr = ring->data + offset;
+    return SDL_min(avail, ring->size - offset);
+}
+
+/* Consumer side: done with (len) bytes from audio_ring_peek(). */
+static void
+audio_ring_skip(SDL_AudioRingBuffer *ring, const Uint32 len)
+{
+    SDL_MemoryBarrierRelease();
+    SDL_AtomicAdd(&ring->readpos, (int) len);
+}
+
+/* Sets up the queue for a device opened without a callback. */
+static int
+init_audio_queue(SDL_AudioDevice *device, const Uint32 callback_len, const Uint32 defsize)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_AUDIO_QUEUE_CAPACITY);
+    Uint32 size = defsize;
+
+    if (hint && *hint) {
+        size = (Uint32) SDL_atoi(hint);
+    }
+
+    device->queue_head = new_audio_ring(SDL_max(size, callback_len * 2));
+    if (device->queue_head == NULL) {
+        return -1;
+    }
+    device->queue_tail = device->queue_oldest = device->queue_head;
+    SDL_AtomicSet(&device->queued_bytes, 0);
+
+    hint = SDL_GetHint(SDL_HINT_AUDIO_QUEUE_GROWTH);
+    device->queue_can_grow = (!hint || (*hint != '0')) ? SDL_TRUE : SDL_FALSE;
+
+    if (!device->iscapture) {
+        device->queue_lock = SDL_CreateMutex();
+        if (device->queue_lock == NULL) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static SDL_bool
+queue_chunk_is_callbackspec(const SDL_AudioQueueChunk *chunk, const SDL_AudioSpec *spec)
+{
+    return ((chunk->format == spec->format) && (chunk->channels == spec->channels) &&
+            (chunk->freq == spec->freq)) ? SDL_TRUE : SDL_FALSE;
+}
+
+/* Audio thread: starts on the next chunk in the queue, if there is one. */
+static SDL_bool
+next_queue_chunk(SDL_AudioDevice *device)
+{
+    SDL_AudioRingBuffer *ring = device->queue_head;
+
+    while (audio_ring_available(ring) == 0) {
+        /* this ring ran dry. If the app has moved on to a bigger one,
+           it won't touch this one again, so follow it. */
+        SDL_AudioRingBuffer *next = (SDL_AudioRingBuffer *) SDL_AtomicGetPtr((void **) &ring->next);
+        if (next == NULL) {
+            return SDL_FALSE;  /* nope, the queue is just empty. */
+        } else if (audio_ring_available(ring) == 0) {  /* in case more arrived before it moved. */
+            ring = next;
+            SDL_AtomicSetPtr((void **) &device->queue_head, ring);
+        }
+    }
+
+    /* the app publishes a chunk's header and data together, and never
+       splits them across rings. */
+    audio_ring_get(ring, (Uint8 *) &device->queue_chunk, sizeof (SDL_AudioQueueChunk));
+    device->queue_chunk_left = device->queue_chunk.len;
+    device->queue_chunk_counted = 0;
+
+    /* a chunk that carries on in the current converter doesn't need its
+       own reference; one that switches hands its over when it starts. */
+    if ((device->queue_chunk.stream != NULL) && (device->queue_chunk.stream == device->queue_stream)) {
+        SDL_AtomicDecRef(&device->queue_chunk.stream->refs);
+    }
+    return SDL_TRUE;
+}
+
+/* Audio thread: takes what has come out of the current chunk so far off
+   (queued_bytes), in proportion, so converted chunks come off evenly. */
+static void
+count_drained_queue_chunk(SDL_AudioDevice *device)
+{
+    const SDL_AudioQueueChunk *chunk = &device->queue_chunk;
+    const Uint32 drained = chunk->len - device->queue_chunk_left;
+    const Uint32 counted = (Uint32) ((((Uint64) chunk->outlen) * drained) / chunk->len);
+
+    SDL_AtomicAdd(&device->queued_bytes, -((int) (counted - device->queue_chunk_counted)));
+    device->queue_chunk_counted = counted;
+}
+
+/* Audio thread: hands the stream about as much of the current chunk as it
+   needs to make (len) more bytes, straight out of the ring. */
+static void
+feed_queue_stream(SDL_AudioDevice *device, const Uint32 len)
+{
+    const SDL_AudioQueueChunk *chunk = &device->queue_chunk;
+    const SDL_AudioSpec *spec = &device->callbackspec;
+    const Uint32 inframe = (SDL_AUDIO_BITSIZE(chunk->format) / 8) * chunk->channels;
+    const Uint32 outframe = (SDL_AUDIO_BITSIZE(spec->format) / 8) * spec->channels;
+    const Uint64 frames = ((((Uint64) (len / outframe)) + 1) * chunk->freq) / spec->freq + 1;
+    Uint32 want = (Uint32) SDL_min(frames * inframe, (Uint64) device->queue_chunk_left);
+    Uint8 *ptr;
+    Uint32 avail = audio_ring_peek(device->queue_head, &ptr);
+
+    avail = SDL_min(avail, want);
+    avail -= avail % inframe;
+    if (avail > 0) {
+        SDL_AudioStreamPut(device->queue_stream->stream, ptr, (int) avail);
+        audio_ring_skip(device->queue_head, avail);
+    } else {
+        /* a sample frame straddles the end of the ring. This holds the
+           biggest there can be: 255 channels of 32-bit samples. */
+        Uint8 frame[255 * 4];
+        avail = audio_ring_get(device->queue_head, frame, inframe);
+        SDL_AudioStreamPut(device->queue_stream->stream, frame, (int) avail);
+    }
+
+    device->queue_chunk_left -= avail;
+    device->queue_stream_flushed = SDL_FALSE;
+    count_drained_queue_chunk(device);
+}
+
+static void SDLCALL
+SDL_BufferQueueDrainCallback(void *userdata, Uint8 *stream, int _len)
+{
+    /* this function always holds the mixer lock before being called. */
+    Uint32 len = (Uint32) _len;
+    SDL_AudioDevice *device = (SDL_AudioDevice *) userdata;
+    const SDL_AudioQueueChunk *chunk;
+
+    SDL_assert(device != NULL);  /* this shouldn't ever happen, right?! */
+    SDL_assert(_len >= 0);  /* this shouldn't ever happen, right?! */
+
+    chunk = &device->queue_chunk;
+    while (len > 0) {
+        /* anything already converted goes first. */
+        if (device->queue_stream) {
+            const int got = SDL_AudioStreamGet(device->queue_stream->stream, stream, (int) len);
+            if (got > 0) {
+                stream += got;
+                len -= (Uint32) got;
+                if (len == 0) {
+                    break;
+                }
+            }
+        }
+
+        if ((device->queue_chunk_left == 0) && !next_queue_chunk(device)) {
+            /* Ran dry. Don't leave the end of the last chunk stuck in
+               the resampler waiting for more that might never come. */
+            if (device->queue_stream && !device->queue_stream_flushed) {
+                SDL_AudioStreamFlush(device->queue_stream->stream);
+                device->queue_stream_flushed = SDL_TRUE;
+                continue;
+            }
+            break;
+        }
+
+        if (device->queue_stream != chunk->stream) {
+            if (device->queue_stream) {
+                /* new format: finish the old one before starting on this. */
+                if (!device->queue_stream_flushed) {
+                    SDL_AudioStreamFlush(device->queue_stream->stream);
+                    device->queue_stream_flushed = SDL_TRUE;
+                    continue;
+                }
+                /* done with it; the app can reuse or free it now. */
+                SDL_AtomicDecRef(&device->queue_stream->refs);
+            }
+            /* this takes over the chunk's reference. */
+            device->queue_stream = chunk->stream;
+            device->queue_stream_flushed = SDL_TRUE;  /* nothing to flush yet. */
+        }
+
+        if (chunk->stream == NULL) {
+            /* no conversion needed, just copy it out. */
+            const Uint32 cpy = audio_ring_get(device->queue_head, stream, SDL_min(len, device->queue_chunk_left));
+            stream += cpy;
+            len -= cpy;
+            device->queue_chunk_left -= cpy;
+            count_drained_queue_chunk(device);
+            continue;
+        }
+
+        feed_queue_stream(device, len);
+    }
+
+    if (len > 0) {  /* fill any remaining space in the stream with silence. */
+        SDL_memset(stream, device->spec.silence, len);
+        /* it only counts as an underrun if it was playing something. */
+        if (device->queue_playing || (len < (Uint32) _len)) {
+            SDL_AtomicIncRef(&device->queue_underruns);
+        }
+        device->queue_playing = SDL_FALSE;
+    } else {
+        device->queue_playing = SDL_TRUE;
+    }
+}
+
+static void SDLCALL
+SDL_BufferQueueFillCallback(void *userdata, Uint8 *stream, int len)
+{
+    /* this function always holds the mixer lock before being called. */
+    SDL_AudioDevice *device = (SDL_AudioDevice *) userdata;
+
+    SDL_assert(device != NULL);  /* this shouldn't ever happen, right?! */
+    SDL_assert(device->iscapture);  /* this shouldn't ever happen, right?! */
+    SDL_assert(len >= 0);  /* this shouldn't ever happen, right?! */
+
+    /* if the app isn't keeping up, the newest data is lost. */
+    audio_ring_put(device->queue_tail, stream, (Uint32) len);
+}
+
+/* App side, under (queue_lock): finds or makes the converter for (chunk)'s
+   format and takes a reference for it. There's one per format, so a run of
+   chunks in one format resamples as a continuous stream. A few idle ones
+   are kept for formats that come back; the audio thread never has to
+   allocate or free any of them. */
+static SDL_AudioQueueStream *
+get_queue_stream(SDL_AudioDevice *device, const SDL_AudioQueueChunk *chunk)
+{
+    const SDL_AudioSpec *spec = &device->callbackspec;
+    SDL_AudioQueueStream *qstream = NULL;
+    SDL_AudioQueueStream **prev = &device->queue_streams;
+    int idle = 0;
+
+    while (*prev != NULL) {
+        SDL_AudioQueueStream *i = *prev;
+        if ((i->format == chunk->format) && (i->channels == chunk->channels) && (i->freq == chunk->freq)) {
+            qstream = i;  /* whatever the audio thread is doing with it, this goes after. */
+        } else if ((SDL_AtomicGet(&i->refs) == 0) && (++idle > SDL_AUDIO_QUEUE_IDLE_STREAMS)) {
+            /* the audio thread is done with it, and will never see it again. */
+            *prev = i->next;
+            SDL_FreeAudioStream(i->stream);
+            SDL_free(i);
+            continue;
+        }
+        prev = &i->next;
+    }
+
+    if (qstream == NULL) {
+        qstream = (SDL_AudioQueueStream *) SDL_calloc(1, sizeof (SDL_AudioQueueStream));
+        if (qstream == NULL) {
+            SDL_OutOfMemory();
+            return NULL;
+        }
+        qstream->stream = SDL_NewAudioStream(chunk->format, chunk->channels, chunk->freq,
+                                             spec->format, spec->channels, spec->freq);
+        if (qstream->stream == NULL) {
+            SDL_free(qstream);
+            return NULL;  /* SDL_NewAudioStream() set the error. */
+        }
+        qstream->format = chunk->format;
+        qstream->channels = chunk->channels;
+        qstream->freq = chunk->freq;
+        qstream->next = device->queue_streams;
+        device->queue_streams = qstream;
+    }
+
+    SDL_AtomicIncRef(&qstream->refs);
+    return qstream;
+}
+
+/* App side: frees every converter, once nothing can use them. */
+static void
+free_queue_streams(SDL_AudioDevice *device)
+{
+    SDL_AudioQueueStream *qstream = device->queue_streams;
+    while (qstream != NULL) {
+        SDL_AudioQueueStream *next = qstream->next;
+        SDL_FreeAudioStream(qstream->stream);
+        SDL_free(qstream);
+        qstream = next;
+    }
+    device->queue_streams = NULL;
+    device->queue_stream = NULL;
+}
+
+int
+SDL_QueueAudioFormat(SDL_AudioDeviceID devid, const void *data, Uint32 len,
+                     SDL_AudioFormat format, Uint8 channels, int freq)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+    const SDL_AudioSpec *spec;
+    SDL_AudioQueueChunk chunk;
+    SDL_AudioRingBuffer *ring;
+    Uint32 needed, writepos;
+    SDL_bool converting;
+
+    if (!device) {
+        return -1;  /* get_audio_device() will have set the error state */
+    }
+
+    if (device->iscapture) {
+        return SDL_SetError("This is a capture device, queueing not allowed");
+    } else if (get_device_callback(device) != SDL_BufferQueueDrainCallback) {
+        return SDL_SetError("Audio device has a callback, queueing not allowed");
+    }
+
+    if (len == 0) {
+        return 0;  /* nothing to do. */
+    }
+
+    spec = &device->callbackspec;
+    SDL_zero(chunk);
+    chunk.len = len;
+    chunk.outlen = len;
+    chunk.format = format;
+    chunk.channels = channels;
+    chunk.freq = freq;
+
+    converting = !queue_chunk_is_callbackspec(&chunk, spec);
+    if (converting) {
+        const Uint32 inframe = (SDL_AUDIO_BITSIZE(format) / 8) * channels;
+        const Uint32 outframe = (SDL_AUDIO_BITSIZE(spec->format) / 8) * spec->channels;
+        if ((inframe == 0) || (freq <= 0)) {
+            return SDL_InvalidParamError("format");
+        } else if ((len % inframe) != 0) {
+            return SDL_SetError("Can't queue partial sample frames");
+        }
+        chunk.outlen = (Uint32) (((((Uint64) (len / inframe)) * spec->freq) / freq) * outframe);
+    }
+
+    /* a chunk and its header have to fit in one ring. */
+    needed = (Uint32) sizeof (SDL_AudioQueueChunk) + len;
+    if (needed < len) {
+        return SDL_SetError("Audio data too large to queue");
+    }
+
+    /* The audio thread never takes this lock; it only keeps app threads
+       that queue at the same time from stepping on each other. */
+    SDL_LockMutex(device->queue_lock);
+
+    free_drained_audio_rings(device, (SDL_AudioRingBuffer *) SDL_AtomicGetPtr((void **) &device->queue_head));
+
+    ring = device->queue_tail;
+    if (needed > (ring->size - audio_ring_available(ring))) {
+        SDL_AudioRingBuffer *bigger;
+        if (!device->queue_can_grow) {
+            SDL_UnlockMutex(device->queue_lock);
+            return SDL_SetError("Audio queue is full");
+        }
+
+        /* Start a bigger ring after this one. The audio thread moves on
+           to it once it drains this one, so the order is kept. */
+        bigger = new_audio_ring(SDL_max(ring->size * 2, needed));
+        if (bigger == NULL) {
+            SDL_UnlockMutex(device->queue_lock);
+            return -1;  /* new_audio_ring() set the error. */
+        }
+        SDL_AtomicSetPtr((void **) &ring->next, bigger);
+        device->queue_tail = ring = bigger;
+    }
+
+    /* the converter is made here, so a format SDL can't convert is
+       reported now, and the audio thread never allocates. */
+    if (converting) {
+        chunk.stream = get_queue_stream(device, &chunk);
+        if (chunk.stream == NULL) {
+            SDL_UnlockMutex(device->queue_lock);
+            return -1;  /* get_queue_stream() set the error. */
+        }
+    }
+
+    /* count it first, so the audio thread can't take it below zero. */
+    SDL_AtomicAdd(&device->queued_bytes, (int) chunk.outlen);
+
+    /* the header and data go out together, so the audio thread never
+       sees one without the other. */
+    writepos = (Uint32) SDL_AtomicGet(&ring->writepos);
+    audio_ring_copy_in(ring, writepos, &chunk, sizeof (SDL_AudioQueueChunk));
+    audio_ring_copy_in(ring, writepos + sizeof (SDL_AudioQueueChunk), data, len);
+    audio_ring_publish(ring, writepos + needed);
+
+    SDL_UnlockMutex(device->queue_lock);
+
+    return 0;
+}
+
+int
+SDL_QueueAudio(SDL_AudioDeviceID devid, const void *data, Uint32 len)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+
+    if (!device) {
+        return -1;  /* get_audio_device() will have set the error state */
+    }
+
+    return SDL_QueueAudioFormat(devid, data, len, device->callbackspec.format,
+                                device->callbackspec.channels, device->callbackspec.freq);
+}
+
+Uint32
+SDL_DequeueAudio(SDL_AudioDeviceID devid, void *data, Uint32 len)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+
+    if ( (len == 0) ||  /* nothing to do? */
+         (!device) ||  /* called with bogus device id */
+         (!device->iscapture) ||  /* playback devices can't dequeue */
+         (get_device_callback(device) != SDL_BufferQueueFillCallback) ) { /* not set for queueing */
+        return 0;  /* just report zero bytes dequeued. */
+    }
+
+    /* no locking: the capture thread only ever adds to the ring. */
+    return audio_ring_get(device->queue_head, (Uint8 *) data, len);
+}
+
+Uint32
+SDL_GetQueuedAudioSize(SDL_AudioDeviceID devid)
+{
+    Uint32 retval = 0;
+    SDL_AudioDevice *device = get_audio_device(devid);
+
+    if (device && (get_device_callback(device) == SDL_BufferQueueFillCallback)) {
+        return audio_ring_available(device->queue_head);
+    }
+
+    /* Nothing to do unless we're set up for queueing. */
+    if (device && (get_device_callback(device) == SDL_BufferQueueDrainCallback)) {
+        /* no locking: the count is kept atomically. */
+        retval = (Uint32) SDL_AtomicGet(&device->queued_bytes) + current_audio.impl.GetPendingBytes(device);
+    }
+
+    return retval;
+}
+
+void
+SDL_ClearQueuedAudio(SDL_AudioDeviceID devid)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+    SDL_AudioQueueStream *qstream;
+    SDL_AudioRingBuffer *ring;
+
+    if (!device) {
+        return;  /* nothing to do. */
+    }
+
+    if (get_device_callback(device) == SDL_BufferQueueFillCallback) {
+        /* we're the consumer, so we can just skip everything. */
+        ring = device->queue_head;
+        SDL_AtomicSet(&ring->readpos, SDL_AtomicGet(&ring->writepos));
+        return;
+    } else if (get_device_callback(device) != SDL_BufferQueueDrainCallback) {
+        return;  /* not queueing. */
+    }
+
+    /* We have to stand in for the audio thread here, so this is the one
+       place that locks it out. Keep the newest ring and empty it. */
+    SDL_LockMutex(device->queue_lock);
+    current_audio.impl.LockDevice(device);
+    ring = device->queue_tail;
+    SDL_AtomicSet(&ring->readpos, SDL_AtomicGet(&ring->writepos));
+    SDL_AtomicSetPtr((void **) &device->queue_head, ring);
+    SDL_AtomicSet(&device->queued_bytes, 0);
+    device->queue_chunk_left = 0;
+    device->queue_playing = SDL_FALSE;  /* not an underrun, just quiet. */
+    if (device->queue_stream) {
+        SDL_AudioStreamClear(device->queue_stream->stream);
+        device->queue_stream_flushed = SDL_TRUE;
+    }
+    /* the chunks holding references are gone; only the current converter
+       is still in use. */
+    for (qstream = device->queue_streams; qstream != NULL; qstream = qstream->next) {
+        SDL_AtomicSet(&qstream->refs, (qstream == device->queue_stream) ? 1 : 0);
+    }
+    current_audio.impl.UnlockDevice(device);
+
+    free_drained_audio_rings(device, ring);
+    SDL_UnlockMutex(device->queue_lock);
+}
+
+
+/* built-in mixer support... */
+
+static void
+set_voice_param(SDL_atomic_t *param, float value)
+{
+    union { int i; float f; } u;
+    u.f = value;
+    SDL_AtomicSet(param, u.i);
+}
+
+/* Sets up the device's mixer the first time it's needed. */
+static SDL_AudioMixer *
+get_audio_mixer(SDL_AudioDevice *device)
+{
+    const SDL_AudioSpec *spec = &device->callbackspec;
+    const char *hint;
+    SDL_AudioMixer *mixer;
+    int num_voices = 32;
+
+    if (device->mixer) {
+        return device->mixer;
+    } else if (device->iscapture) {
+        SDL_SetError("Capture devices don't have a mixer");
+        return NULL;
+    }
+
+    hint = SDL_GetHint(SDL_HINT_AUDIO_MIXER_VOICES);
+    if (hint && *hint) {
+        num_voices = SDL_max(1, SDL_min(SDL_atoi(hint), 256));
+    }
+
+    mixer = (SDL_AudioMixer *) SDL_calloc(1, sizeof (SDL_AudioMixer));
+    if (mixer == NULL) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    mixer->num_voices = num_voices;
+    mixer->voices = (SDL_AudioVoice *) SDL_calloc(num_voices, sizeof (SDL_AudioVoice));
+    mixer->mixbuf_frames = SDL_max(spec->samples, 256);
+    mixer->mixbuf = (float *) SDL_malloc(mixer->mixbuf_frames * spec->channels * sizeof (float));
+    if ((mixer->voices == NULL) || (mixer->mixbuf == NULL)) {
+        SDL_free(mixer->voices);
+        SDL_free(mixer->mixbuf);
+        SDL_free(mixer);
+        SDL_OutOfMemory();
+        return NULL;
+    }
+
+    /* float can always shrink in place to the callback's format. */
+    if (SDL_BuildAudioCVT(&mixer->cvt, AUDIO_F32SYS, spec->channels, spec->freq,
+                          spec->format, spec->channels, spec->freq) < 0) {
+        SDL_free(mixer->voices);
+        SDL_free(mixer->mixbuf);
+        SDL_free(mixer);
+        return NULL;  /* SDL_BuildAudioCVT() set the error. */
+    }
+
+    current_audio.impl.LockDevice(device);
+    if (device->mixer) {  /* another thread got here first. */
+        current_audio.impl.UnlockDevice(device);
+        SDL_free(mixer->voices);
+        SDL_free(mixer->mixbuf);
+        SDL_free(mixer);
+        return device->mixer;
+    }
+    mixer->callback = device->spec.callback;
+    mixer->userdata = device->spec.userdata;
+    SDL_MemoryBarrierRelease();  /* get_device_callback() doesn't lock. */
+    device->mixer = mixer;
+    device->spec.callback = SDL_AudioMixerCallback;
+    device->spec.userdata = device;
+    current_audio.impl.UnlockDevice(device);
+
+    return mixer;
+}
+
+static SDL_AudioVoice *
+get_audio_voice(SDL_AudioDeviceID devid, SDL_AudioVoiceID voiceid)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+    SDL_AudioMixer *mixer;
+    const int slot = (int) (voiceid & 0xFF);
+
+    if (!device) {
+        return NULL;  /* get_audio_device() will have set the error state */
+    }
+
+    mixer = device->mixer;
+    if (!mixer || (voiceid == 0) || (slot >= mixer->num_voices) || (mixer->voices[slot].id != voiceid)) {
+        SDL_SetError("Invalid audio voice");
+        return NULL;
+    }
+    return &mixer->voices[slot];
+}
+
+SDL_AudioVoiceID
+SDL_CreateAudioVoice(SDL_AudioDeviceID devid, const void *data, Uint32 len,
+                     SDL_AudioFormat format, Uint8 channels, int freq)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+    const Uint8 voicechannels = (channels == 1) ? 1 : 2;
+    SDL_AudioVoiceID voiceid = 0;
+    SDL_AudioVoice *voice = NULL;
+    SDL_AudioMixer *mixer;
+    SDL_AudioCVT cvt;
+    Uint32 framesize;
+    int i;
+
+    if (!device) {
+        return 0;  /* get_audio_device() will have set the error state */
+    } else if (!data) {
+        SDL_InvalidParamError("data");
+        return 0;
+    }
+
+    mixer = get_audio_mixer(device);
+    if (!mixer) {
+        return 0;
+    }
+
+    /* voices keep their sound as float, at its own rate. */
+    if (SDL_BuildAudioCVT(&cvt, format, channels, freq, AUDIO_F32SYS, voicechannels, freq) < 0) {
+        return 0;  /* SDL_BuildAudioCVT() set the error. */
+    }
+    framesize = (SDL_AUDIO_BITSIZE(format) / 8) * channels;
+    if ((len == 0) || ((len % framesize) != 0)) {
+        SDL_SetError("Voices need a whole number of sample frames");
+        return 0;
+    }
+    cvt.len = (int) len;
+    cvt.buf = (Uint8 *) SDL_malloc(len * cvt.len_mult);
+    if (cvt.buf == NULL) {
+        SDL_OutOfMemory();
+        return 0;
+    }
+    SDL_memcpy(cvt.buf, data, len);
+    cvt.len_cvt = cvt.len;
+    if (cvt.needed && (SDL_ConvertAudio(&cvt) < 0)) {
+        SDL_free(cvt.buf);
+        return 0;
+    }
+
+    current_audio.impl.LockDevice(device);
+    for (i = 0; i < mixer->num_voices; i++) {
+        if (mixer->voices[i].id == 0) {
+            voice = &mixer->voices[i];
+            break;
+        }
+    }
+    if (voice != NULL) {
+        mixer->serial = (mixer->serial + 1) & 0xFFFFFF;
+        if (mixer->serial == 0) {
+            mixer->serial = 1;
+        }
+        voiceid = (mixer->serial << 8) | (Uint32) i;
+        voice->id = voiceid;
+        voice->data = (float *) cvt.buf;
+        voice->frames = ((Uint32) cvt.len_cvt) / (voicechannels * sizeof (float));
+        voice->channels = voicechannels;
+        voice->freq = freq;
+        set_voice_param(&voice->gain, 1.0f);
+        set_voice_param(&voice->pan, 0.0f);
+        set_voice_param(&voice->ratio, 1.0f);
+        SDL_AtomicSet(&voice->looping, 0);
+        SDL_AtomicSet(&voice->command, 0);
+        SDL_AtomicSet(&voice->playing, 0);
+        voice->position = 0;
+    }
+    current_audio.impl.UnlockDevice(device);
+
+    if (voice == NULL) {
+        SDL_free(cvt.buf);
+        SDL_SetError("No free audio voices (see SDL_HINT_AUDIO_MIXER_VOICES)");
+    }
+    return voiceid;
+}
+
+int
+SDL_PlayAudioVoice(SDL_AudioDeviceID devid, SDL_AudioVoiceID voiceid, SDL_bool loop)
+{
+    SDL_AudioVoice *voice = get_audio_voice(devid, voiceid);
+
+    if (!voice) {
+        return -1;
+    }
+    SDL_AtomicSet(&voice->looping, loop ? 1 : 0);
+    SDL_AtomicSet(&voice->command, SDL_AUDIOVOICE_PLAY);
+    return 0;
+}
+
+int
+SDL_PlayAudioVoiceAt(SDL_AudioDeviceID devid, SDL_AudioVoiceID voiceid, Uint64 frame, SDL_bool loop)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+    SDL_AudioVoice *voice = get_audio_voice(devid, voiceid);
+
+    if (!voice) {
+        return -1;
+    }
+
+    /* one app thread at a time, so the sequence only ever goes odd once. */
+    SDL_AtomicLock(&device->mixer->schedule_lock);
+    SDL_AtomicIncRef(&voice->start_sequence);  /* odd: the audio thread waits. */
+    SDL_AtomicSet(&voice->start_lo, (int) (Uint32) (frame & 0xFFFFFFFF));
+    SDL_AtomicSet(&voice->start_hi, (int) (Uint32) (frame >> 32));
+    SDL_AtomicIncRef(&voice->start_sequence);  /* even: done. */
+    SDL_AtomicSet(&voice->looping, loop ? 1 : 0);
+    SDL_AtomicSet(&voice->command, SDL_AUDIOVOICE_PLAY_AT);
+    SDL_AtomicUnlock(&device->mixer->schedule_lock);
+    return 0;
+}
+
+int
+SDL_StopAudioVoice(SDL_AudioDeviceID devid, SDL_AudioVoiceID voiceid)
+{
+    SDL_AudioVoice *voice = get_audio_voice(devid, voiceid);
+
+    if (!voice) {
+        return -1;
+    }
+    SDL_AtomicSet(&voice->command, SDL_AUDIOVOICE_STOP);
+    return 0;
+}
+
+int
+SDL_SetAudioVoiceParams(SDL_AudioDeviceID devid, SDL_AudioVoiceID voiceid,
+                        float gain, float pan, float ratio)
+{
+    SDL_AudioVoice *voice = get_audio_voice(devid, voiceid);
+
+    if (!voice) {
+        return -1;
+    } else if (!(gain >= 0.0f)) {
+        return SDL_InvalidParamError("gain");
+    } else if (!(pan >= -1.0f) || !(pan <= 1.0f)) {
+        return SDL_InvalidParamError("pan");
+    } else if (!(ratio > 0.0f) || !(ratio <= 256.0f)) {
+        return SDL_InvalidParamError("ratio");
+    }
+
+    /* each one on its own; the audio thread picks them up as they land. */
+    set_voice_param(&voice->gain, gain);
+    set_voice_param(&voice->pan, pan);
+    set_voice_param(&voice->ratio, ratio);
+    return 0;
+}
+
+SDL_bool
+SDL_IsAudioVoicePlaying(SDL_AudioDeviceID devid, SDL_AudioVoiceID voiceid)
+{
+    SDL_AudioVoice *voice = get_audio_voice(devid, voiceid);
+    int command;
+
+    if (!voice) {
+        return SDL_FALSE;
+    }
+
+    /* the audio thread clears a command only after acting on it. */
+    command = SDL_AtomicGet(&voice->command);
+    if (command != 0) {
+        return (command != SDL_AUDIOVOICE_STOP) ? SDL_TRUE : SDL_FALSE;
+    }
+    return SDL_AtomicGet(&voice->playing) ? SDL_TRUE : SDL_FALSE;
+}
+
+void
+SDL_DestroyAudioVoice(SDL_AudioDeviceID devid, SDL_AudioVoiceID voiceid)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+    SDL_AudioVoice *voice = get_audio_voice(devid, voiceid);
+    float *data;
+
+    if (!voice) {
+        return;
+    }
+
+    /* another thread may have destroyed it, and maybe reused the slot,
+       before we got the lock. */
+    current_audio.impl.LockDevice(device);
+    if (voice->id != voiceid) {
+        current_audio.impl.UnlockDevice(device);
+        return;
+    }
+    data = voice->data;
+    voice->id = 0;
+    voice->data = NULL;
+    current_audio.impl.UnlockDevice(device);
+
+    SDL_free(data);
+}
+
+
+/* effect chain support... */
+
+/* How many samples (not frames) the app's callback handles at a time, in
+   (callbackspec) format. Conversion and the stream can make this more or
+   less than (callbackspec.samples) frames, so it's worked out from the
+   buffer length SDL_RunAudio() and SDL_CaptureAudio() actually use. */
+static Uint32
+audio_callback_samples(const SDL_AudioDevice *device)
+{
+    Uint32 len;
+
+    if (device->iscapture) {
+        len = device->callback_len;
+    } else {
+        len = device->convert.needed ? (Uint32) device->convert.len : device->spec.size;
+    }
+    return len / (SDL_AUDIO_BITSIZE(device->callbackspec.format) / 8);
+}
+
+/* Sets up the device's effect chain the first time it's needed. */
+static SDL_AudioEffectChain *
+get_audio_effects(SDL_AudioDevice *device)
+{
+    const SDL_AudioSpec *specs[2];
+    SDL_AudioEffectChain *chain;
+    int i;
+
+    if (device->effects) {
+        return device->effects;
+    } else if (device->iscapture) {
+        SDL_SetError("Capture devices don't have effects");
+        return NULL;
+    }
+
+    specs[0] = &device->callbackspec;
+    specs[1] = &device->spec;
+
+    chain = (SDL_AudioEffectChain *) SDL_calloc(1, sizeof (SDL_AudioEffectChain));
+    if (chain == NULL) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    chain->work = (float *) SDL_malloc(SDL_max(audio_callback_samples(device),
+                                               specs[1]->samples * specs[1]->channels) * sizeof (float));
+    if (chain->work == NULL) {
+        SDL_free(chain);
+        SDL_OutOfMemory();
+        return NULL;
+    }
+
+    for (i = 0; i < 2; i++) {
+        const SDL_AudioSpec *spec = specs[i];
+        if ((SDL_BuildAudioCVT(&chain->to_float[i], spec->format, spec->channels, spec->freq,
+                               AUDIO_F32SYS, spec->channels, spec->freq) < 0) ||
+            (SDL_BuildAudioCVT(&chain->from_float[i], AUDIO_F32SYS, spec->channels, spec->freq,
+                               spec->format, spec->channels, spec->freq) < 0)) {
+            SDL_free(chain->work);
+            SDL_free(chain);
+            return NULL;  /* SDL_BuildAudioCVT() set the error. */
+        }
+    }
+
+    current_audio.impl.LockDevice(device);
+    if (device->effects) {  /* another thread got here first. */
+        current_audio.impl.UnlockDevice(device);
+        SDL_free(chain->work);
+        SDL_free(chain);
+        return device->effects;
+    }
+    SDL_MemoryBarrierRelease();
+    device->effects = chain;
+    current_audio.impl.UnlockDevice(device);
+
+    return chain;
+}
+
+/* Finds an effect in the chain, or returns -1. The caller holds the
+   chain's (params_lock), so the effect can't be removed under it. */
+static int
+find_audio_effect(SDL_AudioEffectChain *chain, SDL_AudioEffectID effectid)
+{
+    int i;
+
+    if (effectid != 0) {
+        for (i = 0; i < chain->num_effects; i++) {
+            if (chain->effects[i]->id == effectid) {
+                return i;
+            }
+        }
+    }
+    return -1;
+}
+
+/* Hands new parameters to the audio thread; see SDL_AudioEffect. Once an
+   effect is in the chain, the caller holds the chain's (params_lock). */
+static void
+set_effect_params(SDL_AudioEffect *effect, const float *params, int count)
+{
+    SDL_AtomicIncRef(&effect->sequence);  /* odd: the audio thread waits. */
+    SDL_MemoryBarrierRelease();
+    SDL_memcpy(effect->pending, params, count * sizeof (float));
+    effect->pending_count = count;
+    SDL_MemoryBarrierRelease();
+    SDL_AtomicIncRef(&effect->sequence);  /* even: done. */
+}
+
+SDL_AudioEffectID
+SDL_AddAudioEffect(SDL_AudioDeviceID devid, SDL_AudioEffectType type, SDL_bool after_conversion)
+{
+    static const float biquad[] = { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+    static const float limiter[] = { 1.0f, 50.0f };
+    static const float dcblocker[] = { 0.995f };
+    static const float convolution[] = { 1.0f };
+    SDL_AudioDevice *device = get_audio_device(devid);
+    SDL_AudioEffectID effectid = 0;
+    SDL_AudioEffectChain *chain;
+    SDL_AudioEffect *effect;
+    const SDL_AudioSpec *spec;
+
+    if (!device) {
+        return 0;  /* get_audio_device() will have set the error state */
+    } else if ((type < SDL_AUDIOEFFECT_BIQUAD) || (type > SDL_AUDIOEFFECT_CONVOLUTION)) {
+        SDL_InvalidParamError("type");
+        return 0;
+    }
+
+    chain = get_audio_effects(device);
+    if (!chain) {
+        return 0;
+    }
+
+    spec = after_conversion ? &device->spec : &device->callbackspec;
+    effect = (SDL_AudioEffect *) SDL_calloc(1, sizeof (SDL_AudioEffect));
+    if (effect != NULL && type == SDL_AUDIOEFFECT_CONVOLUTION) {
+        effect->history = (float *) SDL_calloc(spec->channels * 2 * SDL_AUDIOEFFECT_MAX_TAPS, sizeof (float));
+        if (effect->history == NULL) {
+            SDL_free(effect);
+            effect = NULL;
+        }
+    }
+    if (effect == NULL) {
+        SDL_OutOfMemory();
+        return 0;
+    }
+    effect->type = type;
+    effect->after_conversion = after_conversion ? SDL_TRUE : SDL_FALSE;
+    effect->channels = spec->channels;
+    effect->freq = spec->freq;
+    effect->params = effect->paramsbuf[0];
+
+    switch (type) {
+    case SDL_AUDIOEFFECT_BIQUAD: set_effect_params(effect, biquad, SDL_arraysize(biquad)); break;
+    case SDL_AUDIOEFFECT_LIMITER: set_effect_params(effect, limiter, SDL_arraysize(limiter)); break;
+    case SDL_AUDIOEFFECT_DCBLOCKER: set_effect_params(effect, dcblocker, SDL_arraysize(dcblocker)); break;
+    case SDL_AUDIOEFFECT_CONVOLUTION: set_effect_params(effect, convolution, SDL_arraysize(convolution)); break;
+    }
+
+    current_audio.impl.LockDevice(device);
+    SDL_AtomicLock(&chain->params_lock);
+    if (chain->num_effects < SDL_AUDIO_MAX_EFFECTS) {
+        chain->serial++;
+        if (chain->serial == 0) {
+            chain->serial = 1;
+        }
+        effectid = chain->serial;
+        effect->id = effectid;
+        chain->effects[chain->num_effects++] = effect;
+    }
+    SDL_AtomicUnlock(&chain->params_lock);
+    current_audio.impl.UnlockDevice(device);
+
+    if (effectid == 0) {
+        SDL_free(effect->history);
+        SDL_free(effect);
+        SDL_SetError("No room for more audio effects (the most is %d)", SDL_AUDIO_MAX_EFFECTS);
+    }
+    return effectid;
+}
+
+int
+SDL_SetAudioEffectParams(SDL_AudioDeviceID devid, SDL_AudioEffectID effectid,
+                         const float *params, int count)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+    SDL_AudioEffectChain *chain;
+    SDL_AudioEffect *effect;
+    const char *invalid = NULL;
+    int expected = 0;
+    int i;
+
+    if (!device) {
+        return -1;  /* get_audio_device() will have set the error state */
+    }
+
+    chain = device->effects;
+    if (!chain) {
+        return SDL_SetError("Invalid audio effect");
+    } else if (!params) {
+        return SDL_InvalidParamError("params");
+    }
+
+    /* held until the parameters are written, so nobody frees the effect first. */
+    SDL_AtomicLock(&chain->params_lock);
+    i = find_audio_effect(chain, effectid);
+    if (i < 0) {
+        SDL_AtomicUnlock(&chain->params_lock);
+        return SDL_SetError("Invalid audio effect");
+    }
+    effect = chain->effects[i];
+
+    switch (effect->type) {
+    case SDL_AUDIOEFFECT_BIQUAD: expected = 5; break;
+    case SDL_AUDIOEFFECT_LIMITER: expected = 2; break;
+    case SDL_AUDIOEFFECT_DCBLOCKER: expected = 1; break;
+    case SDL_AUDIOEFFECT_CONVOLUTION: expected = count; break;
+    }
+
+    if ((count != expected) || (count < 1) || (count > SDL_AUDIOEFFECT_MAX_TAPS)) {
+        invalid = "count";
+    } else if ((effect->type == SDL_AUDIOEFFECT_LIMITER) && (!(params[0] > 0.0f) || !(params[1] > 0.0f))) {
+        invalid = "params";
+    } else if ((effect->type == SDL_AUDIOEFFECT_DCBLOCKER) && (!(params[0] >= 0.0f) || !(params[0] < 1.0f))) {
+        invalid = "params";
+    } else {
+        set_effect_params(effect, params, count);
+    }
+    SDL_AtomicUnlock(&chain->params_lock);
+
+    return invalid ? SDL_InvalidParamError(invalid) : 0;
+}
+
+void
+SDL_RemoveAudioEffect(SDL_AudioDeviceID devid, SDL_AudioEffectID effectid)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+    SDL_AudioEffectChain *chain;
+    SDL_AudioEffect *effect;
+    int i;
+
+    if (!device) {
+        return;
+    }
+
+    chain = device->effects;
+    if (!chain) {
+        return;
+    }
+
+    /* the device lock keeps the audio thread out; (params_lock) keeps out
+       app threads setting this effect's parameters. */
+    current_audio.impl.LockDevice(device);
+    SDL_AtomicLock(&chain->params_lock);
+    i = find_audio_effect(chain, effectid);
+    if (i >= 0) {
+        effect = chain->effects[i];
+        chain->num_effects--;
+        SDL_memmove(&chain->effects[i], &chain->effects[i + 1],
+                    (chain->num_effects - i) * sizeof (SDL_AudioEffect *));
+        SDL_free(effect->history);
+        SDL_free(effect);
+    }
+    SDL_AtomicUnlock(&chain->params_lock);
+    current_audio.impl.UnlockDevice(device);
+}
+
+
+/* performance counter support... */
+
+/* Returns the counter ticks since (*since), and moves it up to now. */
+static Uint64
+audio_stats_lap(Uint64 *since)
+{
+    const Uint64 now = SDL_GetPerformanceCounter();
+    const Uint64 retval = now - *since;
+    *since = now;
+    return retval;
+}
+
+static Uint32
+audio_ticks_to_us(const Uint64 ticks)
+{
+    const Uint64 us = (ticks * 1000000) / SDL_GetPerformanceFrequency();
+    return (us > 0xFFFFFFFF) ? 0xFFFFFFFF : (Uint32) us;
+}
+
+/* Returns how many counter ticks (frames) sample frames last at (freq). */
+static Uint64
+audio_frames_to_ticks(const Uint32 frames, const int freq)
+{
+    return (((Uint64) frames) * SDL_GetPerformanceFrequency()) / freq;
+}
+
+static void
+add_audio_timing(SDL_AudioTiming *timing, const Uint64 ticks)
+{
+    const Uint32 us = audio_ticks_to_us(ticks);
+    int bucket = 0;
+
+    while ((bucket < (SDL_AUDIO_TIMING_BUCKETS - 1)) && ((us >> (bucket + 1)) != 0)) {
+        bucket++;
+    }
+
+    if ((timing->count == 0) || (us < timing->min_us)) {
+        timing->min_us = us;
+    }
+    if (us > timing->max_us) {
+        timing->max_us = us;
+    }
+    timing->count++;
+    timing->total_us += us;
+    timing->histogram[bucket]++;
+}
+
+static Uint32
+average_audio_timing(const SDL_AudioTiming *timing)
+{
+    return timing->count ? (Uint32) (timing->total_us / timing->count) : 0;
+}
+
+static void
+log_audio_stats(SDL_AudioDevice *device)
+{
+    const SDL_AudioDeviceStats *stats = &device->stats;
+
+    SDL_LogInfo(SDL_LOG_CATEGORY_AUDIO,
+                "Audio device %u: %u buffers, %u late, %u queue underruns, %u xruns",
+                (unsigned int) device->id, (unsigned int) stats->buffers,
+                (unsigned int) stats->late_buffers,
+                (unsigned int) SDL_AtomicGet(&device->queue_underruns),
+                (unsigned int) SDL_AtomicGet(&device->xruns));
+    SDL_LogInfo(SDL_LOG_CATEGORY_AUDIO,
+                "Audio device %u: avg/max usecs: callback %u/%u, convert %u/%u, play %u/%u, wait %u/%u, jitter %u/%u",
+                (unsigned int) device->id,
+                (unsigned int) average_audio_timing(&stats->callback), (unsigned int) stats->callback.max_us,
+                (unsigned int) average_audio_timing(&stats->convert), (unsigned int) stats->convert.max_us,
+                (unsigned int) average_audio_timing(&stats->play), (unsigned int) stats->play.max_us,
+                (unsigned int) average_audio_timing(&stats->wait), (unsigned int) stats->wait.max_us,
+                (unsigned int) average_audio_timing(&stats->jitter), (unsigned int) stats->jitter.max_us);
+}
+
+/* Device thread: records a buffer, which started at (start) and should
+   take (period) to play. The rest are how long each step took, all in
+   counter ticks; zero means the step didn't happen. */
+static void
+record_audio_stats(SDL_AudioDevice *device, const Uint64 start, const Uint64 period,
+                   const Uint64 callback, const Uint64 convert, const Uint64 play, const Uint64 wait)
+{
+    SDL_AudioDeviceStats *stats = &device->stats;
+
+    SDL_AtomicIncRef(&device->stats_sequence);  /* odd: readers keep out. */
+
+    if (SDL_AtomicCAS(&device->stats_reset, 1, 0)) {
+        SDL_zerop(stats);
+        device->stats_last_start = 0;
+    }
+
+    stats->buffers++;
+    if ((callback + convert) > period) {
+        stats->late_buffers++;
+    }
+    add_audio_timing(&stats->callback, callback);
+    if (convert) {
+        add_audio_timing(&stats->convert, convert);
+    }
+    if (play) {
+        add_audio_timing(&stats->play, play);
+    }
+    if (wait) {
+        add_audio_timing(&stats->wait, wait);
+    }
+    if (device->stats_last_start) {
+        const Uint64 interval = start - device->stats_last_start;
+        add_audio_timing(&stats->jitter, (interval > period) ? (interval - period) : (period - interval));
+    }
+    device->stats_last_start = start;
+
+    SDL_MemoryBarrierRelease();
+    SDL_AtomicIncRef(&device->stats_sequence);  /* even: done. */
+
+    if (device->stats_log_interval && ((start - device->stats_last_log) >= device->stats_log_interval)) {
+        device->stats_last_log = start;
+        log_audio_stats(device);
+    }
+}
+
+int
+SDL_GetAudioDeviceStats(SDL_AudioDeviceID devid, SDL_AudioDeviceStats *stats)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+
+    if (!device) {
+        return -1;  /* get_audio_device() will have set the error state */
+    } else if (!stats) {
+        return SDL_InvalidParamError("stats");
+    }
+
+    /* The device thread never waits for us, so copy until we get a copy
+       it didn't touch while we were at it. It only takes a moment to
+       update them, once a buffer. */
+    for (;;) {
+        const int sequence = SDL_AtomicGet(&device->stats_sequence);
+        if ((sequence & 1) == 0) {
+            SDL_MemoryBarrierAcquire();
+            SDL_memcpy(stats, &device->stats, sizeof (SDL_AudioDeviceStats));
+            SDL_MemoryBarrierAcquire();
+            if (SDL_AtomicGet(&device->stats_sequence) == sequence) {
+                break;
+            }
+        }
+    }
+
+    stats->queue_underruns = (Uint32) SDL_AtomicGet(&device->queue_underruns);
+    stats->xruns = (Uint32) SDL_AtomicGet(&device->xruns);
+    return 0;
+}
+
 void
-SDL_RemoveAudioDevice(const int iscapture, void *handle)
+SDL_ResetAudioDeviceStats(SDL_AudioDeviceID devid)
 {
-    SDL_LockMutex(current_audio.detectionLock);
-    if (iscapture) {
-        mark_device_removed(handle, current_audio.inputDevices, &current_audio.captureDevicesRemoved);
-    } else {
-        mark_device_removed(handle, current_audio.outputDevices, &current_audio.outputDevicesRemoved);
+    SDL_AudioDevice *device = get_audio_device(devid);
+
+    if (device) {
+        SDL_AtomicSet(&device->queue_underruns, 0);
+        SDL_AtomicSet(&device->xruns, 0);
+        SDL_AtomicSet(&device->stats_reset, 1);  /* the device thread does the rest. */
     }
-    SDL_UnlockMutex(current_audio.detectionLock);
-    current_audio.impl.FreeDeviceHandle(handle);
 }
 
+int
+SDL_GetAudioDeviceLatency(SDL_AudioDeviceID devid)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
+
+    if (!device) {
+        return -1;  /* get_audio_device() will have set the error state */
+    } else if (device->adaptive) {
+        return SDL_AtomicGet(&device->adaptive_latency_us);
+    }
+    return (int) device->latency_us;
+}
 
 
-/* buffer queueing support... */
+/* playback position support... */
 
-/* this expects that you managed thread safety elsewhere. */
+/* Device thread: counts the buffer just played or paced, and publishes
+   how much the device has played. The fake stream holds exactly what its
+   pacing says is queued, (fake_queued) nanoseconds' worth; drivers that
+   can't say how much they still hold are taken to hold all of (latency_us). */
 static void
-free_audio_queue(SDL_AudioBufferQueue *buffer)
+update_audio_position(SDL_AudioDevice *device, const SDL_bool fake, const Uint64 fake_queued)
 {
-    while (buffer) {
-        SDL_AudioBufferQueue *next = buffer->next;
-        SDL_free(buffer);
-        buffer = next;
+    Sint64 delay = 0;
+    Uint64 now;
+
+    device->frames_written += device->spec.samples;
+    if (fake) {
+        delay = (Sint64) ((fake_queued * device->spec.freq) / 1000000000);
+    } else {
+        delay = (Sint64) current_audio.impl.GetPlaybackDelay(device);
+        if (delay < 0) {
+            delay = (Sint64) ((((Uint64) device->latency_us) * device->spec.freq) / 1000000);
+        }
+        if (((Uint64) delay) > device->frames_written) {
+            delay = (Sint64) device->frames_written;
+        }
     }
+    now = SDL_GetPerformanceCounter();
+
+    SDL_AtomicIncRef(&device->position_sequence);  /* odd: readers keep out. */
+    device->position_frames = device->frames_written - (Uint64) delay;
+    device->position_time = now;
+    SDL_MemoryBarrierRelease();
+    SDL_AtomicIncRef(&device->position_sequence);  /* even: done. */
 }
 
-static void SDLCALL
-SDL_BufferQueueDrainCallback(void *userdata, Uint8 *stream, int _len)
+int
+SDL_GetAudioDevicePosition(SDL_AudioDeviceID devid, Uint64 *frames, Uint64 *timestamp)
 {
-    /* this function always holds the mixer lock before being called. */
-    Uint32 len = (Uint32) _len;
-    SDL_AudioDevice *device = (SDL_AudioDevice *) userdata;
-    SDL_AudioBufferQueue *buffer;
-
-    SDL_assert(device != NULL);  /* this shouldn't ever happen, right?! */
-    SDL_assert(_len >= 0);  /* this shouldn't ever happen, right?! */
-
-    while ((len > 0) && ((buffer = device->buffer_queue_head) != NULL)) {
-        const Uint32 avail = buffer->datalen - buffer->startpos;
-        const Uint32 cpy = SDL_min(len, avail);
-        SDL_assert(device->queued_bytes >= avail);
-
-        SDL_memcpy(stream, buffer->data + buffer->startpos, cpy);
-        buffer->startpos += cpy;
-        stream += cpy;
-        device->queued_bytes -= cpy;
-        len -= cpy;
+    SDL_AudioDevice *device = get_audio_device(devid);
+    Uint64 played, when;
 
-        if (buffer->startpos == buffer->datalen) {  /* packet is done, put it in the pool. */
-            device->buffer_queue_head = buffer->next;
-            SDL_assert((buffer->next != NULL) || (buffer == device->buffer_queue_tail));
-            buffer->next = device->buffer_queue_pool;
-            device->buffer_queue_pool = buffer;
+    if (!device) {
+        return -1;  /* get_audio_device() will have set the error state */
+    } else if (device->iscapture) {
+        return SDL_SetError("This is a capture device, it has no playback position");
+    } else if (!frames) {
+        return SDL_InvalidParamError("frames");
+    }
+
+    /* same as SDL_GetAudioDeviceStats(): the device thread never waits. */
+    for (;;) {
+        const int sequence = SDL_AtomicGet(&device->position_sequence);
+        if ((sequence & 1) == 0) {
+            SDL_MemoryBarrierAcquire();
+            played = device->position_frames;
+            when = device->position_time;
+            SDL_MemoryBarrierAcquire();
+            if (SDL_AtomicGet(&device->position_sequence) == sequence) {
+                break;
+            }
         }
     }
 
-    SDL_assert((device->buffer_queue_head != NULL) == (device->queued_bytes != 0));
-
-    if (len > 0) {  /* fill any remaining space in the stream with silence. */
-        SDL_assert(device->buffer_queue_head == NULL);
-        SDL_memset(stream, device->spec.silence, len);
+    /* count in the app's frames, in case the device runs at another rate. */
+    if (device->callbackspec.freq != device->spec.freq) {
+        played = (played * device->callbackspec.freq) / device->spec.freq;
     }
 
-    if (device->buffer_queue_head == NULL) {
-        device->buffer_queue_tail = NULL;  /* in case we drained the queue entirely. */
+    *frames = played;
+    if (timestamp) {
+        /* nothing's been played yet; it's at zero as of now. */
+        *timestamp = when ? when : SDL_GetPerformanceCounter();
     }
+    return 0;
 }
 
 int
-SDL_QueueAudio(SDL_AudioDeviceID devid, const void *_data, Uint32 len)
+SDL_SetAudioDeviceMetering(SDL_AudioDeviceID devid, SDL_bool enable)
 {
     SDL_AudioDevice *device = get_audio_device(devid);
-    const Uint8 *data = (const Uint8 *) _data;
-    SDL_AudioBufferQueue *orighead;
-    SDL_AudioBufferQueue *origtail;
-    Uint32 origlen;
-    Uint32 datalen;
+    const SDL_AudioSpec *spec;
+    float *work;
 
     if (!device) {
         return -1;  /* get_audio_device() will have set the error state */
     }
 
-    if (device->spec.callback != SDL_BufferQueueDrainCallback) {
-        return SDL_SetError("Audio device has a callback, queueing not allowed");
+    spec = &device->callbackspec;
+    if (enable && !device->meter_work && (spec->format != AUDIO_F32SYS) && (spec->format != AUDIO_S16SYS)) {
+        /* the device thread measures other formats as float. */
+        work = (float *) SDL_malloc(audio_callback_samples(device) * sizeof (float));
+        if (work == NULL) {
+            return SDL_OutOfMemory();
+        }
+        current_audio.impl.LockDevice(device);
+        if (device->meter_work) {  /* another thread got here first. */
+            SDL_free(work);
+        } else if (SDL_BuildAudioCVT(&device->meter_cvt, spec->format, spec->channels, spec->freq,
+                                     AUDIO_F32SYS, spec->channels, spec->freq) < 0) {
+            current_audio.impl.UnlockDevice(device);
+            SDL_free(work);
+            return -1;  /* SDL_BuildAudioCVT() set the error. */
+        } else {
+            device->meter_work = work;
+        }
+        current_audio.impl.UnlockDevice(device);
     }
 
-    current_audio.impl.LockDevice(device);
-
-    orighead = device->buffer_queue_head;
-    origtail = device->buffer_queue_tail;
-    origlen = origtail ? origtail->datalen : 0;
-
-    while (len > 0) {
-        SDL_AudioBufferQueue *packet = device->buffer_queue_tail;
-        SDL_assert(!packet || (packet->datalen <= SDL_AUDIOBUFFERQUEUE_PACKETLEN));
-        if (!packet || (packet->datalen >= SDL_AUDIOBUFFERQUEUE_PACKETLEN)) {
-            /* tail packet missing or completely full; we need a new packet. */
-            packet = device->buffer_queue_pool;
-            if (packet != NULL) {
-                /* we have one available in the pool. */
-                device->buffer_queue_pool = packet->next;
-            } else {
-                /* Have to allocate a new one! */
-                packet = (SDL_AudioBufferQueue *) SDL_malloc(sizeof (SDL_AudioBufferQueue));
-                if (packet == NULL) {
-                    /* uhoh, reset so we've queued nothing new, free what we can. */
-                    if (!origtail) {
-                        packet = device->buffer_queue_head;  /* whole queue. */
-                    } else {
-                        packet = origtail->next;  /* what we added to existing queue. */
-                        origtail->next = NULL;
-                        origtail->datalen = origlen;
-                    }
-                    device->buffer_queue_head = orighead;
-                    device->buffer_queue_tail = origtail;
-                    device->buffer_queue_pool = NULL;
-
-                    current_audio.impl.UnlockDevice(device);
-
-                    free_audio_queue(packet);  /* give back what we can. */
+    if (enable) {
+        SDL_AtomicSet(&device->meter_reset, 1);
+    }
+    SDL_MemoryBarrierRelease();
+    SDL_AtomicSet(&device->metering, enable ? 1 : 0);
+    return 0;
+}
 
-                    return SDL_OutOfMemory();
-                }
-            }
-            packet->datalen = 0;
-            packet->startpos = 0;
-            packet->next = NULL;
+int
+SDL_GetAudioDeviceMeter(SDL_AudioDeviceID devid, SDL_AudioMeter *meter, SDL_bool reset)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
 
-            SDL_assert((device->buffer_queue_head != NULL) == (device->queued_bytes != 0));
-            if (device->buffer_queue_tail == NULL) {
-                device->buffer_queue_head = packet;
-            } else {
-                device->buffer_queue_tail->next = packet;
+    if (!device) {
+        return -1;  /* get_audio_device() will have set the error state */
+    } else if (!meter) {
+        return SDL_InvalidParamError("meter");
+    }
+
+    /* same as SDL_GetAudioDeviceStats(): the device thread never waits. */
+    for (;;) {
+        const int sequence = SDL_AtomicGet(&device->meter_sequence);
+        if ((sequence & 1) == 0) {
+            SDL_MemoryBarrierAcquire();
+            SDL_memcpy(meter, &device->meter, sizeof (SDL_AudioMeter));
+            SDL_MemoryBarrierAcquire();
+            if (SDL_AtomicGet(&device->meter_sequence) == sequence) {
+                break;
             }
-            device->buffer_queue_tail = packet;
         }
+    }
 
-        datalen = SDL_min(len, SDL_AUDIOBUFFERQUEUE_PACKETLEN - packet->datalen);
-        SDL_memcpy(packet->data + packet->datalen, data, datalen);
-        data += datalen;
-        len -= datalen;
-        packet->datalen += datalen;
-        device->queued_bytes += datalen;
+    if (reset) {
+        SDL_AtomicSet(&device->meter_reset, 1);  /* the device thread does the rest. */
     }
+    return 0;
+}
 
-    current_audio.impl.UnlockDevice(device);
 
-    return 0;
+/* Pacing for devices that give the thread nothing to block on: the fake
+   stream, paused capture, and disabled devices. Each buffer sleeps until
+   an absolute deadline, one period after the last, so rounding never
+   accumulates. wake_audio_thread() ends the sleep early. */
+static void
+init_audio_pacing(SDL_AudioDevice *device)
+{
+#if SDL_AUDIO_PACE_TIMERFD
+    device->pace_timerfd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK);
+    device->pace_eventfd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if ((device->pace_timerfd >= 0) && (device->pace_eventfd >= 0)) {
+        return;
+    }
+    if (device->pace_timerfd >= 0) {
+        close(device->pace_timerfd);
+    }
+    if (device->pace_eventfd >= 0) {
+        close(device->pace_eventfd);
+    }
+    device->pace_timerfd = device->pace_eventfd = -1;
+#endif
+    /* if this fails, we fall back to SDL_Delay() and nothing wakes us. */
+    device->pace_sem = SDL_CreateSemaphore(0);
 }
 
-Uint32
-SDL_GetQueuedAudioSize(SDL_AudioDeviceID devid)
+static void
+quit_audio_pacing(SDL_AudioDevice *device)
 {
-    Uint32 retval = 0;
-    SDL_AudioDevice *device = get_audio_device(devid);
+#if SDL_AUDIO_PACE_TIMERFD
+    if (device->pace_timerfd >= 0) {
+        close(device->pace_timerfd);
+        close(device->pace_eventfd);
+        device->pace_timerfd = device->pace_eventfd = -1;
+    }
+#endif
+    if (device->pace_sem != NULL) {
+        SDL_DestroySemaphore(device->pace_sem);
+        device->pace_sem = NULL;
+    }
+}
 
-    /* Nothing to do unless we're set up for queueing. */
-    if (device && (device->spec.callback == SDL_BufferQueueDrainCallback)) {
-        current_audio.impl.LockDevice(device);
-        retval = device->queued_bytes + current_audio.impl.GetPendingBytes(device);
-        current_audio.impl.UnlockDevice(device);
+static void
+wake_audio_thread(SDL_AudioDevice *device)
+{
+#if SDL_AUDIO_PACE_TIMERFD
+    if (device->pace_eventfd >= 0) {
+        const Uint64 one = 1;
+        if (write(device->pace_eventfd, &one, sizeof (one)) < 0) {
+            /* already signaled, the counter can't overflow from here. */
+        }
+        return;
+    }
+#endif
+    if ((device->pace_sem != NULL) && (SDL_SemValue(device->pace_sem) == 0)) {
+        SDL_SemPost(device->pace_sem);
     }
+}
 
-    return retval;
+/* Nanoseconds on the clock the deadlines are kept in. */
+static Uint64
+audio_pace_now(void)
+{
+#if SDL_AUDIO_PACE_TIMERFD
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (((Uint64) now.tv_sec) * 1000000000) + now.tv_nsec;
+#else
+    const Uint64 freq = SDL_GetPerformanceFrequency();
+    const Uint64 now = SDL_GetPerformanceCounter();
+    return ((now / freq) * 1000000000) + (((now % freq) * 1000000000) / freq);
+#endif
 }
 
-void
-SDL_ClearQueuedAudio(SDL_AudioDeviceID devid)
+/* Sleeps until (deadline), returns SDL_TRUE if woken up before it. */
+static SDL_bool
+audio_pace_wait(SDL_AudioDevice *device, const Uint64 deadline)
 {
-    SDL_AudioDevice *device = get_audio_device(devid);
-    SDL_AudioBufferQueue *buffer = NULL;
-    if (!device) {
-        return;  /* nothing to do. */
+#if SDL_AUDIO_PACE_TIMERFD
+    if (device->pace_timerfd >= 0) {
+        struct itimerspec when;
+        struct pollfd pfds[2];
+        Uint64 count;
+
+        SDL_zero(when);
+        when.it_value.tv_sec = (time_t) (deadline / 1000000000);
+        when.it_value.tv_nsec = (long) (deadline % 1000000000);
+        if (timerfd_settime(device->pace_timerfd, TFD_TIMER_ABSTIME, &when, NULL) == 0) {
+            int polled;
+            pfds[0].fd = device->pace_timerfd;
+            pfds[1].fd = device->pace_eventfd;
+            pfds[0].events = pfds[1].events = POLLIN;
+            do {
+                pfds[0].revents = pfds[1].revents = 0;
+                polled = poll(pfds, 2, -1);
+            } while ((polled < 0) && (errno == EINTR));
+
+            if (polled >= 0) {
+                if (pfds[0].revents & POLLIN) {
+                    if (read(device->pace_timerfd, &count, sizeof (count)) < 0) {
+                        /* nonblocking, so it was a spurious wakeup. */
+                    }
+                }
+                if (pfds[1].revents & POLLIN) {
+                    if (read(device->pace_eventfd, &count, sizeof (count)) < 0) {
+                        /* someone else drained it; fine. */
+                    }
+                    return SDL_TRUE;
+                }
+                return SDL_FALSE;
+            }
+            /* poll() itself failed, so sleep the plain way below. */
+        }
+    }
+#endif
+    for (;;) {
+        const Uint64 now = audio_pace_now();
+        Uint32 ms;
+        if (now >= deadline) {
+            return SDL_FALSE;
+        }
+        /* round up, we'd rather be a little late than spin. */
+        ms = (Uint32) (((deadline - now) + 999999) / 1000000);
+        if (device->pace_sem == NULL) {
+            SDL_Delay(ms);
+        } else if (SDL_SemWaitTimeout(device->pace_sem, ms) == 0) {
+            return SDL_TRUE;
+        }
     }
+}
 
-    /* Blank out the device and release the mutex. Free it afterwards. */
-    current_audio.impl.LockDevice(device);
-    buffer = device->buffer_queue_head;
-    device->buffer_queue_tail = NULL;
-    device->buffer_queue_head = NULL;
-    device->queued_bytes = 0;
-    current_audio.impl.UnlockDevice(device);
+/* Waits out one (period) after the last deadline in (*deadline), less
+   (ahead), which an adaptive device keeps queued; the deadlines are when
+   the emulated device runs out of audio. A deadline of zero, or one
+   that's fallen more than a period behind, restarts the schedule from now;
+   with audio queued ahead, any deadline that's passed does. Being woken up
+   restarts the next call too. Returns SDL_TRUE if the audio queued ahead
+   ran out before this call. */
+static SDL_bool
+audio_pace(SDL_AudioDevice *device, Uint64 *deadline, const Uint64 period, const Uint64 ahead)
+{
+    const Uint64 now = audio_pace_now();
+    const SDL_bool dry = (ahead && (*deadline != 0) && (now > *deadline)) ? SDL_TRUE : SDL_FALSE;
+
+    if (device->shutdown) {
+        return SDL_FALSE;  /* don't hold up SDL_CloseAudioDevice(). */
+    }
+
+    if ((*deadline == 0) || (now > (*deadline + (ahead ? 0 : period)))) {
+        *deadline = now;
+    }
+    *deadline += period;
+
+    if (audio_pace_wait(device, *deadline - ahead)) {
+        *deadline = 0;
+    }
+    return dry;
+}
 
-    free_audio_queue(buffer);
+/* How many nanoseconds of audio the fake stream holds until (deadline). */
+static Uint64
+audio_pace_queued(const Uint64 deadline)
+{
+    const Uint64 now = audio_pace_now();
+    return (deadline > now) ? (deadline - now) : 0;
 }
 
+/* Device thread: after each buffer, doubles how much an adaptive device
+   keeps queued if it ran dry since last time, and gives a buffer back
+   after a stretch without that. */
+static void
+adapt_audio_latency(SDL_AudioDevice *device)
+{
+    const int xruns = SDL_AtomicGet(&device->xruns);
+    Uint32 frames = device->adaptive_frames;
+
+    device->adaptive_stable += device->spec.samples;
+    if (xruns > device->adaptive_xruns) {
+        frames = SDL_min(frames * 2, device->adaptive_max);
+        device->adaptive_stable = 0;
+    } else if (device->adaptive_stable >= (Uint32) (device->spec.freq * SDL_AUDIO_ADAPTIVE_SHRINK_SECONDS)) {
+        frames = SDL_max(frames - device->spec.samples, device->spec.samples * 2);
+        device->adaptive_stable = 0;
+    }
+    device->adaptive_xruns = xruns;  /* this also catches SDL_ResetAudioDeviceStats(). */
+
+    if (frames != device->adaptive_frames) {
+        device->adaptive_frames = frames;
+        SDL_AtomicSet(&device->adaptive_latency_us,
+                      (int) ((((Uint64) frames) * 1000000) / device->spec.freq));
+        SDL_LogDebug(SDL_LOG_CATEGORY_AUDIO, "Audio device %u: keeping %u frames queued",
+                     (unsigned int) device->id, (unsigned int) frames);
+    }
+}
 
 /* The general mixing thread function */
 int SDLCALL
@@ -597,11 +2137,15 @@ SDL_RunAudio(void *devicep)
 {
     SDL_AudioDevice *device = (SDL_AudioDevice *) devicep;
     const int silence = (int) device->spec.silence;
-    const Uint32 delay = ((device->spec.samples * 1000) / device->spec.freq);
+    const Uint64 delay = (((Uint64) device->spec.samples) * 1000000000) / device->spec.freq;
     const int stream_len = (device->convert.needed) ? device->convert.len : device->spec.size;
+    const int framesize = (SDL_AUDIO_BITSIZE(device->callbackspec.format) / 8) * device->callbackspec.channels;
+    const Uint64 period = audio_frames_to_ticks(stream_len / framesize, device->callbackspec.freq);
+    Uint64 deadline = 0;
+    Uint64 ahead = 0;
     Uint8 *stream;
-    void *udata = device->spec.userdata;
-    void (SDLCALL *fill) (void *, Uint8 *, int) = device->spec.callback;
+
+    SDL_assert(!device->iscapture);
 
     /* The audio mixing is always a high priority thread */
     SDL_SetThreadPriority(SDL_THREAD_PRIORITY_HIGH);
@@ -612,8 +2156,18 @@ SDL_RunAudio(void *devicep)
 
     /* Loop, filling the audio buffers */
     while (!device->shutdown) {
+        const Uint64 start = SDL_GetPerformanceCounter();
+        Uint64 lap = start;
+        Uint64 callback_ticks, convert_ticks = 0, play_ticks = 0, wait_ticks = 0;
+        SDL_bool metered;
+
+        /* the fake stream keeps all but the buffer it's making queued. */
+        if (device->adaptive) {
+            ahead = (((Uint64) (device->adaptive_frames - device->spec.samples)) * 1000000000) / device->spec.freq;
+        }
+
         /* Fill the current buffer with sound */
-        if (device->convert.needed) {
+        if (device->convert.needed && !device->convert_in_place) {
             stream = device->convert.buf;
         } else if (device->enabled) {
             stream = current_audio.impl.GetDeviceBuf(device);
@@ -635,29 +2189,109 @@ SDL_RunAudio(void *devicep)
         if (device->paused) {
             SDL_memset(stream, silence, stream_len);
         } else {
-            (*fill) (udata, stream, stream_len);
+            /* the built-in mixer may have taken over the callback since last time. */
+            (*device->spec.callback) (device->spec.userdata, stream, stream_len);
+        }
+        metered = SDL_FALSE;
+        if (device->effects && (stream != device->fake_stream)) {
+            metered = SDL_RunAudioEffects(device, stream, stream_len, SDL_FALSE);
+        }
+        if (!metered && SDL_AtomicGet(&device->metering)) {
+            SDL_MeterAudio(device, stream, stream_len);
         }
         SDL_UnlockMutex(device->mixer_lock);
+        device->callback_frames += stream_len / framesize;  /* paused or not. */
+        callback_ticks = audio_stats_lap(&lap);
+
+        if (device->stream) {
+            /* if this fails...oh well. We'll play silence here. */
+            SDL_AudioStreamPut(device->stream, stream, stream_len);
+            convert_ticks += audio_stats_lap(&lap);
+
+            while (SDL_AudioStreamAvailable(device->stream) >= ((int) device->spec.size)) {
+                stream = device->enabled ? current_audio.impl.GetDeviceBuf(device) : NULL;
+                if (stream == NULL) {
+                    stream = device->fake_stream;
+                }
+                SDL_AudioStreamGet(device->stream, stream, device->spec.size);
+                if (device->effects && (stream != device->fake_stream)) {
+                    SDL_LockMutex(device->mixer_lock);
+                    SDL_RunAudioEffects(device, stream, device->spec.size, SDL_TRUE);
+                    SDL_UnlockMutex(device->mixer_lock);
+                }
+                convert_ticks += audio_stats_lap(&lap);
 
-        /* Convert the audio if necessary */
-        if (device->enabled && device->convert.needed) {
-            SDL_ConvertAudio(&device->convert);
-            stream = current_audio.impl.GetDeviceBuf(device);
-            if (stream == NULL) {
-                stream = device->fake_stream;
+                if (stream == device->fake_stream) {
+                    if (audio_pace(device, &deadline, delay, ahead)) {
+                        SDL_AtomicIncRef(&device->xruns);  /* the emulated device ran dry. */
+                    }
+                } else {
+                    deadline = 0;
+                    current_audio.impl.PlayDevice(device);
+                    play_ticks += audio_stats_lap(&lap);
+                    current_audio.impl.WaitDevice(device);
+                }
+                wait_ticks += audio_stats_lap(&lap);
+                if (stream == device->fake_stream) {
+                    update_audio_position(device, SDL_TRUE, audio_pace_queued(deadline));
+                } else {
+                    update_audio_position(device, SDL_FALSE, 0);
+                }
+                if (device->adaptive) {
+                    adapt_audio_latency(device);
+                }
+            }
+            record_audio_stats(device, start, period, callback_ticks, convert_ticks, play_ticks, wait_ticks);
+            continue;
+        }
+
+        /* Convert the audio if necessary. Nobody hears the fake stream. */
+        if (device->convert.needed && (stream != device->fake_stream)) {
+            if (device->convert_in_place) {
+                device->convert.buf = stream;
+                SDL_ConvertAudio(&device->convert);
+                device->convert.buf = NULL;
             } else {
-                SDL_memcpy(stream, device->convert.buf,
-                           device->convert.len_cvt);
+                SDL_ConvertAudio(&device->convert);
+                stream = device->enabled ? current_audio.impl.GetDeviceBuf(device) : NULL;
+                if (stream == NULL) {
+                    stream = device->fake_stream;
+                } else {
+                    SDL_memcpy(stream, device->convert.buf,
+                               device->convert.len_cvt);
+                }
             }
+            convert_ticks = audio_stats_lap(&lap);
+        }
+
+        if (device->effects && (stream != device->fake_stream)) {
+            SDL_LockMutex(device->mixer_lock);
+            SDL_RunAudioEffects(device, stream, device->spec.size, SDL_TRUE);
+            SDL_UnlockMutex(device->mixer_lock);
         }
 
         /* Ready current buffer for play and change current buffer */
         if (stream == device->fake_stream) {
-            SDL_Delay(delay);
+            if (audio_pace(device, &deadline, delay, ahead)) {
+                SDL_AtomicIncRef(&device->xruns);  /* the emulated device ran dry. */
+            }
         } else {
+            deadline = 0;
             current_audio.impl.PlayDevice(device);
+            play_ticks = audio_stats_lap(&lap);
             current_audio.impl.WaitDevice(device);
         }
+        wait_ticks = audio_stats_lap(&lap);
+        if (stream == device->fake_stream) {
+            update_audio_position(device, SDL_TRUE, audio_pace_queued(deadline));
+        } else {
+            update_audio_position(device, SDL_FALSE, 0);
+        }
+        if (device->adaptive) {
+            adapt_audio_latency(device);
+        }
+
+        record_audio_stats(device, start, period, callback_ticks, convert_ticks, play_ticks, wait_ticks);
     }
 
     /* Wait for the audio to drain. */
@@ -666,6 +2300,112 @@ SDL_RunAudio(void *devicep)
     return 0;
 }
 
+/* The general capture thread function */
+static int SDLCALL
+SDL_CaptureAudio(void *devicep)
+{
+    SDL_AudioDevice *device = (SDL_AudioDevice *) devicep;
+    const int silence = (int) device->spec.silence;
+    const Uint64 delay = (((Uint64) device->spec.samples) * 1000000000) / device->spec.freq;
+    const int stream_len = (int) device->spec.size;
+    const int callback_len = (int) device->callback_len;
+    Uint8 *stream = device->fake_stream;
+    void *udata = device->spec.userdata;
+    void (SDLCALL *callback) (void *, Uint8 *, int) = device->spec.callback;
+    const Uint64 period = audio_frames_to_ticks(device->spec.samples, device->spec.freq);
+    Uint64 deadline = 0;
+
+    SDL_assert(device->iscapture);
+
+    /* The audio mixing is always a high priority thread */
+    SDL_SetThreadPriority(SDL_THREAD_PRIORITY_HIGH);
+
+    /* Perform any thread setup */
+    device->threadid = SDL_ThreadID();
+    current_audio.impl.ThreadInit(device);
+
+    /* Loop, reading from the device and feeding the app */
+    while (!device->shutdown) {
+        const Uint64 start = SDL_GetPerformanceCounter();
+        Uint64 lap = start;
+        Uint64 callback_ticks = 0, convert_ticks = 0, wait_ticks;
+        int still_need = stream_len;
+        Uint8 *ptr = stream;
+
+        if (device->paused) {
+            audio_pace(device, &deadline, delay, 0);  /* just so we don't cook the CPU. */
+            current_audio.impl.FlushCapture(device);  /* dump anything pending. */
+            continue;
+        }
+
+        if (!device->enabled) {
+            /* like output, keep the app's callback firing at a regular
+               frequency, with silence, until they close the device. */
+            audio_pace(device, &deadline, delay, 0);
+        } else {
+            deadline = 0;
+            /* the driver blocks until it has data, so this paces us. */
+            while (still_need > 0) {
+                const int rc = current_audio.impl.CaptureFromDevice(device, ptr, still_need);
+                SDL_assert(rc <= still_need);  /* device should not overflow buffer. :) */
+                if (rc > 0) {
+                    still_need -= rc;
+                    ptr += rc;
+                } else {  /* uhoh, device failed for some reason! */
+                    SDL_OpenedAudioDeviceDisconnected(device);
+                    break;
+                }
+            }
+        }
+
+        if (still_need > 0) {
+            /* Keep any data we already read, silence the rest. */
+            SDL_memset(ptr, silence, still_need);
+        }
+        wait_ticks = audio_stats_lap(&lap);
+
+        if (!device->stream) {
+            /* !!! FIXME: this should be LockDevice. */
+            SDL_LockMutex(device->mixer_lock);
+            if (!device->paused) {
+                if (SDL_AtomicGet(&device->metering)) {
+                    SDL_MeterAudio(device, stream, stream_len);
+                }
+                (*callback) (udata, stream, stream_len);
+            }
+            SDL_UnlockMutex(device->mixer_lock);
+            callback_ticks = audio_stats_lap(&lap);
+            record_audio_stats(device, start, period, callback_ticks, 0, 0, wait_ticks);
+            continue;
+        }
+
+        /* if this fails...oh well. The app gets a little less data. */
+        SDL_AudioStreamPut(device->stream, stream, stream_len);
+        convert_ticks += audio_stats_lap(&lap);
+
+        while (SDL_AudioStreamAvailable(device->stream) >= callback_len) {
+            SDL_AudioStreamGet(device->stream, device->work_buffer, callback_len);
+            convert_ticks += audio_stats_lap(&lap);
+
+            /* !!! FIXME: this should be LockDevice. */
+            SDL_LockMutex(device->mixer_lock);
+            if (!device->paused) {
+                if (SDL_AtomicGet(&device->metering)) {
+                    SDL_MeterAudio(device, device->work_buffer, callback_len);
+                }
+                (*callback) (udata, device->work_buffer, callback_len);
+            }
+            SDL_UnlockMutex(device->mixer_lock);
+            callback_ticks += audio_stats_lap(&lap);
+        }
+        record_audio_stats(device, start, period, callback_ticks, convert_ticks, 0, wait_ticks);
+    }
+
+    current_audio.impl.FlushCapture(device);
+
+    return 0;
+}
+
 
 static SDL_AudioFormat
 SDL_ParseAudioFormat(const char *string)
@@ -876,22 +2616,48 @@ close_audio_device(SDL_AudioDevice * device)
     device->enabled = 0;
     device->shutdown = 1;
     if (device->thread != NULL) {
+        wake_audio_thread(device);
         SDL_WaitThread(device->thread, NULL);
     }
+    quit_audio_pacing(device);
     if (device->mixer_lock != NULL) {
         SDL_DestroyMutex(device->mixer_lock);
     }
     SDL_FreeAudioMem(device->fake_stream);
+    SDL_FreeAudioMem(device->work_buffer);
     if (device->convert.needed) {
         SDL_FreeAudioMem(device->convert.buf);
     }
+    SDL_FreeAudioStream(device->stream);
     if (device->opened) {
         current_audio.impl.CloseDevice(device);
         device->opened = 0;
     }
 
-    free_audio_queue(device->buffer_queue_head);
-    free_audio_queue(device->buffer_queue_pool);
+    free_audio_rings(device->queue_oldest);
+    free_queue_streams(device);
+    if (device->mixer != NULL) {
+        int i;
+        for (i = 0; i < device->mixer->num_voices; i++) {
+            SDL_free(device->mixer->voices[i].data);
+        }
+        SDL_free(device->mixer->voices);
+        SDL_free(device->mixer->mixbuf);
+        SDL_free(device->mixer);
+    }
+    if (device->effects != NULL) {
+        int i;
+        for (i = 0; i < device->effects->num_effects; i++) {
+            SDL_free(device->effects->effects[i]->history);
+            SDL_free(device->effects->effects[i]);
+        }
+        SDL_free(device->effects->work);
+        SDL_free(device->effects);
+    }
+    SDL_free(device->meter_work);
+    if (device->queue_lock != NULL) {
+        SDL_DestroyMutex(device->queue_lock);
+    }
 
     SDL_FreeAudioMem(device);
 }
@@ -969,6 +2735,7 @@ open_audio_device(const char *devname, int iscapture,
     SDL_AudioDevice *device;
     SDL_bool build_cvt;
     void *handle = NULL;
+    const char *hint;
     Uint32 stream_len;
     int i = 0;
 
@@ -1079,6 +2846,9 @@ open_audio_device(const char *devname, int iscapture,
     device->enabled = 1;
     device->paused = 1;
     device->iscapture = iscapture;
+#if SDL_AUDIO_PACE_TIMERFD
+    device->pace_timerfd = device->pace_eventfd = -1;
+#endif
 
     /* Create a mutex for locking the sound buffers */
     if (!current_audio.impl.SkipMixerLock) {
@@ -1090,12 +2860,42 @@ open_audio_device(const char *devname, int iscapture,
         }
     }
 
+    /* drivers that can keep part of their buffer empty can adapt, and so
+       can the fake stream, which drivers without GetDeviceBuf play to.
+       Drivers with their own callback thread never run SDL_RunAudio, which
+       does the adapting, so they can't. */
+    hint = SDL_GetHint(SDL_HINT_AUDIO_ADAPTIVE_LATENCY);
+    if (!iscapture && hint && (*hint != '0') &&
+        !current_audio.impl.ProvidesOwnCallbackThread &&
+        (current_audio.impl.SupportsAdaptiveLatency ||
+         (current_audio.impl.GetDeviceBuf == SDL_AudioGetDeviceBuf_Default))) {
+        device->adaptive = SDL_TRUE;
+    }
+
     if (current_audio.impl.OpenDevice(device, handle, devname, iscapture) < 0) {
         close_audio_device(device);
         return 0;
     }
     device->opened = 1;
 
+    if (device->latency_us == 0) {
+        device->latency_us = (Uint32) ((((Uint64) device->spec.samples) * 1000000) / device->spec.freq);
+    }
+
+    /* start out double buffered, the least that can play without gaps. */
+    if (device->adaptive) {
+        if (!current_audio.impl.SupportsAdaptiveLatency) {
+            device->adaptive_max = device->spec.samples * SDL_AUDIO_ADAPTIVE_FAKE_BUFFERS;
+        }
+        if (device->adaptive_max < (device->spec.samples * 2)) {
+            device->adaptive = SDL_FALSE;
+        } else {
+            device->adaptive_frames = device->spec.samples * 2;
+            SDL_AtomicSet(&device->adaptive_latency_us,
+                          (int) ((((Uint64) device->adaptive_frames) * 1000000) / device->spec.freq));
+        }
+    }
+
     /* See if we need to do any conversion */
     build_cvt = SDL_FALSE;
     if (obtained->freq != device->spec.freq) {
@@ -1129,7 +2929,32 @@ open_audio_device(const char *devname, int iscapture,
         SDL_CalculateAudioSpec(obtained);
     }
 
-    if (build_cvt) {
+    device->callback_len = device->spec.size;
+    device->callbackspec = *obtained;
+
+    hint = SDL_GetHint(SDL_HINT_AUDIO_DEVICE_STATS_LOG);
+    if (hint && (SDL_atoi(hint) > 0)) {
+        device->stats_log_interval = (((Uint64) SDL_atoi(hint)) * SDL_GetPerformanceFrequency()) / 1000;
+        device->stats_last_log = SDL_GetPerformanceCounter();
+    }
+
+    if (build_cvt && iscapture) {
+        /* Capture converts from the device's format to the app's, and the
+           stream lets the two sides work in differently sized buffers. */
+        device->stream = SDL_NewAudioStream(device->spec.format, device->spec.channels, device->spec.freq,
+                                            obtained->format, obtained->channels, obtained->freq);
+        if (device->stream == NULL) {
+            close_audio_device(device);
+            return 0;
+        }
+        device->callback_len = obtained->size;
+        device->work_buffer = (Uint8 *) SDL_AllocAudioMem(device->callback_len);
+        if (device->work_buffer == NULL) {
+            close_audio_device(device);
+            SDL_OutOfMemory();
+            return 0;
+        }
+    } else if (build_cvt) {
         /* Build an audio conversion block */
         if (SDL_BuildAudioCVT(&device->convert,
                               obtained->format, obtained->channels,
@@ -1143,10 +2968,35 @@ open_audio_device(const char *devname, int iscapture,
             device->convert.len = (int) (((double) device->spec.size) /
                                          device->convert.len_ratio);
 
-            device->convert.buf =
-                (Uint8 *) SDL_AllocAudioMem(device->convert.len *
-                                            device->convert.len_mult);
-            if (device->convert.buf == NULL) {
+            /* Rate conversion goes through a stream on our own thread,
+               which only takes whole sample frames. */
+            if ((obtained->freq != device->spec.freq) &&
+                (!current_audio.impl.ProvidesOwnCallbackThread)) {
+                const int framesize = (SDL_AUDIO_BITSIZE(obtained->format) / 8) * obtained->channels;
+                device->convert.len -= device->convert.len % framesize;
+                device->stream = SDL_NewAudioStream(obtained->format, obtained->channels, obtained->freq,
+                                                    device->spec.format, device->spec.channels, device->spec.freq);
+                if (device->stream == NULL) {
+                    close_audio_device(device);
+                    return 0;
+                }
+            }
+
+            /* Widening conversions (U8 or S16 to float, mono to stereo,
+               etc) fit in the device buffer, so there's nothing to copy.
+               Drivers with their own callback thread convert in
+               (convert.buf) themselves. */
+            if ((device->stream == NULL) &&
+                (!current_audio.impl.ProvidesOwnCallbackThread) &&
+                ((Uint32) (device->convert.len * device->convert.len_mult) <= device->spec.size)) {
+                device->convert_in_place = SDL_TRUE;
+                device->convert.buf = NULL;
+            } else {
+                device->convert.buf =
+                    (Uint8 *) SDL_AllocAudioMem(device->convert.len *
+                                                device->convert.len_mult);
+            }
+            if ((device->convert.buf == NULL) && !device->convert_in_place) {
                 close_audio_device(device);
                 SDL_OutOfMemory();
                 return 0;
@@ -1167,21 +3017,22 @@ open_audio_device(const char *devname, int iscapture,
         return 0;
     }
 
-    if (device->spec.callback == NULL) {  /* use buffer queueing? */
-        /* pool a few packets to start. Enough for two callbacks. */
-        const int packetlen = SDL_AUDIOBUFFERQUEUE_PACKETLEN;
-        const int wantbytes = ((device->convert.needed) ? device->convert.len : device->spec.size) * 2;
-        const int wantpackets = (wantbytes / packetlen) + ((wantbytes % packetlen) ? packetlen : 0);
-        for (i = 0; i < wantpackets; i++) {
-            SDL_AudioBufferQueue *packet = (SDL_AudioBufferQueue *) SDL_malloc(sizeof (SDL_AudioBufferQueue));
-            if (packet) { /* don't care if this fails, we'll deal later. */
-                packet->datalen = 0;
-                packet->startpos = 0;
-                packet->next = device->buffer_queue_pool;
-                device->buffer_queue_pool = packet;
-            }
+    if ((device->spec.callback == NULL) && iscapture) {  /* use buffer queueing? */
+        /* by default, room for about a second of audio. */
+        const Uint32 framesize = (SDL_AUDIO_BITSIZE(obtained->format) / 8) * obtained->channels;
+        if (init_audio_queue(device, device->callback_len, framesize * obtained->freq) < 0) {
+            close_audio_device(device);
+            return 0;
+        }
+        device->spec.callback = SDL_BufferQueueFillCallback;
+        device->spec.userdata = device;
+    } else if (device->spec.callback == NULL) {  /* use buffer queueing? */
+        /* by default, enough for four callbacks to start. */
+        const Uint32 callback_len = (device->convert.needed) ? (Uint32) device->convert.len : device->spec.size;
+        if (init_audio_queue(device, callback_len, callback_len * 4) < 0) {
+            close_audio_device(device);
+            return 0;
         }
-
         device->spec.callback = SDL_BufferQueueDrainCallback;
         device->spec.userdata = device;
     }
@@ -1196,10 +3047,14 @@ open_audio_device(const char *devname, int iscapture,
         /* !!! FIXME: we don't force the audio thread stack size here because it calls into user code, but maybe we should? */
         /* buffer queueing callback only needs a few bytes, so make the stack tiny. */
         char name[64];
-        const size_t stacksize = (device->spec.callback == SDL_BufferQueueDrainCallback) ? 64 * 1024 : 0;
+        const SDL_bool queueing = ((device->spec.callback == SDL_BufferQueueDrainCallback) ||
+                                   (device->spec.callback == SDL_BufferQueueFillCallback)) ? SDL_TRUE : SDL_FALSE;
+        const size_t stacksize = queueing ? 64 * 1024 : 0;
 
+        init_audio_pacing(device);
         SDL_snprintf(name, sizeof (name), "SDLAudioDev%d", (int) device->id);
-        device->thread = SDL_CreateThreadInternal(SDL_RunAudio, name, stacksize, device);
+        device->thread = SDL_CreateThreadInternal(iscapture ? SDL_CaptureAudio : SDL_RunAudio,
+                                                  name, stacksize, device);
 
         if (device->thread == NULL) {
             SDL_CloseAudioDevice(device->id);
@@ -1278,7 +3133,10 @@ SDL_PauseAudioDevice(SDL_AudioDeviceID devid, int pause_on)
     SDL_AudioDevice *device = get_audio_device(devid);
     if (device) {
         current_audio.impl.LockDevice(device);
-        device->paused = pause_on;
+        if (device->paused != pause_on) {
+            device->paused = pause_on;
+            wake_audio_thread(device);  /* start (or stop) the callbacks now. */
+        }
         current_audio.impl.UnlockDevice(device);
     }
 }
@@ -1361,6 +3219,9 @@ SDL_AudioQuit(void)
 
     SDL_DestroyMutex(current_audio.detectionLock);
 
+    SDL_FreeResampleFilterCache();
+    SDL_FreeChannelMatrixCache();
+
     SDL_zero(current_audio);
     SDL_zero(open_devices);
 }
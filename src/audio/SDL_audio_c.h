@@ -32,6 +32,40 @@ extern void SDL_CalculateAudioSpec(SDL_AudioSpec * spec);
 /* The actual mixing thread function */
 extern int SDLCALL SDL_RunAudio(void *audiop);
 
+/* Stands in for a device's callback once it has built-in mixer voices. */
+extern void SDLCALL SDL_AudioMixerCallback(void *userdata, Uint8 *stream, int len);
+
+/* Runs a device's effect chain over a buffer, before or after conversion.
+   Returns SDL_TRUE if it metered the buffer too, which saves SDL_MeterAudio()
+   converting it to float again. */
+struct SDL_AudioDevice;
+extern SDL_bool SDL_RunAudioEffects(struct SDL_AudioDevice *device, Uint8 *stream, int len, const SDL_bool after_conversion);
+
+/* Adds a buffer in the callback's format to a device's level meter. */
+extern void SDL_MeterAudio(struct SDL_AudioDevice *device, const Uint8 *stream, int len);
+
+/* Integer to float conversion scales by these, in the autogenerated
+   converters and the hand-tuned ones alike, so they match bit for bit. */
+#define DIVBY127 0.0078740157480315f
+#define DIVBY32767 3.05185094759972e-05f
+#define DIVBY2147483647 4.6566128752458e-10f
+
+/* With x87 math (GCC with -mfpmath=387, which the SSEMATH build option
+   sets), float temporaries stay at extended precision until they're
+   stored. Code that does in one expression what SIMD code or separate
+   passes do in steps rounds each step through this, so they all match
+   bit for bit. Elsewhere it's free. */
+#if defined(__FLT_EVAL_METHOD__) && (__FLT_EVAL_METHOD__ != 0)
+static SDL_INLINE float
+SDL_RoundFloat(const float x)
+{
+    volatile float rounded = x;
+    return rounded;
+}
+#else
+#define SDL_RoundFloat(x) (x)
+#endif
+
 /* this is used internally to access some autogenerated code. */
 typedef struct
 {
@@ -41,15 +75,43 @@ typedef struct
 } SDL_AudioTypeFilters;
 extern const SDL_AudioTypeFilters sdl_audio_type_filters[];
 
-/* this is used internally to access some autogenerated code. */
+/* A channel remix: every output channel is a weighted sum of the inputs. */
+typedef struct SDL_ChannelMatrix
+{
+    int src_channels;
+    int dst_channels;
+    float *coeffs;        /* dst_channels rows of src_channels. */
+    float *columns;       /* the same transposed, each column padded to (column_len) for SIMD. */
+    int column_len;
+    struct SDL_ChannelMatrix *next;
+} SDL_ChannelMatrix;
+
+/* The matrix a remixing filter in (cvt) uses, or NULL if out of memory or
+   (cvt) wasn't built by SDL_BuildAudioCVT. */
+extern const SDL_ChannelMatrix *SDL_GetCVTChannelMatrix(const SDL_AudioCVT * cvt);
+
+/* Autogenerated converters that change the data type and remix in one pass. */
 typedef struct
 {
-    SDL_AudioFormat fmt;
-    int channels;
-    int upsample;
-    int multiple;
+    SDL_AudioFormat src_fmt;
+    int src_channels;
+    SDL_AudioFormat dst_fmt;
+    int dst_channels;
     SDL_AudioFilter filter;
-} SDL_AudioRateFilters;
-extern const SDL_AudioRateFilters sdl_audio_rate_filters[];
+} SDL_AudioFusedFilters;
+extern const SDL_AudioFusedFilters sdl_audio_fused_filters[];
+
+/* CPU features the audio converters and mixer may use. Set the
+   SDL_AUDIO_CPU_FEATURES environment variable to a mask of these to
+   override detection, for testing the fallback paths. */
+#define SDL_AUDIO_CPU_SSE2  0x00000001
+extern Uint32 SDL_GetAudioCPUFeatures(void);
+
+/* Resampling filter tables are cached for SDL_AudioCVT, which has nowhere
+   to keep them; this releases them when the audio subsystem shuts down. */
+extern void SDL_FreeResampleFilterCache(void);
+
+/* Likewise for the default channel remixing matrices. */
+extern void SDL_FreeChannelMatrixCache(void);
 
 /* vi: set ts=4 sw=4 expandtab: */
@@ -26,821 +26,223 @@
 #include "SDL_audio_c.h"
 
 #include "SDL_assert.h"
+#include "SDL_atomic.h"
+#include "SDL_cpuinfo.h"
+#include "SDL_hints.h"
+#include "SDL_log.h"
 
 /* #define DEBUG_CONVERT */
 
-/* Effectively mix right and left channels into a single channel */
-static void SDLCALL
-SDL_ConvertMono(SDL_AudioCVT * cvt, SDL_AudioFormat format)
+int
+SDL_ConvertAudio(SDL_AudioCVT * cvt)
 {
-    int i;
-    Sint32 sample;
-
-#ifdef DEBUG_CONVERT
-    fprintf(stderr, "Converting to mono\n");
-#endif
-	switch (format & (SDL_AUDIO_MASK_SIGNED |
-                      SDL_AUDIO_MASK_BITSIZE |
-                      SDL_AUDIO_MASK_DATATYPE)) {
-    case AUDIO_U8:
-        {
-            Uint8 *src, *dst;
-
-            src = cvt->buf;
-            dst = cvt->buf;
-            for (i = cvt->len_cvt / 2; i; --i) {
-                sample = src[0] + src[1];
-                *dst = (Uint8) (sample / 2);
-                src += 2;
-                dst += 1;
-            }
-        }
-        break;
-
-    case AUDIO_S8:
-        {
-            Sint8 *src, *dst;
-
-            src = (Sint8 *) cvt->buf;
-            dst = (Sint8 *) cvt->buf;
-            for (i = cvt->len_cvt / 2; i; --i) {
-                sample = src[0] + src[1];
-                *dst = (Sint8) (sample / 2);
-                src += 2;
-                dst += 1;
-            }
-        }
-        break;
-
-    case AUDIO_U16:
-        {
-            Uint8 *src, *dst;
-
-            src = cvt->buf;
-            dst = cvt->buf;
-            if (SDL_AUDIO_ISBIGENDIAN(format)) {
-                for (i = cvt->len_cvt / 4; i; --i) {
-                    sample = (Uint16) ((src[0] << 8) | src[1]) +
-                        (Uint16) ((src[2] << 8) | src[3]);
-                    sample /= 2;
-                    dst[1] = (sample & 0xFF);
-                    sample >>= 8;
-                    dst[0] = (sample & 0xFF);
-                    src += 4;
-                    dst += 2;
-                }
-            } else {
-                for (i = cvt->len_cvt / 4; i; --i) {
-                    sample = (Uint16) ((src[1] << 8) | src[0]) +
-                        (Uint16) ((src[3] << 8) | src[2]);
-                    sample /= 2;
-                    dst[0] = (sample & 0xFF);
-                    sample >>= 8;
-                    dst[1] = (sample & 0xFF);
-                    src += 4;
-                    dst += 2;
-                }
-            }
-        }
-        break;
-
-    case AUDIO_S16:
-        {
-            Uint8 *src, *dst;
-
-            src = cvt->buf;
-            dst = cvt->buf;
-            if (SDL_AUDIO_ISBIGENDIAN(format)) {
-                for (i = cvt->len_cvt / 4; i; --i) {
-                    sample = (Sint16) ((src[0] << 8) | src[1]) +
-                        (Sint16) ((src[2] << 8) | src[3]);
-                    sample /= 2;
-                    dst[1] = (sample & 0xFF);
-                    sample >>= 8;
-                    dst[0] = (sample & 0xFF);
-                    src += 4;
-                    dst += 2;
-                }
-            } else {
-                for (i = cvt->len_cvt / 4; i; --i) {
-                    sample = (Sint16) ((src[1] << 8) | src[0]) +
-                        (Sint16) ((src[3] << 8) | src[2]);
-                    sample /= 2;
-                    dst[0] = (sample & 0xFF);
-                    sample >>= 8;
-                    dst[1] = (sample & 0xFF);
-                    src += 4;
-                    dst += 2;
-                }
-            }
-        }
-        break;
-
-    case AUDIO_S32:
-        {
-            const Uint32 *src = (const Uint32 *) cvt->buf;
-            Uint32 *dst = (Uint32 *) cvt->buf;
-            if (SDL_AUDIO_ISBIGENDIAN(format)) {
-                for (i = cvt->len_cvt / 8; i; --i, src += 2) {
-                    const Sint64 added =
-                        (((Sint64) (Sint32) SDL_SwapBE32(src[0])) +
-                         ((Sint64) (Sint32) SDL_SwapBE32(src[1])));
-                    *(dst++) = SDL_SwapBE32((Uint32) ((Sint32) (added / 2)));
-                }
-            } else {
-                for (i = cvt->len_cvt / 8; i; --i, src += 2) {
-                    const Sint64 added =
-                        (((Sint64) (Sint32) SDL_SwapLE32(src[0])) +
-                         ((Sint64) (Sint32) SDL_SwapLE32(src[1])));
-                    *(dst++) = SDL_SwapLE32((Uint32) ((Sint32) (added / 2)));
-                }
-            }
-        }
-        break;
+    /* !!! FIXME: (cvt) should be const; stack-copy it here. */
+    /* !!! FIXME: (actually, we can't...len_cvt needs to be updated. Grr.) */
 
-    case AUDIO_F32:
-        {
-            const float *src = (const float *) cvt->buf;
-            float *dst = (float *) cvt->buf;
-            if (SDL_AUDIO_ISBIGENDIAN(format)) {
-                for (i = cvt->len_cvt / 8; i; --i, src += 2) {
-                    const float src1 = SDL_SwapFloatBE(src[0]);
-                    const float src2 = SDL_SwapFloatBE(src[1]);
-                    const double added = ((double) src1) + ((double) src2);
-                    const float halved = (float) (added * 0.5);
-                    *(dst++) = SDL_SwapFloatBE(halved);
-                }
-            } else {
-                for (i = cvt->len_cvt / 8; i; --i, src += 2) {
-                    const float src1 = SDL_SwapFloatLE(src[0]);
-                    const float src2 = SDL_SwapFloatLE(src[1]);
-                    const double added = ((double) src1) + ((double) src2);
-                    const float halved = (float) (added * 0.5);
-                    *(dst++) = SDL_SwapFloatLE(halved);
-                }
-            }
-        }
-        break;
+    /* Make sure there's data to convert */
+    if (cvt->buf == NULL) {
+        SDL_SetError("No buffer allocated for conversion");
+        return (-1);
     }
-
-    cvt->len_cvt /= 2;
-    if (cvt->filters[++cvt->filter_index]) {
-        cvt->filters[cvt->filter_index] (cvt, format);
+    /* Return okay if no conversion is necessary */
+    cvt->len_cvt = cvt->len;
+    if (cvt->filters[0] == NULL) {
+        return (0);
     }
+
+    /* Set up the conversion and go! */
+    cvt->filter_index = 0;
+    cvt->filters[0] (cvt, cvt->src_format);
+    return (0);
 }
 
 
-/* Discard top 4 channels */
-static void SDLCALL
-SDL_ConvertStrip(SDL_AudioCVT * cvt, SDL_AudioFormat format)
+Uint32
+SDL_GetAudioCPUFeatures(void)
 {
-    int i;
-
-#ifdef DEBUG_CONVERT
-    fprintf(stderr, "Converting down from 6 channels to stereo\n");
-#endif
+    static Uint32 features = 0xffffffff;
 
-#define strip_chans_6_to_2(type) \
-    { \
-        const type *src = (const type *) cvt->buf; \
-        type *dst = (type *) cvt->buf; \
-        for (i = cvt->len_cvt / (sizeof (type) * 6); i; --i) { \
-            dst[0] = src[0]; \
-            dst[1] = src[1]; \
-            src += 6; \
-            dst += 2; \
-        } \
-    }
-
-    /* this function only cares about typesize, and data as a block of bits. */
-    switch (SDL_AUDIO_BITSIZE(format)) {
-    case 8:
-        strip_chans_6_to_2(Uint8);
-        break;
-    case 16:
-        strip_chans_6_to_2(Uint16);
-        break;
-    case 32:
-        strip_chans_6_to_2(Uint32);
-        break;
-    }
+    if (features == 0xffffffff) {
+        const char *override = SDL_getenv("SDL_AUDIO_CPU_FEATURES");
 
-#undef strip_chans_6_to_2
+        features = 0;
 
-    cvt->len_cvt /= 3;
-    if (cvt->filters[++cvt->filter_index]) {
-        cvt->filters[cvt->filter_index] (cvt, format);
+        /* Allow an override for testing .. */
+        if (override) {
+            SDL_sscanf(override, "%u", &features);
+        } else {
+            if (SDL_HasSSE2()) {
+                features |= SDL_AUDIO_CPU_SSE2;
+            }
+        }
     }
+    return features;
 }
 
 
-/* Discard top 2 channels of 6 */
+/*
+ * Hand-tuned versions of the most common autogenerated type converters.
+ *  These must produce exactly the same bits as the generated code, so they
+ *  do the same arithmetic in the same precision, just several samples at
+ *  a time. (Sint16) casts keep the low 16 bits, so we do that instead of
+ *  saturating when packing down.
+ */
+#ifdef __SSE2__
 static void SDLCALL
-SDL_ConvertStrip_2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
+SDL_Convert_S16LSB_to_F32LSB_SSE2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 {
-    int i;
+    const Sint16 *src = (const Sint16 *) cvt->buf;
+    float *dst = (float *) cvt->buf;
+    const __m128 divby32767 = _mm_set1_ps(DIVBY32767);
+    int i = cvt->len_cvt / sizeof (Sint16);
 
 #ifdef DEBUG_CONVERT
-    fprintf(stderr, "Converting 6 down to quad\n");
+    fprintf(stderr, "Converting AUDIO_S16LSB to AUDIO_F32LSB (using SSE2).\n");
 #endif
 
-#define strip_chans_6_to_4(type) \
-    { \
-        const type *src = (const type *) cvt->buf; \
-        type *dst = (type *) cvt->buf; \
-        for (i = cvt->len_cvt / (sizeof (type) * 6); i; --i) { \
-            dst[0] = src[0]; \
-            dst[1] = src[1]; \
-            dst[2] = src[2]; \
-            dst[3] = src[3]; \
-            src += 6; \
-            dst += 4; \
-        } \
-    }
-
-    /* this function only cares about typesize, and data as a block of bits. */
-    switch (SDL_AUDIO_BITSIZE(format)) {
-    case 8:
-        strip_chans_6_to_4(Uint8);
-        break;
-    case 16:
-        strip_chans_6_to_4(Uint16);
-        break;
-    case 32:
-        strip_chans_6_to_4(Uint32);
-        break;
+    /* This grows the data in place, so work back from the end. */
+    while (i & 7) {
+        --i;
+        dst[i] = ((float) src[i]) * DIVBY32767;
     }
 
-#undef strip_chans_6_to_4
+    while (i) {
+        __m128i ints;
+        i -= 8;
+        ints = _mm_loadu_si128((const __m128i *) (src + i));
+        /* sign-extend to 32 bits: each sample to the top half, then shift down. */
+        _mm_storeu_ps(dst + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(ints, ints), 16)), divby32767));
+        _mm_storeu_ps(dst + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(ints, ints), 16)), divby32767));
+    }
 
-    cvt->len_cvt /= 6;
-    cvt->len_cvt *= 4;
+    cvt->len_cvt *= 2;
     if (cvt->filters[++cvt->filter_index]) {
-        cvt->filters[cvt->filter_index] (cvt, format);
+        cvt->filters[cvt->filter_index] (cvt, AUDIO_F32LSB);
     }
 }
 
-/* Duplicate a mono channel to both stereo channels */
 static void SDLCALL
-SDL_ConvertStereo(SDL_AudioCVT * cvt, SDL_AudioFormat format)
+SDL_Convert_F32LSB_to_S16LSB_SSE2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 {
+    const float *src = (const float *) cvt->buf;
+    Sint16 *dst = (Sint16 *) cvt->buf;
+    const __m128 mult = _mm_set1_ps(32767.0f);
+    const int samples = cvt->len_cvt / sizeof (float);
     int i;
 
 #ifdef DEBUG_CONVERT
-    fprintf(stderr, "Converting to stereo\n");
+    fprintf(stderr, "Converting AUDIO_F32LSB to AUDIO_S16LSB (using SSE2).\n");
 #endif
 
-#define dup_chans_1_to_2(type) \
-    { \
-        const type *src = (const type *) (cvt->buf + cvt->len_cvt); \
-        type *dst = (type *) (cvt->buf + cvt->len_cvt * 2); \
-        for (i = cvt->len_cvt / sizeof(type); i; --i) { \
-            src -= 1; \
-            dst -= 2; \
-            dst[0] = dst[1] = *src; \
-        } \
-    }
-
-    /* this function only cares about typesize, and data as a block of bits. */
-    switch (SDL_AUDIO_BITSIZE(format)) {
-    case 8:
-        dup_chans_1_to_2(Uint8);
-        break;
-    case 16:
-        dup_chans_1_to_2(Uint16);
-        break;
-    case 32:
-        dup_chans_1_to_2(Uint32);
-        break;
+    for (i = 0; (i + 8) <= samples; i += 8) {
+        __m128i lo = _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(src + i), mult));
+        __m128i hi = _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(src + i + 4), mult));
+        lo = _mm_srai_epi32(_mm_slli_epi32(lo, 16), 16);
+        hi = _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16);
+        _mm_storeu_si128((__m128i *) (dst + i), _mm_packs_epi32(lo, hi));
     }
 
-#undef dup_chans_1_to_2
+    for (; i < samples; i++) {
+        dst[i] = (Sint16) (src[i] * 32767.0f);
+    }
 
-    cvt->len_cvt *= 2;
+    cvt->len_cvt /= 2;
     if (cvt->filters[++cvt->filter_index]) {
-        cvt->filters[cvt->filter_index] (cvt, format);
+        cvt->filters[cvt->filter_index] (cvt, AUDIO_S16LSB);
     }
 }
 
-
-/* Duplicate a stereo channel to a pseudo-5.1 stream */
 static void SDLCALL
-SDL_ConvertSurround(SDL_AudioCVT * cvt, SDL_AudioFormat format)
+SDL_Convert_S32LSB_to_F32LSB_SSE2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 {
+    const Sint32 *src = (const Sint32 *) cvt->buf;
+    float *dst = (float *) cvt->buf;
+    const __m128 divby2147483647 = _mm_set1_ps(DIVBY2147483647);
+    const int samples = cvt->len_cvt / sizeof (Sint32);
     int i;
 
 #ifdef DEBUG_CONVERT
-    fprintf(stderr, "Converting stereo to surround\n");
+    fprintf(stderr, "Converting AUDIO_S32LSB to AUDIO_F32LSB (using SSE2).\n");
 #endif
 
-    switch (format & (SDL_AUDIO_MASK_SIGNED  |
-                      SDL_AUDIO_MASK_BITSIZE |
-                      SDL_AUDIO_MASK_DATATYPE)) {
-    case AUDIO_U8:
-        {
-            Uint8 *src, *dst, lf, rf, ce;
-
-            src = (Uint8 *) (cvt->buf + cvt->len_cvt);
-            dst = (Uint8 *) (cvt->buf + cvt->len_cvt * 3);
-            for (i = cvt->len_cvt; i; --i) {
-                dst -= 6;
-                src -= 2;
-                lf = src[0];
-                rf = src[1];
-                ce = (lf / 2) + (rf / 2);
-                dst[0] = lf;
-                dst[1] = rf;
-                dst[2] = lf - ce;
-                dst[3] = rf - ce;
-                dst[4] = ce;
-                dst[5] = ce;
-            }
-        }
-        break;
-
-    case AUDIO_S8:
-        {
-            Sint8 *src, *dst, lf, rf, ce;
-
-            src = (Sint8 *) cvt->buf + cvt->len_cvt;
-            dst = (Sint8 *) cvt->buf + cvt->len_cvt * 3;
-            for (i = cvt->len_cvt; i; --i) {
-                dst -= 6;
-                src -= 2;
-                lf = src[0];
-                rf = src[1];
-                ce = (lf / 2) + (rf / 2);
-                dst[0] = lf;
-                dst[1] = rf;
-                dst[2] = lf - ce;
-                dst[3] = rf - ce;
-                dst[4] = ce;
-                dst[5] = ce;
-            }
-        }
-        break;
-
-    case AUDIO_U16:
-        {
-            Uint8 *src, *dst;
-            Uint16 lf, rf, ce, lr, rr;
-
-            src = cvt->buf + cvt->len_cvt;
-            dst = cvt->buf + cvt->len_cvt * 3;
-
-            if (SDL_AUDIO_ISBIGENDIAN(format)) {
-                for (i = cvt->len_cvt / 4; i; --i) {
-                    dst -= 12;
-                    src -= 4;
-                    lf = (Uint16) ((src[0] << 8) | src[1]);
-                    rf = (Uint16) ((src[2] << 8) | src[3]);
-                    ce = (lf / 2) + (rf / 2);
-                    rr = lf - ce;
-                    lr = rf - ce;
-                    dst[1] = (lf & 0xFF);
-                    dst[0] = ((lf >> 8) & 0xFF);
-                    dst[3] = (rf & 0xFF);
-                    dst[2] = ((rf >> 8) & 0xFF);
-
-                    dst[1 + 4] = (lr & 0xFF);
-                    dst[0 + 4] = ((lr >> 8) & 0xFF);
-                    dst[3 + 4] = (rr & 0xFF);
-                    dst[2 + 4] = ((rr >> 8) & 0xFF);
-
-                    dst[1 + 8] = (ce & 0xFF);
-                    dst[0 + 8] = ((ce >> 8) & 0xFF);
-                    dst[3 + 8] = (ce & 0xFF);
-                    dst[2 + 8] = ((ce >> 8) & 0xFF);
-                }
-            } else {
-                for (i = cvt->len_cvt / 4; i; --i) {
-                    dst -= 12;
-                    src -= 4;
-                    lf = (Uint16) ((src[1] << 8) | src[0]);
-                    rf = (Uint16) ((src[3] << 8) | src[2]);
-                    ce = (lf / 2) + (rf / 2);
-                    rr = lf - ce;
-                    lr = rf - ce;
-                    dst[0] = (lf & 0xFF);
-                    dst[1] = ((lf >> 8) & 0xFF);
-                    dst[2] = (rf & 0xFF);
-                    dst[3] = ((rf >> 8) & 0xFF);
-
-                    dst[0 + 4] = (lr & 0xFF);
-                    dst[1 + 4] = ((lr >> 8) & 0xFF);
-                    dst[2 + 4] = (rr & 0xFF);
-                    dst[3 + 4] = ((rr >> 8) & 0xFF);
-
-                    dst[0 + 8] = (ce & 0xFF);
-                    dst[1 + 8] = ((ce >> 8) & 0xFF);
-                    dst[2 + 8] = (ce & 0xFF);
-                    dst[3 + 8] = ((ce >> 8) & 0xFF);
-                }
-            }
-        }
-        break;
-
-    case AUDIO_S16:
-        {
-            Uint8 *src, *dst;
-            Sint16 lf, rf, ce, lr, rr;
-
-            src = cvt->buf + cvt->len_cvt;
-            dst = cvt->buf + cvt->len_cvt * 3;
-
-            if (SDL_AUDIO_ISBIGENDIAN(format)) {
-                for (i = cvt->len_cvt / 4; i; --i) {
-                    dst -= 12;
-                    src -= 4;
-                    lf = (Sint16) ((src[0] << 8) | src[1]);
-                    rf = (Sint16) ((src[2] << 8) | src[3]);
-                    ce = (lf / 2) + (rf / 2);
-                    rr = lf - ce;
-                    lr = rf - ce;
-                    dst[1] = (lf & 0xFF);
-                    dst[0] = ((lf >> 8) & 0xFF);
-                    dst[3] = (rf & 0xFF);
-                    dst[2] = ((rf >> 8) & 0xFF);
-
-                    dst[1 + 4] = (lr & 0xFF);
-                    dst[0 + 4] = ((lr >> 8) & 0xFF);
-                    dst[3 + 4] = (rr & 0xFF);
-                    dst[2 + 4] = ((rr >> 8) & 0xFF);
-
-                    dst[1 + 8] = (ce & 0xFF);
-                    dst[0 + 8] = ((ce >> 8) & 0xFF);
-                    dst[3 + 8] = (ce & 0xFF);
-                    dst[2 + 8] = ((ce >> 8) & 0xFF);
-                }
-            } else {
-                for (i = cvt->len_cvt / 4; i; --i) {
-                    dst -= 12;
-                    src -= 4;
-                    lf = (Sint16) ((src[1] << 8) | src[0]);
-                    rf = (Sint16) ((src[3] << 8) | src[2]);
-                    ce = (lf / 2) + (rf / 2);
-                    rr = lf - ce;
-                    lr = rf - ce;
-                    dst[0] = (lf & 0xFF);
-                    dst[1] = ((lf >> 8) & 0xFF);
-                    dst[2] = (rf & 0xFF);
-                    dst[3] = ((rf >> 8) & 0xFF);
-
-                    dst[0 + 4] = (lr & 0xFF);
-                    dst[1 + 4] = ((lr >> 8) & 0xFF);
-                    dst[2 + 4] = (rr & 0xFF);
-                    dst[3 + 4] = ((rr >> 8) & 0xFF);
-
-                    dst[0 + 8] = (ce & 0xFF);
-                    dst[1 + 8] = ((ce >> 8) & 0xFF);
-                    dst[2 + 8] = (ce & 0xFF);
-                    dst[3 + 8] = ((ce >> 8) & 0xFF);
-                }
-            }
-        }
-        break;
-
-    case AUDIO_S32:
-        {
-            Sint32 lf, rf, ce;
-            const Uint32 *src = (const Uint32 *) (cvt->buf + cvt->len_cvt);
-            Uint32 *dst = (Uint32 *) (cvt->buf + cvt->len_cvt * 3);
-
-            if (SDL_AUDIO_ISBIGENDIAN(format)) {
-                for (i = cvt->len_cvt / 8; i; --i) {
-                    dst -= 6;
-                    src -= 2;
-                    lf = (Sint32) SDL_SwapBE32(src[0]);
-                    rf = (Sint32) SDL_SwapBE32(src[1]);
-                    ce = (lf / 2) + (rf / 2);
-                    dst[0] = SDL_SwapBE32((Uint32) lf);
-                    dst[1] = SDL_SwapBE32((Uint32) rf);
-                    dst[2] = SDL_SwapBE32((Uint32) (lf - ce));
-                    dst[3] = SDL_SwapBE32((Uint32) (rf - ce));
-                    dst[4] = SDL_SwapBE32((Uint32) ce);
-                    dst[5] = SDL_SwapBE32((Uint32) ce);
-                }
-            } else {
-                for (i = cvt->len_cvt / 8; i; --i) {
-                    dst -= 6;
-                    src -= 2;
-                    lf = (Sint32) SDL_SwapLE32(src[0]);
-                    rf = (Sint32) SDL_SwapLE32(src[1]);
-                    ce = (lf / 2) + (rf / 2);
-                    dst[0] = src[0];
-                    dst[1] = src[1];
-                    dst[2] = SDL_SwapLE32((Uint32) (lf - ce));
-                    dst[3] = SDL_SwapLE32((Uint32) (rf - ce));
-                    dst[4] = SDL_SwapLE32((Uint32) ce);
-                    dst[5] = SDL_SwapLE32((Uint32) ce);
-                }
-            }
-        }
-        break;
-
-    case AUDIO_F32:
-        {
-            float lf, rf, ce;
-            const float *src = (const float *) (cvt->buf + cvt->len_cvt);
-            float *dst = (float *) (cvt->buf + cvt->len_cvt * 3);
-
-            if (SDL_AUDIO_ISBIGENDIAN(format)) {
-                for (i = cvt->len_cvt / 8; i; --i) {
-                    dst -= 6;
-                    src -= 2;
-                    lf = SDL_SwapFloatBE(src[0]);
-                    rf = SDL_SwapFloatBE(src[1]);
-                    ce = (lf * 0.5f) + (rf * 0.5f);
-                    dst[0] = src[0];
-                    dst[1] = src[1];
-                    dst[2] = SDL_SwapFloatBE(lf - ce);
-                    dst[3] = SDL_SwapFloatBE(rf - ce);
-                    dst[4] = dst[5] = SDL_SwapFloatBE(ce);
-                }
-            } else {
-                for (i = cvt->len_cvt / 8; i; --i) {
-                    dst -= 6;
-                    src -= 2;
-                    lf = SDL_SwapFloatLE(src[0]);
-                    rf = SDL_SwapFloatLE(src[1]);
-                    ce = (lf * 0.5f) + (rf * 0.5f);
-                    dst[0] = src[0];
-                    dst[1] = src[1];
-                    dst[2] = SDL_SwapFloatLE(lf - ce);
-                    dst[3] = SDL_SwapFloatLE(rf - ce);
-                    dst[4] = dst[5] = SDL_SwapFloatLE(ce);
-                }
-            }
-        }
-        break;
+    for (i = 0; (i + 4) <= samples; i += 4) {
+        const __m128i ints = _mm_loadu_si128((const __m128i *) (src + i));
+        _mm_storeu_ps(dst + i, _mm_mul_ps(_mm_cvtepi32_ps(ints), divby2147483647));
+    }
 
+    for (; i < samples; i++) {
+        dst[i] = ((float) src[i]) * DIVBY2147483647;
     }
-    cvt->len_cvt *= 3;
+
     if (cvt->filters[++cvt->filter_index]) {
-        cvt->filters[cvt->filter_index] (cvt, format);
+        cvt->filters[cvt->filter_index] (cvt, AUDIO_F32LSB);
     }
 }
 
-
-/* Duplicate a stereo channel to a pseudo-4.0 stream */
 static void SDLCALL
-SDL_ConvertSurround_4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
+SDL_Convert_F32LSB_to_S32LSB_SSE2(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 {
+    const float *src = (const float *) cvt->buf;
+    Sint32 *dst = (Sint32 *) cvt->buf;
+    const __m128d mult = _mm_set1_pd(2147483647.0);
+    const int samples = cvt->len_cvt / sizeof (float);
     int i;
 
 #ifdef DEBUG_CONVERT
-    fprintf(stderr, "Converting stereo to quad\n");
+    fprintf(stderr, "Converting AUDIO_F32LSB to AUDIO_S32LSB (using SSE2).\n");
 #endif
 
-    switch (format & (SDL_AUDIO_MASK_SIGNED |
-                      SDL_AUDIO_MASK_BITSIZE |
-                      SDL_AUDIO_MASK_DATATYPE)) {
-    case AUDIO_U8:
-        {
-            Uint8 *src, *dst, lf, rf, ce;
-
-            src = (Uint8 *) (cvt->buf + cvt->len_cvt);
-            dst = (Uint8 *) (cvt->buf + cvt->len_cvt * 2);
-            for (i = cvt->len_cvt; i; --i) {
-                dst -= 4;
-                src -= 2;
-                lf = src[0];
-                rf = src[1];
-                ce = (lf / 2) + (rf / 2);
-                dst[0] = lf;
-                dst[1] = rf;
-                dst[2] = lf - ce;
-                dst[3] = rf - ce;
-            }
-        }
-        break;
-
-    case AUDIO_S8:
-        {
-            Sint8 *src, *dst, lf, rf, ce;
-
-            src = (Sint8 *) cvt->buf + cvt->len_cvt;
-            dst = (Sint8 *) cvt->buf + cvt->len_cvt * 2;
-            for (i = cvt->len_cvt; i; --i) {
-                dst -= 4;
-                src -= 2;
-                lf = src[0];
-                rf = src[1];
-                ce = (lf / 2) + (rf / 2);
-                dst[0] = lf;
-                dst[1] = rf;
-                dst[2] = lf - ce;
-                dst[3] = rf - ce;
-            }
-        }
-        break;
-
-    case AUDIO_U16:
-        {
-            Uint8 *src, *dst;
-            Uint16 lf, rf, ce, lr, rr;
-
-            src = cvt->buf + cvt->len_cvt;
-            dst = cvt->buf + cvt->len_cvt * 2;
-
-            if (SDL_AUDIO_ISBIGENDIAN(format)) {
-                for (i = cvt->len_cvt / 4; i; --i) {
-                    dst -= 8;
-                    src -= 4;
-                    lf = (Uint16) ((src[0] << 8) | src[1]);
-                    rf = (Uint16) ((src[2] << 8) | src[3]);
-                    ce = (lf / 2) + (rf / 2);
-                    rr = lf - ce;
-                    lr = rf - ce;
-                    dst[1] = (lf & 0xFF);
-                    dst[0] = ((lf >> 8) & 0xFF);
-                    dst[3] = (rf & 0xFF);
-                    dst[2] = ((rf >> 8) & 0xFF);
-
-                    dst[1 + 4] = (lr & 0xFF);
-                    dst[0 + 4] = ((lr >> 8) & 0xFF);
-                    dst[3 + 4] = (rr & 0xFF);
-                    dst[2 + 4] = ((rr >> 8) & 0xFF);
-                }
-            } else {
-                for (i = cvt->len_cvt / 4; i; --i) {
-                    dst -= 8;
-                    src -= 4;
-                    lf = (Uint16) ((src[1] << 8) | src[0]);
-                    rf = (Uint16) ((src[3] << 8) | src[2]);
-                    ce = (lf / 2) + (rf / 2);
-                    rr = lf - ce;
-                    lr = rf - ce;
-                    dst[0] = (lf & 0xFF);
-                    dst[1] = ((lf >> 8) & 0xFF);
-                    dst[2] = (rf & 0xFF);
-                    dst[3] = ((rf >> 8) & 0xFF);
-
-                    dst[0 + 4] = (lr & 0xFF);
-                    dst[1 + 4] = ((lr >> 8) & 0xFF);
-                    dst[2 + 4] = (rr & 0xFF);
-                    dst[3 + 4] = ((rr >> 8) & 0xFF);
-                }
-            }
-        }
-        break;
-
-    case AUDIO_S16:
-        {
-            Uint8 *src, *dst;
-            Sint16 lf, rf, ce, lr, rr;
-
-            src = cvt->buf + cvt->len_cvt;
-            dst = cvt->buf + cvt->len_cvt * 2;
-
-            if (SDL_AUDIO_ISBIGENDIAN(format)) {
-                for (i = cvt->len_cvt / 4; i; --i) {
-                    dst -= 8;
-                    src -= 4;
-                    lf = (Sint16) ((src[0] << 8) | src[1]);
-                    rf = (Sint16) ((src[2] << 8) | src[3]);
-                    ce = (lf / 2) + (rf / 2);
-                    rr = lf - ce;
-                    lr = rf - ce;
-                    dst[1] = (lf & 0xFF);
-                    dst[0] = ((lf >> 8) & 0xFF);
-                    dst[3] = (rf & 0xFF);
-                    dst[2] = ((rf >> 8) & 0xFF);
-
-                    dst[1 + 4] = (lr & 0xFF);
-                    dst[0 + 4] = ((lr >> 8) & 0xFF);
-                    dst[3 + 4] = (rr & 0xFF);
-                    dst[2 + 4] = ((rr >> 8) & 0xFF);
-                }
-            } else {
-                for (i = cvt->len_cvt / 4; i; --i) {
-                    dst -= 8;
-                    src -= 4;
-                    lf = (Sint16) ((src[1] << 8) | src[0]);
-                    rf = (Sint16) ((src[3] << 8) | src[2]);
-                    ce = (lf / 2) + (rf / 2);
-                    rr = lf - ce;
-                    lr = rf - ce;
-                    dst[0] = (lf & 0xFF);
-                    dst[1] = ((lf >> 8) & 0xFF);
-                    dst[2] = (rf & 0xFF);
-                    dst[3] = ((rf >> 8) & 0xFF);
-
-                    dst[0 + 4] = (lr & 0xFF);
-                    dst[1 + 4] = ((lr >> 8) & 0xFF);
-                    dst[2 + 4] = (rr & 0xFF);
-                    dst[3 + 4] = ((rr >> 8) & 0xFF);
-                }
-            }
-        }
-        break;
-
-    case AUDIO_S32:
-        {
-            const Uint32 *src = (const Uint32 *) (cvt->buf + cvt->len_cvt);
-            Uint32 *dst = (Uint32 *) (cvt->buf + cvt->len_cvt * 2);
-            Sint32 lf, rf, ce;
-
-            if (SDL_AUDIO_ISBIGENDIAN(format)) {
-                for (i = cvt->len_cvt / 8; i; --i) {
-                    dst -= 4;
-                    src -= 2;
-                    lf = (Sint32) SDL_SwapBE32(src[0]);
-                    rf = (Sint32) SDL_SwapBE32(src[1]);
-                    ce = (lf / 2) + (rf / 2);
-                    dst[0] = src[0];
-                    dst[1] = src[1];
-                    dst[2] = SDL_SwapBE32((Uint32) (lf - ce));
-                    dst[3] = SDL_SwapBE32((Uint32) (rf - ce));
-                }
-            } else {
-                for (i = cvt->len_cvt / 8; i; --i) {
-                    dst -= 4;
-                    src -= 2;
-                    lf = (Sint32) SDL_SwapLE32(src[0]);
-                    rf = (Sint32) SDL_SwapLE32(src[1]);
-                    ce = (lf / 2) + (rf / 2);
-                    dst[0] = src[0];
-                    dst[1] = src[1];
-                    dst[2] = SDL_SwapLE32((Uint32) (lf - ce));
-                    dst[3] = SDL_SwapLE32((Uint32) (rf - ce));
-                }
-            }
-        }
-        break;
+    /* the scalar code multiplies in double precision, so we do too. */
+    for (i = 0; (i + 4) <= samples; i += 4) {
+        const __m128 floats = _mm_loadu_ps(src + i);
+        const __m128i lo = _mm_cvttpd_epi32(_mm_mul_pd(_mm_cvtps_pd(floats), mult));
+        const __m128i hi = _mm_cvttpd_epi32(_mm_mul_pd(_mm_cvtps_pd(_mm_movehl_ps(floats, floats)), mult));
+        _mm_storeu_si128((__m128i *) (dst + i), _mm_unpacklo_epi64(lo, hi));
+    }
 
-    case AUDIO_F32:
-        {
-            const float *src = (const float *) (cvt->buf + cvt->len_cvt);
-            float *dst = (float *) (cvt->buf + cvt->len_cvt * 2);
-            float lf, rf, ce;
-
-            if (SDL_AUDIO_ISBIGENDIAN(format)) {
-                for (i = cvt->len_cvt / 8; i; --i) {
-                    dst -= 4;
-                    src -= 2;
-                    lf = SDL_SwapFloatBE(src[0]);
-                    rf = SDL_SwapFloatBE(src[1]);
-                    ce = (lf / 2) + (rf / 2);
-                    dst[0] = src[0];
-                    dst[1] = src[1];
-                    dst[2] = SDL_SwapFloatBE(lf - ce);
-                    dst[3] = SDL_SwapFloatBE(rf - ce);
-                }
-            } else {
-                for (i = cvt->len_cvt / 8; i; --i) {
-                    dst -= 4;
-                    src -= 2;
-                    lf = SDL_SwapFloatLE(src[0]);
-                    rf = SDL_SwapFloatLE(src[1]);
-                    ce = (lf / 2) + (rf / 2);
-                    dst[0] = src[0];
-                    dst[1] = src[1];
-                    dst[2] = SDL_SwapFloatLE(lf - ce);
-                    dst[3] = SDL_SwapFloatLE(rf - ce);
-                }
-            }
-        }
-        break;
+    for (; i < samples; i++) {
+        dst[i] = (Sint32) (src[i] * 2147483647.0);
     }
-    cvt->len_cvt *= 2;
+
     if (cvt->filters[++cvt->filter_index]) {
-        cvt->filters[cvt->filter_index] (cvt, format);
+        cvt->filters[cvt->filter_index] (cvt, AUDIO_S32LSB);
     }
 }
+#endif
 
-
-int
-SDL_ConvertAudio(SDL_AudioCVT * cvt)
+static const struct
 {
-    /* !!! FIXME: (cvt) should be const; stack-copy it here. */
-    /* !!! FIXME: (actually, we can't...len_cvt needs to be updated. Grr.) */
-
-    /* Make sure there's data to convert */
-    if (cvt->buf == NULL) {
-        SDL_SetError("No buffer allocated for conversion");
-        return (-1);
-    }
-    /* Return okay if no conversion is necessary */
-    cvt->len_cvt = cvt->len;
-    if (cvt->filters[0] == NULL) {
-        return (0);
-    }
-
-    /* Set up the conversion and go! */
-    cvt->filter_index = 0;
-    cvt->filters[0] (cvt, cvt->src_format);
-    return (0);
-}
-
+    SDL_AudioFormat src_fmt;
+    SDL_AudioFormat dst_fmt;
+    Uint32 cpu_features;    /* SDL_AUDIO_CPU_* bits this needs. */
+    SDL_AudioFilter filter;
+} hand_tuned_type_filters[] = {
+#ifdef __SSE2__
+    { AUDIO_S16LSB, AUDIO_F32LSB, SDL_AUDIO_CPU_SSE2, SDL_Convert_S16LSB_to_F32LSB_SSE2 },
+    { AUDIO_F32LSB, AUDIO_S16LSB, SDL_AUDIO_CPU_SSE2, SDL_Convert_F32LSB_to_S16LSB_SSE2 },
+    { AUDIO_S32LSB, AUDIO_F32LSB, SDL_AUDIO_CPU_SSE2, SDL_Convert_S32LSB_to_F32LSB_SSE2 },
+    { AUDIO_F32LSB, AUDIO_S32LSB, SDL_AUDIO_CPU_SSE2, SDL_Convert_F32LSB_to_S32LSB_SSE2 },
+#endif
+    { 0, 0, 0, NULL }
+};
 
 static SDL_AudioFilter
 SDL_HandTunedTypeCVT(SDL_AudioFormat src_fmt, SDL_AudioFormat dst_fmt)
 {
     /*
      * Fill in any future conversions that are specialized to a
-     *  processor, platform, compiler, or library here.
+     *  processor, platform, compiler, or library in the table above.
      */
+    const Uint32 features = SDL_GetAudioCPUFeatures();
+    int i;
+
+    for (i = 0; hand_tuned_type_filters[i].filter != NULL; i++) {
+        if ((hand_tuned_type_filters[i].src_fmt == src_fmt) &&
+            (hand_tuned_type_filters[i].dst_fmt == dst_fmt) &&
+            ((hand_tuned_type_filters[i].cpu_features & features) == hand_tuned_type_filters[i].cpu_features)) {
+            return hand_tuned_type_filters[i].filter;
+        }
+    }
 
     return NULL;                /* no specialized converter code available. */
 }
@@ -852,6 +254,27 @@ SDL_HandTunedTypeCVT(SDL_AudioFormat src_fmt, SDL_AudioFormat dst_fmt)
  *  autogenerated function that is customized to convert between two
  *  specific data types.
  */
+/* The fastest filter converting (src_fmt) to (dst_fmt), or NULL. */
+static SDL_AudioFilter
+SDL_FindAudioTypeFilter(SDL_AudioFormat src_fmt, SDL_AudioFormat dst_fmt)
+{
+    SDL_AudioFilter filter = SDL_HandTunedTypeCVT(src_fmt, dst_fmt);
+
+    /* No hand-tuned converter? Try the autogenerated ones. */
+    if (filter == NULL) {
+        int i;
+        for (i = 0; sdl_audio_type_filters[i].filter != NULL; i++) {
+            const SDL_AudioTypeFilters *filt = &sdl_audio_type_filters[i];
+            if ((filt->src_fmt == src_fmt) && (filt->dst_fmt == dst_fmt)) {
+                filter = filt->filter;
+                break;
+            }
+        }
+    }
+
+    return filter;
+}
+
 static int
 SDL_BuildAudioTypeCVT(SDL_AudioCVT * cvt,
                       SDL_AudioFormat src_fmt, SDL_AudioFormat dst_fmt)
@@ -859,23 +282,11 @@ SDL_BuildAudioTypeCVT(SDL_AudioCVT * cvt,
     if (src_fmt != dst_fmt) {
         const Uint16 src_bitsize = SDL_AUDIO_BITSIZE(src_fmt);
         const Uint16 dst_bitsize = SDL_AUDIO_BITSIZE(dst_fmt);
-        SDL_AudioFilter filter = SDL_HandTunedTypeCVT(src_fmt, dst_fmt);
+        const SDL_AudioFilter filter = SDL_FindAudioTypeFilter(src_fmt, dst_fmt);
 
-        /* No hand-tuned converter? Try the autogenerated ones. */
         if (filter == NULL) {
-            int i;
-            for (i = 0; sdl_audio_type_filters[i].filter != NULL; i++) {
-                const SDL_AudioTypeFilters *filt = &sdl_audio_type_filters[i];
-                if ((filt->src_fmt == src_fmt) && (filt->dst_fmt == dst_fmt)) {
-                    filter = filt->filter;
-                    break;
-                }
-            }
-
-            if (filter == NULL) {
-                SDL_SetError("No conversion available for these formats");
-                return -1;
-            }
+            SDL_SetError("No conversion available for these formats");
+            return -1;
         }
 
         /* Update (cvt) with filter details... */
@@ -895,117 +306,1387 @@ SDL_BuildAudioTypeCVT(SDL_AudioCVT * cvt,
 }
 
 
-static SDL_AudioFilter
-SDL_HandTunedResampleCVT(SDL_AudioCVT * cvt, int dst_channels,
-                         int src_rate, int dst_rate)
+/*
+ * Sample rate conversion.
+ *
+ * All resampling is done on float data with a Kaiser-windowed sinc filter.
+ *  Output frame k sits at input position k * src_rate / dst_rate; with the
+ *  rates reduced to lowest terms, we track that position exactly in units
+ *  of 1/dst_rate input frames, so nothing drifts however the data arrives.
+ *  The fractional part of the position picks a row of precomputed filter
+ *  taps. If the reduced dst_rate is small (like 160 for 44100->48000) there
+ *  is a row for every position that can occur; otherwise we keep a finer
+ *  table and interpolate between its two nearest rows.
+ */
+
+typedef enum
 {
-    /*
-     * Fill in any future conversions that are specialized to a
-     *  processor, platform, compiler, or library here.
-     */
+    SDL_RESAMPLING_LOW,
+    SDL_RESAMPLING_MEDIUM,
+    SDL_RESAMPLING_HIGH
+} SDL_ResamplingQuality;
 
-    return NULL;                /* no specialized converter code available. */
+typedef struct
+{
+    int zero_crossings;     /* sinc lobes on each side of the center. */
+    double beta;            /* Kaiser window shape. */
+    double rolloff;         /* passband edge, as a fraction of the lower Nyquist. */
+    int max_exact_phases;   /* biggest reduced dst_rate we build every row for. */
+    int table_phases;       /* rows in the interpolated table otherwise. */
+} SDL_ResamplerQualityParams;
+
+static const SDL_ResamplerQualityParams resampler_quality_params[] = {
+    { 4, 5.0, 0.85, 256, 64 },      /* SDL_RESAMPLING_LOW */
+    { 8, 7.0, 0.90, 512, 128 },     /* SDL_RESAMPLING_MEDIUM */
+    { 24, 9.0, 0.95, 512, 512 }     /* SDL_RESAMPLING_HIGH */
+};
+
+/* Downsampling widens the filter in proportion to the ratio; past this we
+   shorten it instead, which only matters for extreme ratios. */
+#define SDL_RESAMPLER_MAX_TAPS 256
+
+/* When SDL_AudioCVT's resampler converts the data type too, it converts
+   this much input and output at a time, so each stays in the cache. */
+#define SDL_RESAMPLER_WINDOW_FLOATS 2048
+#define SDL_RESAMPLER_BLOCK_FLOATS 1024
+
+/* The highest rate we resample, which keeps the position math well inside
+   64 bits however much data comes through at once. */
+#define SDL_RESAMPLER_MAX_RATE 0xFFFFFF
+
+/* Compute one output frame from (taps) input frames at (src). */
+typedef void (*SDL_ResampleFrameFunc)(const float *src, const float *coeffs, const int taps, const int chans, float *dst);
+
+typedef struct SDL_ResampleFilter
+{
+    int src_rate;           /* as requested, for the cache. */
+    int dst_rate;
+    SDL_ResamplingQuality quality;
+    Sint64 increment;       /* reduced src_rate: position step per output frame. */
+    Sint64 frame_phases;    /* reduced dst_rate: position units per input frame. */
+    int half_taps;          /* filter reach on each side of the center frame. */
+    int taps;               /* filter length, padded to a multiple of 4. */
+    int table_phases;       /* nonzero if we interpolate between table rows. */
+    float *table;
+    SDL_ResampleFrameFunc resample_frame;
+    struct SDL_ResampleFilter *next;
+} SDL_ResampleFilter;
+
+static SDL_ResamplingQuality
+SDL_GetResamplingQuality(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_AUDIO_RESAMPLING_MODE);
+    if (hint) {
+        if ((SDL_strcmp(hint, "0") == 0) || (SDL_strcasecmp(hint, "low") == 0)) {
+            return SDL_RESAMPLING_LOW;
+        } else if ((SDL_strcmp(hint, "2") == 0) || (SDL_strcasecmp(hint, "high") == 0)) {
+            return SDL_RESAMPLING_HIGH;
+        }
+    }
+    return SDL_RESAMPLING_MEDIUM;
 }
 
-static int
-SDL_FindFrequencyMultiple(const int src_rate, const int dst_rate)
+/* Zeroth order modified Bessel function of the first kind, for the window. */
+static double
+SDL_BesselI0(const double x)
 {
-    int retval = 0;
+    const double xhalf = x * 0.5;
+    double sum = 1.0;
+    double term = 1.0;
+    int i;
 
-    /* If we only built with the arbitrary resamplers, ignore multiples. */
-#if !LESS_RESAMPLERS
-    int lo, hi;
-    int div;
+    for (i = 1; i < 64; i++) {
+        term *= xhalf / i;
+        sum += term * term;
+        if ((term * term) < (sum * 1e-12)) {
+            break;
+        }
+    }
+    return sum;
+}
 
-    SDL_assert(src_rate != 0);
-    SDL_assert(dst_rate != 0);
-    SDL_assert(src_rate != dst_rate);
+static double
+SDL_ResamplerImpulse(const double x, const double cutoff, const double half_width,
+                     const double beta, const double i0beta)
+{
+    const double u = x / half_width;
+    double sinc;
 
-    if (src_rate < dst_rate) {
-        lo = src_rate;
-        hi = dst_rate;
+    if ((u <= -1.0) || (u >= 1.0)) {
+        return 0.0;
+    } else if (x == 0.0) {
+        sinc = cutoff;
     } else {
-        lo = dst_rate;
-        hi = src_rate;
+        sinc = SDL_sin(M_PI * cutoff * x) / (M_PI * x);
     }
-
-    /* zero means "not a supported multiple" ... we only do 2x and 4x. */
-    if ((hi % lo) != 0)
-        return 0;               /* not a multiple. */
-
-    div = hi / lo;
-    retval = ((div == 2) || (div == 4)) ? div : 0;
-#endif
-
-    return retval;
+    return sinc * (SDL_BesselI0(beta * SDL_sqrt(1.0 - (u * u))) / i0beta);
 }
 
-static int
-SDL_BuildAudioResampleCVT(SDL_AudioCVT * cvt, int dst_channels,
-                          int src_rate, int dst_rate)
+static void
+SDL_ResampleFrame_Scalar(const float *src, const float *coeffs, const int taps, const int chans, float *dst)
 {
-    if (src_rate != dst_rate) {
-        SDL_AudioFilter filter = SDL_HandTunedResampleCVT(cvt, dst_channels,
-                                                          src_rate, dst_rate);
+    int i, j;
+    for (i = 0; i < chans; i++) {
+        const float *s = src + i;
+        float sum = 0.0f;
+        for (j = 0; j < taps; j++) {
+            sum += s[j * chans] * coeffs[j];
+        }
+        dst[i] = sum;
+    }
+}
 
-        /* No hand-tuned converter? Try the autogenerated ones. */
-        if (filter == NULL) {
-            int i;
-            const int upsample = (src_rate < dst_rate) ? 1 : 0;
-            const int multiple =
-                SDL_FindFrequencyMultiple(src_rate, dst_rate);
-
-            for (i = 0; sdl_audio_rate_filters[i].filter != NULL; i++) {
-                const SDL_AudioRateFilters *filt = &sdl_audio_rate_filters[i];
-                if ((filt->fmt == cvt->dst_format) &&
-                    (filt->channels == dst_channels) &&
-                    (filt->upsample == upsample) &&
-                    (filt->multiple == multiple)) {
-                    filter = filt->filter;
-                    break;
-                }
-            }
+#ifdef __SSE2__
+static void
+SDL_ResampleFrame_SSE2(const float *src, const float *coeffs, const int taps, const int chans, float *dst)
+{
+    int i, j;
 
-            if (filter == NULL) {
-                SDL_SetError("No conversion available for these rates");
-                return -1;
+    if (chans == 1) {
+        __m128 sum = _mm_setzero_ps();
+        for (j = 0; j < taps; j += 4) {
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src + j), _mm_loadu_ps(coeffs + j)));
+        }
+        sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+        sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 1, 1, 1)));
+        _mm_store_ss(dst, sum);
+    } else if (chans == 2) {
+        /* four frames per pass, so each tap is used for a left/right pair. */
+        __m128 sum0 = _mm_setzero_ps();
+        __m128 sum1 = _mm_setzero_ps();
+        for (j = 0; j < taps; j += 4) {
+            const __m128 c = _mm_loadu_ps(coeffs + j);
+            sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_loadu_ps(src + (j * 2)), _mm_unpacklo_ps(c, c)));
+            sum1 = _mm_add_ps(sum1, _mm_mul_ps(_mm_loadu_ps(src + (j * 2) + 4), _mm_unpackhi_ps(c, c)));
+        }
+        sum0 = _mm_add_ps(sum0, sum1);
+        sum0 = _mm_add_ps(sum0, _mm_movehl_ps(sum0, sum0));
+        _mm_storel_pi((__m64 *) dst, sum0);
+    } else {
+        /* four channels of a frame at a time, any leftovers one by one. */
+        for (i = 0; (i + 4) <= chans; i += 4) {
+            const float *s = src + i;
+            __m128 sum = _mm_setzero_ps();
+            for (j = 0; j < taps; j++) {
+                sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(s + (j * chans)), _mm_set1_ps(coeffs[j])));
             }
+            _mm_storeu_ps(dst + i, sum);
         }
-
-        /* Update (cvt) with filter details... */
-        cvt->filters[cvt->filter_index++] = filter;
-        if (src_rate < dst_rate) {
-            const double mult = ((double) dst_rate) / ((double) src_rate);
-            cvt->len_mult *= (int) SDL_ceil(mult);
-            cvt->len_ratio *= mult;
-        } else {
-            cvt->len_ratio /= ((double) src_rate) / ((double) dst_rate);
+        if (i < chans) {
+            SDL_ResampleFrame_Scalar(src + i, coeffs, taps, chans, dst + i);
         }
-
-        return 1;               /* added a converter. */
     }
-
-    return 0;                   /* no conversion necessary. */
 }
+#endif
+
+static SDL_ResampleFilter *
+SDL_CreateResampleFilter(const int src_rate, const int dst_rate, const SDL_ResamplingQuality quality)
+{
+    const SDL_ResamplerQualityParams *params = &resampler_quality_params[quality];
+    SDL_ResampleFilter *filter;
+    double cutoff = params->rolloff;
+    double beta_i0;
+    int half_taps = params->zero_crossings;
+    int divisor, rows, row, i;
+    int a = src_rate, b = dst_rate;
+
+    while (b) {  /* greatest common divisor, to get the ratio in lowest terms. */
+        const int t = a % b;
+        a = b;
+        b = t;
+    }
+    divisor = a;
+
+    filter = (SDL_ResampleFilter *) SDL_calloc(1, sizeof (SDL_ResampleFilter));
+    if (!filter) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+
+    /* when downsampling, the cutoff moves down to the new Nyquist
+       frequency, so the filter needs proportionally more taps. */
+    if (dst_rate < src_rate) {
+        const double ratio = ((double) dst_rate) / ((double) src_rate);
+        cutoff *= ratio;
+        half_taps = (int) SDL_ceil(half_taps / ratio);
+        if (half_taps > (SDL_RESAMPLER_MAX_TAPS / 2)) {
+            half_taps = SDL_RESAMPLER_MAX_TAPS / 2;
+        }
+    }
+
+    filter->src_rate = src_rate;
+    filter->dst_rate = dst_rate;
+    filter->quality = quality;
+    filter->increment = src_rate / divisor;
+    filter->frame_phases = dst_rate / divisor;
+    filter->half_taps = half_taps;
+    filter->taps = ((half_taps * 2) + 3) & ~3;
+    if (filter->frame_phases > params->max_exact_phases) {
+        filter->table_phases = params->table_phases;
+        rows = filter->table_phases + 1;  /* one extra to interpolate toward. */
+    } else {
+        rows = (int) filter->frame_phases;
+    }
+
+    filter->table = (float *) SDL_malloc(rows * filter->taps * sizeof (float));
+    if (!filter->table) {
+        SDL_free(filter);
+        SDL_OutOfMemory();
+        return NULL;
+    }
+
+    beta_i0 = SDL_BesselI0(params->beta);
+    for (row = 0; row < rows; row++) {
+        const double phase = ((double) row) / ((double) (filter->table_phases ? filter->table_phases : filter->frame_phases));
+        float *coeffs = filter->table + (row * filter->taps);
+        double sum = 0.0;
+        for (i = 0; i < filter->taps; i++) {
+            const double x = phase + (double) (half_taps - 1 - i);
+            const double val = SDL_ResamplerImpulse(x, cutoff, (double) half_taps, params->beta, beta_i0);
+            coeffs[i] = (float) val;
+            sum += val;
+        }
+        /* normalize each row, so DC gain is exactly 1 at every position. */
+        for (i = 0; i < filter->taps; i++) {
+            coeffs[i] = (float) (coeffs[i] / sum);
+        }
+    }
+
+    filter->resample_frame = SDL_ResampleFrame_Scalar;
+#ifdef __SSE2__
+    if (SDL_GetAudioCPUFeatures() & SDL_AUDIO_CPU_SSE2) {
+        filter->resample_frame = SDL_ResampleFrame_SSE2;
+    }
+#endif
+
+    return filter;
+}
+
+static void
+SDL_FreeResampleFilter(SDL_ResampleFilter *filter)
+{
+    if (filter) {
+        SDL_free(filter->table);
+        SDL_free(filter);
+    }
+}
+
+/* Get the taps for fractional position (phase), in 1/frame_phases frames.
+   (scratch) must hold filter->taps floats, in case we have to interpolate. */
+static SDL_INLINE const float *
+SDL_GetResamplerCoeffs(const SDL_ResampleFilter *filter, const Sint64 phase, float *scratch)
+{
+    const int taps = filter->taps;
+    if (!filter->table_phases) {
+        return filter->table + (phase * taps);
+    } else {
+        const Sint64 idx = phase * filter->table_phases;
+        const float frac = ((float) (idx % filter->frame_phases)) / ((float) filter->frame_phases);
+        const float *row0 = filter->table + ((idx / filter->frame_phases) * taps);
+        const float *row1 = row0 + taps;
+        int i;
+        for (i = 0; i < taps; i++) {
+            scratch[i] = row0[i] + ((row1[i] - row0[i]) * frac);
+        }
+        return scratch;
+    }
+}
+
+/* SDL_AudioCVT is public and has no room for filter state, so what its
+   resampling and remixing filters need is kept here, in an entry found by
+   the address of the SDL_AudioCVT and checked against the public fields it
+   was built with. Entries are never freed, just handed on, so the filters
+   read them without a lock; a sequence count, odd while an entry changes,
+   catches a read that raced a rebuild. An SDL_AudioCVT copied after it was
+   built is found by its public fields instead, as long as every entry
+   built like it agrees on the parameters. */
+typedef struct SDL_AudioCVTParams
+{
+    int src_rate;                         /* zero if there's no resampling. */
+    int dst_rate;
+    int resample_channels;
+    SDL_ResamplingQuality quality;
+    const SDL_ResampleFilter *resampler;  /* NULL once the cache is freed. */
+    SDL_AudioFormat resample_src_fmt;     /* AUDIO_F32SYS unless it converts the input, */
+    SDL_AudioFilter resample_src_filter;  /*  with this. */
+    SDL_AudioFormat resample_dst_fmt;     /* likewise for the output. */
+    SDL_AudioFilter resample_dst_filter;
+    int remix_src_channels;               /* zero if there's no remixing. */
+    int remix_dst_channels;
+    SDL_bool custom_matrix;               /* an audio stream's own, not a default one. */
+    const SDL_ChannelMatrix *matrix;      /* if it's a default one, NULL once the cache is freed. */
+} SDL_AudioCVTParams;
+
+typedef struct SDL_AudioCVTEntry
+{
+    SDL_atomic_t sequence;
+    void *cvt;                  /* the SDL_AudioCVT this belongs to, NULL if it's free. */
+    SDL_AudioCVT built;         /* its public fields, as they were built. */
+    SDL_AudioCVTParams params;
+    struct SDL_AudioCVTEntry *next;
+} SDL_AudioCVTEntry;
+
+static SDL_SpinLock audio_cvt_entries_lock = 0;  /* only for changing entries. */
+static SDL_AudioCVTEntry *audio_cvt_entries = NULL;
+
+static SDL_bool
+SDL_AudioCVTMatchesBuilt(const SDL_AudioCVT * cvt, const SDL_AudioCVT * built)
+{
+    int i;
+
+    if ((cvt->src_format != built->src_format) || (cvt->dst_format != built->dst_format) ||
+        (cvt->rate_incr != built->rate_incr) || (cvt->len_mult != built->len_mult) ||
+        (cvt->len_ratio != built->len_ratio)) {
+        return SDL_FALSE;
+    }
+    for (i = 0; i < (int) SDL_arraysize(cvt->filters); i++) {
+        if (cvt->filters[i] != built->filters[i]) {
+            return SDL_FALSE;
+        } else if (cvt->filters[i] == NULL) {
+            break;
+        }
+    }
+    return SDL_TRUE;
+}
+
+static SDL_bool
+SDL_AudioCVTParamsEqual(const SDL_AudioCVTParams *a, const SDL_AudioCVTParams *b)
+{
+    return ((a->src_rate == b->src_rate) && (a->dst_rate == b->dst_rate) &&
+            (a->resample_channels == b->resample_channels) && (a->quality == b->quality) &&
+            (a->resample_src_fmt == b->resample_src_fmt) && (a->resample_dst_fmt == b->resample_dst_fmt) &&
+            (a->remix_src_channels == b->remix_src_channels) &&
+            (a->remix_dst_channels == b->remix_dst_channels) &&
+            (a->custom_matrix == b->custom_matrix) &&
+            (!a->custom_matrix || (a->matrix == b->matrix))) ? SDL_TRUE : SDL_FALSE;
+}
+
+/* Copies the parameters out of (entry) if it was built like (cvt); if
+   (owned), only if it was built for (cvt) itself. */
+static SDL_bool
+SDL_ReadAudioCVTEntry(SDL_AudioCVTEntry *entry, const SDL_AudioCVT * cvt,
+                      const SDL_bool owned, SDL_AudioCVTParams *params)
+{
+    SDL_AudioCVT built;
+    void *owner;
+
+    for (;;) {
+        const int sequence = SDL_AtomicGet(&entry->sequence);
+        if ((sequence & 1) == 0) {
+            SDL_MemoryBarrierAcquire();
+            owner = entry->cvt;
+            built = entry->built;
+            *params = entry->params;
+            SDL_MemoryBarrierAcquire();
+            if (SDL_AtomicGet(&entry->sequence) == sequence) {
+                break;
+            }
+        }
+    }
+
+    if (!owner || (owned && (owner != (void *) cvt))) {
+        return SDL_FALSE;
+    }
+    return SDL_AudioCVTMatchesBuilt(cvt, &built);
+}
+
+static SDL_bool
+SDL_GetAudioCVTParams(const SDL_AudioCVT * cvt, SDL_AudioCVTParams *params)
+{
+    SDL_AudioCVTEntry *entry;
+    SDL_AudioCVTParams other;
+    SDL_bool found = SDL_FALSE;
+
+    for (entry = (SDL_AudioCVTEntry *) SDL_AtomicGetPtr((void **) &audio_cvt_entries); entry; entry = entry->next) {
+        if ((SDL_AtomicGetPtr(&entry->cvt) == (void *) cvt) && SDL_ReadAudioCVTEntry(entry, cvt, SDL_TRUE, params)) {
+            return SDL_TRUE;
+        }
+    }
+
+    /* a copy; anything built the same way will do, if they all agree. */
+    for (entry = (SDL_AudioCVTEntry *) SDL_AtomicGetPtr((void **) &audio_cvt_entries); entry; entry = entry->next) {
+        if (SDL_ReadAudioCVTEntry(entry, cvt, SDL_FALSE, found ? &other : params)) {
+            if (found && !SDL_AudioCVTParamsEqual(params, &other)) {
+                return SDL_FALSE;
+            }
+            found = SDL_TRUE;
+        }
+    }
+    return found;
+}
+
+/* Call with (audio_cvt_entries_lock) held. (built) is NULL to keep it. */
+static void
+SDL_WriteAudioCVTEntry(SDL_AudioCVTEntry *entry, const SDL_AudioCVT * cvt,
+                       const SDL_AudioCVT * built, const SDL_AudioCVTParams *params)
+{
+    SDL_AtomicIncRef(&entry->sequence);  /* odd: readers retry until we're done. */
+    SDL_MemoryBarrierRelease();
+    SDL_AtomicSetPtr(&entry->cvt, (void *) cvt);
+    if (built) {
+        entry->built = *built;
+    }
+    if (params) {
+        entry->params = *params;
+    }
+    SDL_MemoryBarrierRelease();
+    SDL_AtomicIncRef(&entry->sequence);
+}
+
+/* Gives (cvt), as it is now, the parameters (params), or drops its entry
+   if (params) is NULL. Another SDL_AudioCVT's entry with the same public
+   fields and parameters is taken over rather than adding one, so entries
+   left behind by SDL_AudioCVTs that were freed don't pile up; that one
+   then finds it as a copy would. */
+static int
+SDL_SetAudioCVTParams(const SDL_AudioCVT * cvt, const SDL_AudioCVTParams *params)
+{
+    SDL_AudioCVTEntry *entry, *same = NULL, *spare = NULL;
+
+    SDL_AtomicLock(&audio_cvt_entries_lock);
+    for (entry = audio_cvt_entries; entry; entry = entry->next) {
+        if (entry->cvt == (void *) cvt) {
+            break;
+        } else if (!entry->cvt) {
+            spare = spare ? spare : entry;
+        } else if (params && !same && SDL_AudioCVTMatchesBuilt(cvt, &entry->built) &&
+                   SDL_AudioCVTParamsEqual(params, &entry->params)) {
+            same = entry;
+        }
+    }
+
+    if (!entry && params) {
+        entry = same ? same : spare;
+        if (!entry) {
+            entry = (SDL_AudioCVTEntry *) SDL_calloc(1, sizeof (SDL_AudioCVTEntry));
+            if (!entry) {
+                SDL_AtomicUnlock(&audio_cvt_entries_lock);
+                return SDL_OutOfMemory();
+            }
+            entry->next = audio_cvt_entries;
+            SDL_AtomicSetPtr((void **) &audio_cvt_entries, entry);
+        }
+    }
+
+    if (entry) {
+        SDL_WriteAudioCVTEntry(entry, params ? cvt : NULL, params ? cvt : NULL, params);
+    }
+    SDL_AtomicUnlock(&audio_cvt_entries_lock);
+    return 0;
+}
+
+/* Moves (src), and its entry, to (dst). */
+static void
+SDL_MoveAudioCVT(SDL_AudioCVT * dst, const SDL_AudioCVT * src)
+{
+    SDL_AudioCVTEntry *entry;
+
+    SDL_AtomicLock(&audio_cvt_entries_lock);
+    for (entry = audio_cvt_entries; entry; entry = entry->next) {
+        if (entry->cvt == (void *) dst) {
+            SDL_WriteAudioCVTEntry(entry, NULL, NULL, NULL);
+        }
+    }
+    *dst = *src;
+    for (entry = audio_cvt_entries; entry; entry = entry->next) {
+        if (entry->cvt == (void *) src) {
+            SDL_WriteAudioCVTEntry(entry, dst, NULL, NULL);
+        }
+    }
+    SDL_AtomicUnlock(&audio_cvt_entries_lock);
+}
+
+/* The caches are going away, so entries will have to look things up again. */
+static void
+SDL_ForgetCachedAudioCVTParams(const SDL_bool resamplers, const SDL_bool matrices)
+{
+    SDL_AudioCVTEntry *entry;
+
+    SDL_AtomicLock(&audio_cvt_entries_lock);
+    for (entry = audio_cvt_entries; entry; entry = entry->next) {
+        SDL_AudioCVTParams params = entry->params;
+        if (resamplers) {
+            params.resampler = NULL;
+        }
+        if (matrices && !params.custom_matrix) {
+            params.matrix = NULL;
+        }
+        SDL_WriteAudioCVTEntry(entry, (const SDL_AudioCVT *) entry->cvt, NULL, &params);
+    }
+    SDL_AtomicUnlock(&audio_cvt_entries_lock);
+}
+
+/* Filter tables for SDL_AudioCVT, which has nowhere to keep them. */
+static SDL_SpinLock resample_filter_cache_lock = 0;
+static SDL_ResampleFilter *resample_filter_cache = NULL;
+
+static SDL_ResampleFilter *
+SDL_GetCachedResampleFilter(const int src_rate, const int dst_rate, const SDL_ResamplingQuality quality)
+{
+    SDL_ResampleFilter *filter;
+
+    SDL_AtomicLock(&resample_filter_cache_lock);
+    for (filter = resample_filter_cache; filter; filter = filter->next) {
+        if ((filter->src_rate == src_rate) && (filter->dst_rate == dst_rate) && (filter->quality == quality)) {
+            break;
+        }
+    }
+    SDL_AtomicUnlock(&resample_filter_cache_lock);
+
+    if (!filter) {
+        /* build it unlocked; if another thread beat us to it, we just end up
+           with a harmless duplicate in the list. */
+        filter = SDL_CreateResampleFilter(src_rate, dst_rate, quality);
+        if (filter) {
+            SDL_AtomicLock(&resample_filter_cache_lock);
+            filter->next = resample_filter_cache;
+            resample_filter_cache = filter;
+            SDL_AtomicUnlock(&resample_filter_cache_lock);
+        }
+    }
+
+    return filter;
+}
+
+void
+SDL_FreeResampleFilterCache(void)
+{
+    SDL_ResampleFilter *filter;
+
+    SDL_AtomicLock(&resample_filter_cache_lock);
+    filter = resample_filter_cache;
+    resample_filter_cache = NULL;
+    SDL_AtomicUnlock(&resample_filter_cache_lock);
+
+    SDL_ForgetCachedAudioCVTParams(SDL_TRUE, SDL_FALSE);
+
+    while (filter) {
+        SDL_ResampleFilter *next = filter->next;
+        SDL_FreeResampleFilter(filter);
+        filter = next;
+    }
+}
+
+/* Where the resampler is: the first input frame its filter reaches, and
+   the phase, which picks the filter's row. It steps in whole frames plus
+   a phase, so there's no dividing per frame. */
+typedef struct
+{
+    Sint64 start;
+    Sint64 phase;
+} SDL_ResamplerPosition;
+
+/* How many more output frames have filters starting no later than input
+   frame (last). */
+static Sint64
+SDL_CountResampledFrames(const SDL_ResampleFilter *filter, const SDL_ResamplerPosition *position, const Sint64 last)
+{
+    const Sint64 pos = ((position->start + filter->half_taps - 1) * filter->frame_phases) + position->phase;
+    const Sint64 end = (last + filter->half_taps) * filter->frame_phases;
+    return (end > pos) ? (((end - pos) + filter->increment - 1) / filter->increment) : 0;
+}
+
+/* Computes (outframes) output frames into (dst), from (position) on. (src)
+   holds the input from frame (first) on, as far as those frames reach;
+   there's silence before frame 0 and from frame (inframes) on. */
+static void
+SDL_ResampleCVTFrames(const SDL_ResampleFilter *filter, const float *src, const Sint64 first,
+                      const Sint64 inframes, const int chans, SDL_ResamplerPosition *position,
+                      const Sint64 outframes, float *dst)
+{
+    const Sint64 frame_step = filter->increment / filter->frame_phases;
+    const Sint64 phase_step = filter->increment % filter->frame_phases;
+    const Sint64 frame_phases = filter->frame_phases;
+    const int taps = filter->taps;
+    float scratch[SDL_RESAMPLER_MAX_TAPS];
+    Sint64 start = position->start;
+    Sint64 phase = position->phase;
+    Sint64 k;
+
+    for (k = 0; k < outframes; k++, dst += chans) {
+        const float *coeffs = SDL_GetResamplerCoeffs(filter, phase, scratch);
+
+        /* Frames whose filter reaches past an edge take the slow path;
+           everything else goes full speed. */
+        if ((start >= 0) && ((start + taps) <= inframes)) {
+            filter->resample_frame(src + ((start - first) * chans), coeffs, taps, chans, dst);
+        } else {
+            int i, j;
+            for (i = 0; i < chans; i++) {
+                float sum = 0.0f;
+                for (j = 0; j < taps; j++) {
+                    const Sint64 frame = start + j;
+                    if ((frame >= 0) && (frame < inframes)) {
+                        sum += src[((frame - first) * chans) + i] * coeffs[j];
+                    }
+                }
+                dst[i] = sum;
+            }
+        }
+
+        start += frame_step;
+        phase += phase_step;
+        if (phase >= frame_phases) {
+            phase -= frame_phases;
+            start++;
+        }
+    }
+
+    position->start = start;
+    position->phase = phase;
+}
+
+/* Runs (filter), a type conversion, over (len) bytes of (format) data at (buf). */
+static void
+SDL_ConvertAudioBlock(SDL_AudioFilter filter, SDL_AudioFormat format, void *buf, const int len)
+{
+    SDL_AudioCVT cvt;
+
+    cvt.buf = (Uint8 *) buf;
+    cvt.len_cvt = len;
+    cvt.filters[0] = filter;
+    cvt.filters[1] = NULL;
+    cvt.filter_index = 0;
+    filter(&cvt, format);
+}
+
+/* Resamples (inframes) frames at (src) to (dst), converting the data type
+   of either or both as (params) says, a window at a time. The type
+   converters and the per-frame math are the same as when they're separate
+   passes, so the output is too. Returns the number of frames written. */
+static Sint64
+SDL_ResampleConvertingCVT(const SDL_AudioCVTParams *params, const SDL_ResampleFilter *filter,
+                          const Uint8 *src, const Sint64 inframes, Uint8 *dst)
+{
+    const int chans = params->resample_channels;
+    const int src_framelen = chans * (SDL_AUDIO_BITSIZE(params->resample_src_fmt) / 8);
+    const int dst_framelen = chans * (SDL_AUDIO_BITSIZE(params->resample_dst_fmt) / 8);
+    const Sint64 block_frames = SDL_RESAMPLER_BLOCK_FLOATS / chans;
+    /* no bigger than a block of output needs, so only the overlap is converted twice. */
+    const Sint64 window_frames = !params->resample_src_filter ? inframes :
+        SDL_min(SDL_RESAMPLER_WINDOW_FLOATS / chans, ((block_frames * filter->increment) / filter->frame_phases) + filter->taps + 1);
+    float window[SDL_RESAMPLER_WINDOW_FLOATS];
+    float block[SDL_RESAMPLER_BLOCK_FLOATS];
+    SDL_ResamplerPosition position;
+    Sint64 outframes = 0;
+
+    position.start = 1 - filter->half_taps;
+    position.phase = 0;
+
+    for (;;) {
+        /* the window starts at the first frame the next output needs, and
+           gives as many output frames as fit in a block. */
+        const Sint64 first = SDL_max(0, position.start);
+        const Sint64 count = SDL_min(window_frames, inframes - first);
+        const Sint64 last = ((first + count) < inframes) ? (first + count - filter->taps) : (inframes - filter->half_taps);
+        const Sint64 frames = SDL_min(block_frames, SDL_CountResampledFrames(filter, &position, last));
+        float *output = params->resample_dst_filter ? block : (float *) (dst + (outframes * dst_framelen));
+        const float *input;
+
+        if (frames == 0) {
+            break;
+        }
+
+        if (params->resample_src_filter) {
+            SDL_memcpy(window, src + (first * src_framelen), (size_t) (count * src_framelen));
+            SDL_ConvertAudioBlock(params->resample_src_filter, params->resample_src_fmt, window, (int) (count * src_framelen));
+            input = window;
+        } else {
+            input = ((const float *) src) + (first * chans);
+        }
+
+        SDL_ResampleCVTFrames(filter, input, first, inframes, chans, &position, frames, output);
+
+        if (params->resample_dst_filter) {
+            SDL_ConvertAudioBlock(params->resample_dst_filter, AUDIO_F32SYS, block, (int) (frames * chans * sizeof (float)));
+            SDL_memcpy(dst + (outframes * dst_framelen), block, (size_t) (frames * dst_framelen));
+        }
+        outframes += frames;
+    }
+
+    return outframes;
+}
+
+static void SDLCALL
+SDL_ResampleCVT(SDL_AudioCVT * cvt, SDL_AudioFormat format)
+{
+    SDL_AudioCVTParams params;
+    const SDL_ResampleFilter *filter;
+    int src_rate, dst_rate, chans, src_framelen, dst_framelen;
+    Sint64 inframes, outframes;
+    Uint8 *dst;
+
+    if (!SDL_GetAudioCVTParams(cvt, &params) || !params.src_rate) {
+        /* not built by SDL_BuildAudioCVT, or changed since; we can't know
+           what it wants. */
+        SDL_SetError("Audio conversion wasn't built by SDL_BuildAudioCVT");
+        cvt->len_cvt = 0;
+        return;
+    }
+
+    SDL_assert(format == params.resample_src_fmt);
+
+    src_rate = params.src_rate;
+    dst_rate = params.dst_rate;
+    chans = params.resample_channels;
+    src_framelen = chans * (SDL_AUDIO_BITSIZE(params.resample_src_fmt) / 8);
+    dst_framelen = chans * (SDL_AUDIO_BITSIZE(params.resample_dst_fmt) / 8);
+    inframes = cvt->len_cvt / src_framelen;
+    dst = cvt->buf + (inframes * src_framelen);
+    filter = params.resampler;
+    if (!filter) {
+        filter = SDL_GetCachedResampleFilter(src_rate, dst_rate, params.quality);
+    }
+
+#ifdef DEBUG_CONVERT
+    fprintf(stderr, "Resampling %d to %d Hz, %d channels\n", src_rate, dst_rate, chans);
+#endif
+
+    /* there's no state between calls, so the data is treated as if it
+       has silence on both sides. The output is written after the input,
+       then moved down. */
+    if (!filter) {
+        /* out of memory; the best we can do is silence of the right size. */
+        outframes = (((inframes * dst_rate) + src_rate - 1) / src_rate);
+        SDL_memset(dst, '\0', (size_t) (outframes * dst_framelen));
+    } else if (params.resample_src_filter || params.resample_dst_filter) {
+        outframes = SDL_ResampleConvertingCVT(&params, filter, cvt->buf, inframes, dst);
+    } else {
+        SDL_ResamplerPosition position;
+        position.start = 1 - filter->half_taps;
+        position.phase = 0;
+        outframes = SDL_CountResampledFrames(filter, &position, inframes - filter->half_taps);
+        SDL_ResampleCVTFrames(filter, (const float *) cvt->buf, 0, inframes, chans, &position, outframes, (float *) dst);
+    }
+
+    SDL_memmove(cvt->buf, dst, (size_t) (outframes * dst_framelen));
+    cvt->len_cvt = (int) (outframes * dst_framelen);
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, params.resample_dst_fmt);
+    }
+}
+
+/* Resamples (channels) channels of (src_fmt) data to (dst_fmt). The type
+   conversions around the resampler are usually folded into it, which
+   saves two passes over the data; a filter too long for its window
+   gets them as passes of their own. */
+static int
+SDL_BuildAudioResampleCVT(SDL_AudioCVT * cvt, SDL_AudioCVTParams *params,
+                          const int channels, const int src_rate, const int dst_rate,
+                          SDL_AudioFormat src_fmt, SDL_AudioFormat dst_fmt)
+{
+    const SDL_ResamplingQuality quality = SDL_GetResamplingQuality();
+    const double mult = ((double) dst_rate) / ((double) src_rate);
+    int src_size, dst_size;
+
+    if ((src_rate > SDL_RESAMPLER_MAX_RATE) || (dst_rate > SDL_RESAMPLER_MAX_RATE)) {
+        return SDL_SetError("Sample rate is too high to resample");
+    }
+
+    /* Build the table now, so the first conversion doesn't pay for it. */
+    params->resampler = SDL_GetCachedResampleFilter(src_rate, dst_rate, quality);
+    if (!params->resampler) {
+        return -1;
+    }
+
+    params->resample_src_fmt = params->resample_dst_fmt = AUDIO_F32SYS;
+    params->resample_src_filter = params->resample_dst_filter = NULL;
+    if ((channels * params->resampler->taps * 2) <= SDL_RESAMPLER_WINDOW_FLOATS) {
+        if (src_fmt != AUDIO_F32SYS) {
+            params->resample_src_fmt = src_fmt;
+            params->resample_src_filter = SDL_FindAudioTypeFilter(src_fmt, AUDIO_F32SYS);
+        }
+        if (dst_fmt != AUDIO_F32SYS) {
+            params->resample_dst_fmt = dst_fmt;
+            params->resample_dst_filter = SDL_FindAudioTypeFilter(AUDIO_F32SYS, dst_fmt);
+        }
+        if (((src_fmt != AUDIO_F32SYS) && !params->resample_src_filter) ||
+            ((dst_fmt != AUDIO_F32SYS) && !params->resample_dst_filter)) {
+            return SDL_SetError("No conversion available for these formats");
+        }
+    } else if (SDL_BuildAudioTypeCVT(cvt, src_fmt, AUDIO_F32SYS) == -1) {
+        return -1;
+    }
+
+    if ((cvt->filter_index + 1) >= (int) SDL_arraysize(cvt->filters)) {
+        return SDL_SetError("Too many conversion filters needed");
+    }
+
+    /* Update (cvt) with filter details... */
+    cvt->filters[cvt->filter_index++] = SDL_ResampleCVT;
+    params->src_rate = src_rate;
+    params->dst_rate = dst_rate;
+    params->resample_channels = channels;
+    params->quality = quality;
+
+    /* the output is written after the input, then moved down. */
+    src_size = SDL_AUDIO_BITSIZE(params->resample_src_fmt) / 8;
+    dst_size = SDL_AUDIO_BITSIZE(params->resample_dst_fmt) / 8;
+    cvt->len_mult *= 1 + ((((int) SDL_ceil(mult)) * dst_size) + src_size - 1) / src_size;
+    cvt->len_ratio *= mult * ((double) dst_size) / ((double) src_size);
+
+    if (params->resample_dst_fmt != dst_fmt) {
+        return SDL_BuildAudioTypeCVT(cvt, AUDIO_F32SYS, dst_fmt);
+    }
+    return 1;                   /* added a converter. */
+}
+
+/* Channel remixing: every output channel of a frame is a weighted sum of
+   the input channels, so any layout converts to any other in one pass. */
+
+typedef enum
+{
+    SDL_SPEAKER_FL,
+    SDL_SPEAKER_FR,
+    SDL_SPEAKER_FC,
+    SDL_SPEAKER_LFE,
+    SDL_SPEAKER_BL,
+    SDL_SPEAKER_BR,
+    SDL_SPEAKER_SL,
+    SDL_SPEAKER_SR,
+    SDL_SPEAKER_COUNT
+} SDL_Speaker;
+
+/* The speakers of the layouts documented for SDL_AudioSpec::channels. */
+static const Uint8 speakers_stereo[] = {
+    SDL_SPEAKER_FL, SDL_SPEAKER_FR
+};
+static const Uint8 speakers_quad[] = {
+    SDL_SPEAKER_FL, SDL_SPEAKER_FR, SDL_SPEAKER_BL, SDL_SPEAKER_BR
+};
+static const Uint8 speakers_51[] = {
+    SDL_SPEAKER_FL, SDL_SPEAKER_FR, SDL_SPEAKER_FC, SDL_SPEAKER_LFE,
+    SDL_SPEAKER_BL, SDL_SPEAKER_BR
+};
+static const Uint8 speakers_71[] = {
+    SDL_SPEAKER_FL, SDL_SPEAKER_FR, SDL_SPEAKER_FC, SDL_SPEAKER_LFE,
+    SDL_SPEAKER_BL, SDL_SPEAKER_BR, SDL_SPEAKER_SL, SDL_SPEAKER_SR
+};
+
+static const Uint8 *
+SDL_GetSpeakerLayout(const int channels)
+{
+    switch (channels) {
+    case 2: return speakers_stereo;
+    case 4: return speakers_quad;
+    case 6: return speakers_51;
+    case 8: return speakers_71;
+    default: return NULL;
+    }
+}
+
+/* Fills in (coeffs), dst_channels rows of src_channels, with the standard
+   remix: matching speakers pass through, missing ones fold into their
+   neighbors at -3dB (LFE is dropped), and each row is scaled down to a
+   total gain of one if it would otherwise be able to clip. Mono goes to
+   the front pair, everything mixes down to mono through stereo, and
+   other channel counts just keep the channels they have in common. */
+static void
+SDL_BuildDefaultChannelMatrix(float *coeffs, const int src_channels, const int dst_channels)
+{
+    const Uint8 *src_layout = SDL_GetSpeakerLayout(src_channels);
+    const Uint8 *dst_layout = SDL_GetSpeakerLayout(dst_channels);
+    int dst_index[SDL_SPEAKER_COUNT];
+    int i, j;
+
+    SDL_memset(coeffs, '\0', dst_channels * src_channels * sizeof (float));
+
+    if (dst_channels == 1) {
+        if (src_layout) {
+            float stereo[2 * 8];
+            SDL_BuildDefaultChannelMatrix(stereo, src_channels, 2);
+            for (i = 0; i < src_channels; i++) {
+                coeffs[i] = (stereo[i] + stereo[src_channels + i]) * 0.5f;
+            }
+        } else {
+            for (i = 0; i < src_channels; i++) {
+                coeffs[i] = 1.0f / ((float) src_channels);
+            }
+        }
+        return;
+    } else if (src_channels == 1) {
+        coeffs[0] = coeffs[1] = 1.0f;
+        return;
+    } else if (!src_layout || !dst_layout) {
+        for (i = 0; i < SDL_min(src_channels, dst_channels); i++) {
+            coeffs[(i * src_channels) + i] = 1.0f;
+        }
+        return;
+    }
+
+    for (i = 0; i < SDL_SPEAKER_COUNT; i++) {
+        dst_index[i] = -1;
+    }
+    for (i = 0; i < dst_channels; i++) {
+        dst_index[dst_layout[i]] = i;
+    }
+
+    for (i = 0; i < src_channels; i++) {
+        const int speaker = src_layout[i];
+        float *column = coeffs + i;
+        if (dst_index[speaker] >= 0) {
+            column[dst_index[speaker] * src_channels] = 1.0f;
+            continue;
+        }
+        switch (speaker) {
+        case SDL_SPEAKER_FC:
+            column[dst_index[SDL_SPEAKER_FL] * src_channels] = 0.70710678f;
+            column[dst_index[SDL_SPEAKER_FR] * src_channels] = 0.70710678f;
+            break;
+        case SDL_SPEAKER_BL:
+        case SDL_SPEAKER_BR:
+            column[dst_index[speaker - SDL_SPEAKER_BL + SDL_SPEAKER_FL] * src_channels] = 0.70710678f;
+            break;
+        case SDL_SPEAKER_SL:
+        case SDL_SPEAKER_SR:
+            if (dst_index[SDL_SPEAKER_BL] >= 0) {
+                column[dst_index[speaker - SDL_SPEAKER_SL + SDL_SPEAKER_BL] * src_channels] = 0.70710678f;
+            } else {
+                column[dst_index[speaker - SDL_SPEAKER_SL + SDL_SPEAKER_FL] * src_channels] = 0.70710678f;
+            }
+            break;
+        default:  /* LFE has no good place to go. */
+            break;
+        }
+    }
+
+    for (i = 0; i < dst_channels; i++) {
+        float *row = coeffs + (i * src_channels);
+        float sum = 0.0f;
+        for (j = 0; j < src_channels; j++) {
+            sum += row[j];
+        }
+        if (sum > 1.0f) {
+            for (j = 0; j < src_channels; j++) {
+                row[j] /= sum;
+            }
+        }
+    }
+}
+
+/* (coeffs) is NULL for the default remix. */
+static SDL_ChannelMatrix *
+SDL_CreateChannelMatrix(const int src_channels, const int dst_channels, const float *coeffs)
+{
+    const int column_len = (dst_channels + 3) & ~3;
+    const size_t count = (size_t) (dst_channels * src_channels) + (size_t) (src_channels * column_len);
+    SDL_ChannelMatrix *matrix = (SDL_ChannelMatrix *) SDL_calloc(1, sizeof (SDL_ChannelMatrix) + (count * sizeof (float)));
+    int i, j;
+
+    if (!matrix) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+
+    matrix->src_channels = src_channels;
+    matrix->dst_channels = dst_channels;
+    matrix->coeffs = (float *) (matrix + 1);
+    matrix->columns = matrix->coeffs + (dst_channels * src_channels);
+    matrix->column_len = column_len;
+
+    if (coeffs) {
+        SDL_memcpy(matrix->coeffs, coeffs, dst_channels * src_channels * sizeof (float));
+    } else {
+        SDL_BuildDefaultChannelMatrix(matrix->coeffs, src_channels, dst_channels);
+    }
+
+    for (i = 0; i < src_channels; i++) {
+        for (j = 0; j < dst_channels; j++) {
+            matrix->columns[(i * column_len) + j] = matrix->coeffs[(j * src_channels) + i];
+        }
+    }
+
+    return matrix;
+}
+
+/* Default matrices, cached for SDL_AudioCVT just like the resampler's tables. */
+static SDL_SpinLock channel_matrix_cache_lock = 0;
+static SDL_ChannelMatrix *channel_matrix_cache = NULL;
+
+static const SDL_ChannelMatrix *
+SDL_GetCachedChannelMatrix(const int src_channels, const int dst_channels)
+{
+    SDL_ChannelMatrix *matrix;
+
+    SDL_AtomicLock(&channel_matrix_cache_lock);
+    for (matrix = channel_matrix_cache; matrix; matrix = matrix->next) {
+        if ((matrix->src_channels == src_channels) && (matrix->dst_channels == dst_channels)) {
+            break;
+        }
+    }
+    SDL_AtomicUnlock(&channel_matrix_cache_lock);
+
+    if (!matrix) {
+        matrix = SDL_CreateChannelMatrix(src_channels, dst_channels, NULL);
+        if (matrix) {
+            SDL_AtomicLock(&channel_matrix_cache_lock);
+            matrix->next = channel_matrix_cache;
+            channel_matrix_cache = matrix;
+            SDL_AtomicUnlock(&channel_matrix_cache_lock);
+        }
+    }
+
+    return matrix;
+}
+
+void
+SDL_FreeChannelMatrixCache(void)
+{
+    SDL_ChannelMatrix *matrix;
+
+    SDL_AtomicLock(&channel_matrix_cache_lock);
+    matrix = channel_matrix_cache;
+    channel_matrix_cache = NULL;
+    SDL_AtomicUnlock(&channel_matrix_cache_lock);
+
+    SDL_ForgetCachedAudioCVTParams(SDL_FALSE, SDL_TRUE);
+
+    while (matrix) {
+        SDL_ChannelMatrix *next = matrix->next;
+        SDL_free(matrix);
+        matrix = next;
+    }
+}
+
+/* These work in place, so when frames grow they go back to front. Each
+   frame is completely read before any of its output is written. */
+static void
+SDL_RemixChannels_Scalar(float *buf, const int frames, const SDL_ChannelMatrix *matrix)
+{
+    const int srcchans = matrix->src_channels;
+    const int dstchans = matrix->dst_channels;
+    const SDL_bool backwards = (dstchans > srcchans) ? SDL_TRUE : SDL_FALSE;
+    float out[255];
+    int i, j, k;
+
+    for (i = 0; i < frames; i++) {
+        const int frame = backwards ? (frames - 1 - i) : i;
+        const float *src = buf + (frame * srcchans);
+        const float *coeffs = matrix->coeffs;
+        for (j = 0; j < dstchans; j++, coeffs += srcchans) {
+            float sum = 0.0f;
+            for (k = 0; k < srcchans; k++) {
+                /* rounded like the SSE2 version, which the fused converters match. */
+                sum = SDL_RoundFloat(sum + SDL_RoundFloat(src[k] * coeffs[k]));
+            }
+            out[j] = sum;
+        }
+        SDL_memcpy(buf + (frame * dstchans), out, dstchans * sizeof (float));
+    }
+}
+
+#ifdef __SSE2__
+/* Stores the first (count) floats of (v); the frame may end mid-vector. */
+static SDL_INLINE void
+SDL_StoreFloats_SSE2(float *dst, const __m128 v, const int count)
+{
+    switch (count) {
+    case 4:
+        _mm_storeu_ps(dst, v);
+        break;
+    case 3:
+        _mm_storel_pi((__m64 *) dst, v);
+        _mm_store_ss(dst + 2, _mm_movehl_ps(v, v));
+        break;
+    case 2:
+        _mm_storel_pi((__m64 *) dst, v);
+        break;
+    default:
+        _mm_store_ss(dst, v);
+        break;
+    }
+}
+
+/* Up to eight output channels, kept in two registers: each input sample is
+   broadcast and multiplied by its column of the matrix. */
+static void
+SDL_RemixChannels_SSE2(float *buf, const int frames, const SDL_ChannelMatrix *matrix)
+{
+    const int srcchans = matrix->src_channels;
+    const int dstchans = matrix->dst_channels;
+    const SDL_bool backwards = (dstchans > srcchans) ? SDL_TRUE : SDL_FALSE;
+    int i, k;
+
+    SDL_assert(dstchans <= 8);
+
+    for (i = 0; i < frames; i++) {
+        const int frame = backwards ? (frames - 1 - i) : i;
+        const float *src = buf + (frame * srcchans);
+        float *dst = buf + (frame * dstchans);
+        const float *column = matrix->columns;
+        __m128 lo = _mm_setzero_ps();
+
+        if (dstchans <= 4) {
+            for (k = 0; k < srcchans; k++, column += 4) {
+                lo = _mm_add_ps(lo, _mm_mul_ps(_mm_set1_ps(src[k]), _mm_loadu_ps(column)));
+            }
+            SDL_StoreFloats_SSE2(dst, lo, dstchans);
+        } else {
+            __m128 hi = _mm_setzero_ps();
+            for (k = 0; k < srcchans; k++, column += 8) {
+                const __m128 sample = _mm_set1_ps(src[k]);
+                lo = _mm_add_ps(lo, _mm_mul_ps(sample, _mm_loadu_ps(column)));
+                hi = _mm_add_ps(hi, _mm_mul_ps(sample, _mm_loadu_ps(column + 4)));
+            }
+            _mm_storeu_ps(dst, lo);
+            SDL_StoreFloats_SSE2(dst + 4, hi, dstchans - 4);
+        }
+    }
+}
+#endif
+
+static void
+SDL_RemixChannels(SDL_AudioCVT * cvt, const SDL_ChannelMatrix *matrix)
+{
+    const int frames = cvt->len_cvt / (matrix->src_channels * sizeof (float));
+
+#ifdef DEBUG_CONVERT
+    fprintf(stderr, "Remixing %d to %d channels\n", matrix->src_channels, matrix->dst_channels);
+#endif
+
+#ifdef __SSE2__
+    if ((matrix->dst_channels <= 8) && (SDL_GetAudioCPUFeatures() & SDL_AUDIO_CPU_SSE2)) {
+        SDL_RemixChannels_SSE2((float *) cvt->buf, frames, matrix);
+    } else
+#endif
+    SDL_RemixChannels_Scalar((float *) cvt->buf, frames, matrix);
+
+    cvt->len_cvt = frames * matrix->dst_channels * sizeof (float);
+}
+
+static const SDL_ChannelMatrix *
+SDL_GetRemixMatrix(const SDL_AudioCVTParams *params)
+{
+    if (params->matrix || params->custom_matrix) {
+        return params->matrix;
+    }
+    return SDL_GetCachedChannelMatrix(params->remix_src_channels, params->remix_dst_channels);
+}
+
+const SDL_ChannelMatrix *
+SDL_GetCVTChannelMatrix(const SDL_AudioCVT * cvt)
+{
+    SDL_AudioCVTParams params;
+    if (!SDL_GetAudioCVTParams(cvt, &params) || !params.remix_src_channels) {
+        return NULL;
+    }
+    return SDL_GetRemixMatrix(&params);
+}
+
+static void SDLCALL
+SDL_ConvertChannels(SDL_AudioCVT * cvt, SDL_AudioFormat format)
+{
+    SDL_AudioCVTParams params;
+    const SDL_ChannelMatrix *matrix = NULL;
 
+    SDL_assert(format == AUDIO_F32SYS);
+
+    if (SDL_GetAudioCVTParams(cvt, &params) && params.remix_src_channels) {
+        matrix = SDL_GetRemixMatrix(&params);
+    } else {
+        SDL_SetError("Audio conversion wasn't built by SDL_BuildAudioCVT");
+        params.remix_src_channels = params.remix_dst_channels = 1;
+    }
+
+    if (matrix) {
+        SDL_RemixChannels(cvt, matrix);
+    } else {
+        /* the best we can do is silence of the right size. */
+        const int src_channels = params.remix_src_channels;
+        const int dst_channels = params.remix_dst_channels;
+        cvt->len_cvt = (cvt->len_cvt / (src_channels * sizeof (float))) * dst_channels * sizeof (float);
+        SDL_memset(cvt->buf, '\0', cvt->len_cvt);
+    }
+
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+/* Adds (filter), which remixes with (matrix) or the default if it's NULL,
+   and takes (src_framelen) bytes per frame to (dst_framelen). */
+static int
+SDL_AddAudioRemixFilter(SDL_AudioCVT * cvt, SDL_AudioCVTParams *params,
+                        SDL_AudioFilter filter,
+                        const int src_channels, const int dst_channels,
+                        const SDL_ChannelMatrix *matrix,
+                        const int src_framelen, const int dst_framelen)
+{
+    if ((cvt->filter_index + 1) >= (int) SDL_arraysize(cvt->filters)) {
+        return SDL_SetError("Too many conversion filters needed");
+    }
+
+    params->custom_matrix = matrix ? SDL_TRUE : SDL_FALSE;
+    if (!matrix) {
+        /* Build the matrix now, so the first conversion doesn't pay for it. */
+        matrix = SDL_GetCachedChannelMatrix(src_channels, dst_channels);
+        if (!matrix) {
+            return -1;
+        }
+    }
+    params->remix_src_channels = src_channels;
+    params->remix_dst_channels = dst_channels;
+    params->matrix = matrix;
+    cvt->filters[cvt->filter_index++] = filter;
+
+    if (dst_framelen > src_framelen) {
+        cvt->len_mult *= (dst_framelen + src_framelen - 1) / src_framelen;
+    }
+    cvt->len_ratio *= ((double) dst_framelen) / ((double) src_framelen);
+
+    return 1;                   /* added a converter. */
+}
+
+/* (matrix) is NULL to use the default remix when the channel counts differ. */
+static int
+SDL_BuildAudioChannelCVT(SDL_AudioCVT * cvt, SDL_AudioCVTParams *params, const int src_channels,
+                         const int dst_channels, const SDL_ChannelMatrix *matrix)
+{
+    if ((src_channels != dst_channels) || matrix) {
+        return SDL_AddAudioRemixFilter(cvt, params, SDL_ConvertChannels, src_channels, dst_channels,
+                                       matrix, src_channels, dst_channels);
+    }
+
+    return 0;                   /* no conversion necessary. */
+}
+
+/* A generated converter that changes the data type and remixes at once,
+   or NULL if this isn't one of the combinations common enough to have one.
+   They're plain C, so with SSE2 the separate passes are faster. */
+static SDL_AudioFilter
+SDL_FindFusedAudioFilter(SDL_AudioFormat src_fmt, const int src_channels,
+                         SDL_AudioFormat dst_fmt, const int dst_channels)
+{
+    int i;
+
+#ifdef __SSE2__
+    if (SDL_GetAudioCPUFeatures() & SDL_AUDIO_CPU_SSE2) {
+        return NULL;
+    }
+#endif
+
+    for (i = 0; sdl_audio_fused_filters[i].filter != NULL; i++) {
+        const SDL_AudioFusedFilters *filt = &sdl_audio_fused_filters[i];
+        if ((filt->src_fmt == src_fmt) && (filt->src_channels == src_channels) &&
+            (filt->dst_fmt == dst_fmt) && (filt->dst_channels == dst_channels)) {
+            return filt->filter;
+        }
+    }
+
+    return NULL;
+}
+
+static int
+SDL_BuildAudioFusedCVT(SDL_AudioCVT * cvt, SDL_AudioCVTParams *params, SDL_AudioFilter filter,
+                       SDL_AudioFormat src_fmt, const int src_channels,
+                       SDL_AudioFormat dst_fmt, const int dst_channels,
+                       const SDL_ChannelMatrix *matrix)
+{
+    return SDL_AddAudioRemixFilter(cvt, params, filter, src_channels, dst_channels, matrix,
+                                   (SDL_AUDIO_BITSIZE(src_fmt) / 8) * src_channels,
+                                   (SDL_AUDIO_BITSIZE(dst_fmt) / 8) * dst_channels);
+}
+
+
+static const char *
+SDL_GetAudioFormatName(const SDL_AudioFormat format)
+{
+    switch (format) {
+#define CASE(X) case X: return #X
+    CASE(AUDIO_U8);
+    CASE(AUDIO_S8);
+    CASE(AUDIO_U16LSB);
+    CASE(AUDIO_S16LSB);
+    CASE(AUDIO_U16MSB);
+    CASE(AUDIO_S16MSB);
+    CASE(AUDIO_S32LSB);
+    CASE(AUDIO_S32MSB);
+    CASE(AUDIO_F32LSB);
+    CASE(AUDIO_F32MSB);
+#undef CASE
+    default: return "unknown format";
+    }
+}
+
+/* Logs each pass of (cvt), with (mid_fmt) as the format data is remixed
+   and resampled in. Only built if the audio category logs debug output. */
+static void
+SDL_LogAudioCVT(const SDL_AudioCVT * cvt, const SDL_AudioCVTParams *params,
+                SDL_AudioFormat src_fmt, Uint8 src_channels, int src_rate,
+                SDL_AudioFormat dst_fmt, Uint8 dst_channels, int dst_rate,
+                SDL_AudioFormat mid_fmt)
+{
+    const char *matrix = params->custom_matrix ? "custom" : "default";
+    SDL_AudioFormat format = src_fmt;
+    int i;
+
+    SDL_LogDebug(SDL_LOG_CATEGORY_AUDIO,
+                 "Audio conversion %s %uch %dHz -> %s %uch %dHz: %d passes, len_mult %d, len_ratio %f",
+                 SDL_GetAudioFormatName(src_fmt), (unsigned int) src_channels, src_rate,
+                 SDL_GetAudioFormatName(dst_fmt), (unsigned int) dst_channels, dst_rate,
+                 cvt->filter_index, cvt->len_mult, cvt->len_ratio);
+
+    for (i = 0; i < cvt->filter_index; i++) {
+        const SDL_AudioFilter filter = cvt->filters[i];
+        const SDL_AudioFusedFilters *fused = NULL;
+        int j;
+
+        for (j = 0; sdl_audio_fused_filters[j].filter != NULL; j++) {
+            if (sdl_audio_fused_filters[j].filter == filter) {
+                fused = &sdl_audio_fused_filters[j];
+                break;
+            }
+        }
+
+        if (filter == SDL_ResampleCVT) {
+            const SDL_bool converting = (params->resample_src_filter || params->resample_dst_filter) ? SDL_TRUE : SDL_FALSE;
+            SDL_LogDebug(SDL_LOG_CATEGORY_AUDIO, "  %d: resample %dHz -> %dHz, %d channels, quality %d%s%s%s%s%s", i + 1,
+                         params->src_rate, params->dst_rate, params->resample_channels, (int) params->quality,
+                         converting ? ", " : "", converting ? SDL_GetAudioFormatName(params->resample_src_fmt) : "",
+                         converting ? " -> " : "", converting ? SDL_GetAudioFormatName(params->resample_dst_fmt) : "",
+                         converting ? " (fused)" : "");
+            format = params->resample_dst_fmt;
+        } else if (filter == SDL_ConvertChannels) {
+            SDL_LogDebug(SDL_LOG_CATEGORY_AUDIO, "  %d: remix %d -> %d channels, %s matrix", i + 1,
+                         params->remix_src_channels, params->remix_dst_channels, matrix);
+        } else if (fused) {
+            SDL_LogDebug(SDL_LOG_CATEGORY_AUDIO, "  %d: %s -> %s, remix %d -> %d channels, %s matrix (fused)", i + 1,
+                         SDL_GetAudioFormatName(format), SDL_GetAudioFormatName(fused->dst_fmt),
+                         fused->src_channels, fused->dst_channels, matrix);
+            format = fused->dst_fmt;
+        } else {
+            /* type conversions only happen going into and out of (mid_fmt). */
+            const SDL_AudioFormat next = (format != mid_fmt) ? mid_fmt : dst_fmt;
+            SDL_LogDebug(SDL_LOG_CATEGORY_AUDIO, "  %d: %s -> %s%s", i + 1,
+                         SDL_GetAudioFormatName(format), SDL_GetAudioFormatName(next),
+                         (SDL_HandTunedTypeCVT(format, next) == filter) ? " (hand-tuned)" : "");
+            format = next;
+        }
+    }
+}
 
 /* Creates a set of audio filters to convert from one format to another.
    Returns -1 if the format conversion is not supported, 0 if there's
-   no conversion needed, or 1 if the audio filter is set up.
+   no conversion needed, or 1 if the audio filter is set up. A (matrix)
+   remixes the channels even if the counts match; NULL uses the default.
+
+   Data is converted to float once, remixed and resampled there, and
+   converted to the final format once. Remixing and resampling both work
+   on every channel of every frame, so whichever makes fewer channels
+   goes first: a downmix before the resampler, an upmix after it.
 */
 
-int
-SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
-                  SDL_AudioFormat src_fmt, Uint8 src_channels, int src_rate,
-                  SDL_AudioFormat dst_fmt, Uint8 dst_channels, int dst_rate)
+static int
+SDL_BuildAudioCVTWithMatrix(SDL_AudioCVT * cvt,
+                            SDL_AudioFormat src_fmt, Uint8 src_channels, int src_rate,
+                            SDL_AudioFormat dst_fmt, Uint8 dst_channels, int dst_rate,
+                            const SDL_ChannelMatrix *matrix)
 {
-    /*
-     * !!! FIXME: reorder filters based on which grow/shrink the buffer.
-     * !!! FIXME: ideally, we should do everything that shrinks the buffer
-     * !!! FIXME: first, so we don't have to process as many bytes in a given
-     * !!! FIXME: filter and abuse the CPU cache less. This might not be as
-     * !!! FIXME: good in practice as it sounds in theory, though.
-     */
+    const SDL_bool upmix = (dst_channels > src_channels) ? SDL_TRUE : SDL_FALSE;
+    SDL_bool remixed = SDL_FALSE;
+    SDL_AudioCVTParams params;
+    SDL_AudioFilter fused;
+    SDL_AudioFormat mid_fmt, fused_fmt, format;
 
     /* Sanity check target pointer */
     if (cvt == NULL) {
@@ -1033,6 +1714,8 @@ SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
 #endif
 
     /* Start off with no conversion necessary */
+    SDL_SetAudioCVTParams(cvt, NULL);
+    SDL_zero(params);
     SDL_zerop(cvt);
     cvt->src_format = src_fmt;
     cvt->dst_format = dst_fmt;
@@ -1043,68 +1726,86 @@ SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
     cvt->len_ratio = 1.0;
     cvt->rate_incr = ((double) dst_rate) / ((double) src_rate);
 
-    /* Convert data types, if necessary. Updates (cvt). */
-    if (SDL_BuildAudioTypeCVT(cvt, src_fmt, dst_fmt) == -1) {
-        return -1;              /* shouldn't happen, but just in case... */
+    /* Remixing and resampling only work on float data, so if we need
+       either, convert to float first and to the final format last. */
+    if ((src_rate != dst_rate) || (src_channels != dst_channels) || matrix) {
+        mid_fmt = AUDIO_F32SYS;
+    } else {
+        mid_fmt = dst_fmt;
+    }
+
+    /* A fused converter does the type conversion and the remix on its side
+       of the resampler in one pass; without resampling, the whole thing. */
+    if (src_rate == dst_rate) {
+        fused = SDL_FindFusedAudioFilter(src_fmt, src_channels, dst_fmt, dst_channels);
+        fused_fmt = dst_fmt;
+    } else if (!upmix) {
+        fused = SDL_FindFusedAudioFilter(src_fmt, src_channels, mid_fmt, dst_channels);
+        fused_fmt = mid_fmt;
+    } else {
+        fused = SDL_FindFusedAudioFilter(mid_fmt, src_channels, dst_fmt, dst_channels);
+        fused_fmt = dst_fmt;
+    }
+
+    format = src_fmt;
+    if (fused && ((src_rate == dst_rate) || !upmix)) {
+        if (SDL_BuildAudioFusedCVT(cvt, &params, fused, src_fmt, src_channels, fused_fmt, dst_channels, matrix) == -1) {
+            return -1;
+        }
+        format = fused_fmt;
+        remixed = SDL_TRUE;
+    } else if (!upmix) {
+        /* Convert data types and downmix, if necessary. Updates (cvt). */
+        if ((src_channels != dst_channels) || matrix) {
+            if (SDL_BuildAudioTypeCVT(cvt, src_fmt, mid_fmt) == -1) {
+                return -1;              /* shouldn't happen, but just in case... */
+            }
+            format = mid_fmt;
+            if (SDL_BuildAudioChannelCVT(cvt, &params, src_channels, dst_channels, matrix) == -1) {
+                return -1;
+            }
+        }
+        remixed = SDL_TRUE;
+    }
+
+    /* Do rate conversion, if necessary, converting data types on the way
+       in and out if nothing else has to. Updates (cvt). */
+    if (src_rate != dst_rate) {
+        const SDL_AudioFormat resampled_fmt = remixed ? dst_fmt : mid_fmt;
+        if (SDL_BuildAudioResampleCVT(cvt, &params, remixed ? dst_channels : src_channels,
+                                      src_rate, dst_rate, format, resampled_fmt) == -1) {
+            return -1;
+        }
+        format = resampled_fmt;
+    }
+
+    if (!remixed) {
+        if (fused) {
+            if (SDL_BuildAudioFusedCVT(cvt, &params, fused, mid_fmt, src_channels, dst_fmt, dst_channels, matrix) == -1) {
+                return -1;
+            }
+            format = dst_fmt;
+        } else {
+            /* Convert data types and upmix. Updates (cvt). */
+            if (SDL_BuildAudioTypeCVT(cvt, format, mid_fmt) == -1) {
+                return -1;              /* shouldn't happen, but just in case... */
+            }
+            format = mid_fmt;
+            if (SDL_BuildAudioChannelCVT(cvt, &params, src_channels, dst_channels, matrix) == -1) {
+                return -1;
+            }
+        }
     }
 
-    /* Channel conversion */
-    if (src_channels != dst_channels) {
-        if ((src_channels == 1) && (dst_channels > 1)) {
-            cvt->filters[cvt->filter_index++] = SDL_ConvertStereo;
-            cvt->len_mult *= 2;
-            src_channels = 2;
-            cvt->len_ratio *= 2;
-        }
-        if ((src_channels == 2) && (dst_channels == 6)) {
-            cvt->filters[cvt->filter_index++] = SDL_ConvertSurround;
-            src_channels = 6;
-            cvt->len_mult *= 3;
-            cvt->len_ratio *= 3;
-        }
-        if ((src_channels == 2) && (dst_channels == 4)) {
-            cvt->filters[cvt->filter_index++] = SDL_ConvertSurround_4;
-            src_channels = 4;
-            cvt->len_mult *= 2;
-            cvt->len_ratio *= 2;
-        }
-        while ((src_channels * 2) <= dst_channels) {
-            cvt->filters[cvt->filter_index++] = SDL_ConvertStereo;
-            cvt->len_mult *= 2;
-            src_channels *= 2;
-            cvt->len_ratio *= 2;
-        }
-        if ((src_channels == 6) && (dst_channels <= 2)) {
-            cvt->filters[cvt->filter_index++] = SDL_ConvertStrip;
-            src_channels = 2;
-            cvt->len_ratio /= 3;
-        }
-        if ((src_channels == 6) && (dst_channels == 4)) {
-            cvt->filters[cvt->filter_index++] = SDL_ConvertStrip_2;
-            src_channels = 4;
-            cvt->len_ratio /= 2;
-        }
-        /* This assumes that 4 channel audio is in the format:
-           Left {front/back} + Right {front/back}
-           so converting to L/R stereo works properly.
-         */
-        while (((src_channels % 2) == 0) &&
-               ((src_channels / 2) >= dst_channels)) {
-            cvt->filters[cvt->filter_index++] = SDL_ConvertMono;
-            src_channels /= 2;
-            cvt->len_ratio /= 2;
-        }
-        if (src_channels != dst_channels) {
-            /* Uh oh.. */ ;
-        }
-    }
-
-    /* Do rate conversion, if necessary. Updates (cvt). */
-    if (SDL_BuildAudioResampleCVT(cvt, dst_channels, src_rate, dst_rate) ==
-        -1) {
+    if (SDL_BuildAudioTypeCVT(cvt, format, dst_fmt) == -1) {
         return -1;              /* shouldn't happen, but just in case... */
     }
 
+    if (SDL_LogGetPriority(SDL_LOG_CATEGORY_AUDIO) <= SDL_LOG_PRIORITY_DEBUG) {
+        SDL_LogAudioCVT(cvt, &params, src_fmt, src_channels, src_rate,
+                        dst_fmt, dst_channels, dst_rate, mid_fmt);
+    }
+
     /* Set up the filter information */
     if (cvt->filter_index != 0) {
         cvt->needed = 1;
@@ -1113,9 +1814,516 @@ SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
         cvt->len = 0;
         cvt->buf = NULL;
         cvt->filters[cvt->filter_index] = NULL;
+        if ((params.src_rate || params.remix_src_channels) && (SDL_SetAudioCVTParams(cvt, &params) < 0)) {
+            return -1;
+        }
     }
     return (cvt->needed);
 }
 
+int
+SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
+                  SDL_AudioFormat src_fmt, Uint8 src_channels, int src_rate,
+                  SDL_AudioFormat dst_fmt, Uint8 dst_channels, int dst_rate)
+{
+    return SDL_BuildAudioCVTWithMatrix(cvt, src_fmt, src_channels, src_rate,
+                                       dst_fmt, dst_channels, dst_rate, NULL);
+}
+
+
+/* Audio streams: stateful conversion of arbitrarily-sized chunks. */
+
+typedef int (*SDL_ResampleAudioStreamFunc)(SDL_AudioStream *stream, const float *inbuf, const int inframes, float *outbuf);
+typedef void (*SDL_ResetAudioStreamResamplerFunc)(SDL_AudioStream *stream);
+typedef void (*SDL_CleanupAudioStreamResamplerFunc)(SDL_AudioStream *stream);
+
+struct _SDL_AudioStream
+{
+    SDL_AudioCVT cvt_before_resampling;
+    SDL_AudioCVT cvt_after_resampling;
+    SDL_AudioFormat src_format;
+    Uint8 src_channels;
+    int src_rate;
+    SDL_AudioFormat dst_format;
+    Uint8 dst_channels;
+    int dst_rate;
+    int src_sample_frame_size;
+    int dst_sample_frame_size;
+    SDL_ChannelMatrix *channel_matrix;  /* NULL for the default remix. */
+    Uint8 resample_channels;  /* the fewer of src and dst; remixing happens on that side. */
+
+    /* Resampler history, then scratch space for the first conversion pass. */
+    Uint8 *work_buffer;
+    int work_buffer_len;
+
+    /* Converted data waiting to be read; lives in [queue_head, queue_head+queue_len). */
+    Uint8 *queue;
+    int queue_head;
+    int queue_len;
+    int queue_allocation;
+
+    /* Resampler state. (resampler_func) is NULL if rates match. */
+    Uint64 total_frames_in;   /* frames fed to the resampler since last reset. */
+    Uint64 total_frames_out;  /* frames produced by the resampler since last reset. */
+    int resampler_padding;    /* frames of history/lookahead the resampler needs. */
+    void *resampler_state;
+    SDL_ResampleAudioStreamFunc resampler_func;
+    SDL_ResetAudioStreamResamplerFunc reset_resampler_func;
+    SDL_CleanupAudioStreamResamplerFunc cleanup_resampler_func;
+};
+
+/* The stream's resampler keeps its own filter, and the work buffer always
+   starts with (resampler_padding) frames of history from the previous
+   chunk, so the filter can reach back across chunk boundaries. Position is
+   kept relative to the start of that history. */
+typedef struct
+{
+    SDL_ResampleFilter *filter;
+    Sint64 position;
+} SDL_SincResamplerState;
+
+static int
+SDL_ResampleAudioStream_Sinc(SDL_AudioStream *stream, const float *inbuf, const int inframes, float *outbuf)
+{
+    SDL_SincResamplerState *state = (SDL_SincResamplerState *) stream->resampler_state;
+    const SDL_ResampleFilter *filter = state->filter;
+    const int chans = (int) stream->resample_channels;
+    const int taps = filter->taps;
+    const Sint64 last_start = (Sint64) (inframes - taps);
+    float scratch[SDL_RESAMPLER_MAX_TAPS];
+    Sint64 pos = state->position;
+    float *dst = outbuf;
+    int outframes = 0;
+
+    while (SDL_TRUE) {
+        const Sint64 start = (pos / filter->frame_phases) - (filter->half_taps - 1);
+        if (start > last_start) {
+            break;  /* the rest needs input we don't have yet. */
+        }
+        SDL_assert(start >= 0);
+        filter->resample_frame(inbuf + (start * chans),
+                               SDL_GetResamplerCoeffs(filter, pos % filter->frame_phases, scratch),
+                               taps, chans, dst);
+        dst += chans;
+        pos += filter->increment;
+        outframes++;
+    }
+
+    /* the last (taps) frames become the history for the next chunk. */
+    state->position = pos - (last_start * filter->frame_phases);
+
+    return outframes;
+}
+
+static void
+SDL_ResetAudioStreamResampler_Sinc(SDL_AudioStream *stream)
+{
+    SDL_SincResamplerState *state = (SDL_SincResamplerState *) stream->resampler_state;
+    /* the first real frame comes right after the (silent) history. */
+    state->position = ((Sint64) stream->resampler_padding) * state->filter->frame_phases;
+}
+
+static void
+SDL_CleanupAudioStreamResampler_Sinc(SDL_AudioStream *stream)
+{
+    SDL_SincResamplerState *state = (SDL_SincResamplerState *) stream->resampler_state;
+    if (state) {
+        SDL_FreeResampleFilter(state->filter);
+        SDL_free(state);
+    }
+}
+
+static int
+SDL_SetupAudioStreamResampler_Sinc(SDL_AudioStream *stream)
+{
+    SDL_SincResamplerState *state;
+
+    if ((stream->src_rate > SDL_RESAMPLER_MAX_RATE) || (stream->dst_rate > SDL_RESAMPLER_MAX_RATE)) {
+        return SDL_SetError("Sample rate is too high to resample");
+    }
+
+    state = (SDL_SincResamplerState *) SDL_calloc(1, sizeof (SDL_SincResamplerState));
+    if (!state) {
+        return SDL_OutOfMemory();
+    }
+    stream->resampler_state = state;
+    stream->cleanup_resampler_func = SDL_CleanupAudioStreamResampler_Sinc;
+
+    state->filter = SDL_CreateResampleFilter(stream->src_rate, stream->dst_rate, SDL_GetResamplingQuality());
+    if (!state->filter) {
+        return -1;
+    }
+
+    stream->resampler_padding = state->filter->taps;
+    stream->resampler_func = SDL_ResampleAudioStream_Sinc;
+    stream->reset_resampler_func = SDL_ResetAudioStreamResampler_Sinc;
+    SDL_ResetAudioStreamResampler_Sinc(stream);
+    return 0;
+}
+
+/* Without resampling, one conversion goes straight into the queue;
+   otherwise, data is converted to float (and downmixed), resampled, then
+   (upmixed and) converted to the final format. */
+static int
+SDL_BuildAudioStreamInputCVT(const SDL_AudioStream *stream, SDL_AudioCVT *cvt,
+                             const SDL_ChannelMatrix *matrix)
+{
+    if (stream->src_rate == stream->dst_rate) {
+        return SDL_BuildAudioCVTWithMatrix(cvt, stream->src_format, stream->src_channels, stream->src_rate,
+                                           stream->dst_format, stream->dst_channels, stream->dst_rate, matrix);
+    }
+    return SDL_BuildAudioCVTWithMatrix(cvt, stream->src_format, stream->src_channels, stream->src_rate,
+                                       AUDIO_F32SYS, stream->resample_channels, stream->src_rate,
+                                       (stream->resample_channels == stream->dst_channels) ? matrix : NULL);
+}
+
+static int
+SDL_BuildAudioStreamOutputCVT(const SDL_AudioStream *stream, SDL_AudioCVT *cvt,
+                              const SDL_ChannelMatrix *matrix)
+{
+    return SDL_BuildAudioCVTWithMatrix(cvt, AUDIO_F32SYS, stream->resample_channels, stream->dst_rate,
+                                       stream->dst_format, stream->dst_channels, stream->dst_rate,
+                                       (stream->resample_channels != stream->dst_channels) ? matrix : NULL);
+}
+
+SDL_AudioStream *
+SDL_NewAudioStream(const SDL_AudioFormat src_format,
+                   const Uint8 src_channels,
+                   const int src_rate,
+                   const SDL_AudioFormat dst_format,
+                   const Uint8 dst_channels,
+                   const int dst_rate)
+{
+    SDL_AudioStream *retval;
+
+    retval = (SDL_AudioStream *) SDL_calloc(1, sizeof (SDL_AudioStream));
+    if (!retval) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+
+    retval->src_format = src_format;
+    retval->src_channels = src_channels;
+    retval->src_rate = src_rate;
+    retval->src_sample_frame_size = (SDL_AUDIO_BITSIZE(src_format) / 8) * src_channels;
+    retval->dst_format = dst_format;
+    retval->dst_channels = dst_channels;
+    retval->dst_rate = dst_rate;
+    retval->dst_sample_frame_size = (SDL_AUDIO_BITSIZE(dst_format) / 8) * dst_channels;
+    retval->resample_channels = SDL_min(src_channels, dst_channels);
+
+    if (SDL_BuildAudioStreamInputCVT(retval, &retval->cvt_before_resampling, NULL) < 0) {
+        SDL_FreeAudioStream(retval);
+        return NULL;
+    }
+
+    if (src_rate != dst_rate) {
+        if (SDL_BuildAudioStreamOutputCVT(retval, &retval->cvt_after_resampling, NULL) < 0) {
+            SDL_FreeAudioStream(retval);
+            return NULL;
+        }
+
+        if (SDL_SetupAudioStreamResampler_Sinc(retval) < 0) {
+            SDL_FreeAudioStream(retval);
+            return NULL;
+        }
+
+        /* the history starts out silent. */
+        retval->work_buffer_len = retval->resampler_padding * retval->resample_channels * sizeof (float);
+        retval->work_buffer = (Uint8 *) SDL_calloc(1, retval->work_buffer_len);
+        if (!retval->work_buffer) {
+            SDL_FreeAudioStream(retval);
+            SDL_OutOfMemory();
+            return NULL;
+        }
+    }
+
+    return retval;
+}
+
+/* Make sure there are (len) free bytes after the queued data, and return a
+   pointer to them. This only allocates if the queue has never been this
+   full before, so steady state streaming doesn't touch the heap. */
+static Uint8 *
+SDL_ReserveAudioStreamQueue(SDL_AudioStream *stream, const int len)
+{
+    const int needed = stream->queue_len + len;
+
+    if ((stream->queue_head + needed) > stream->queue_allocation) {
+        if (needed <= stream->queue_allocation) {
+            /* there's room if we slide the unread data to the front. */
+            SDL_memmove(stream->queue, stream->queue + stream->queue_head, stream->queue_len);
+        } else {
+            int newlen = stream->queue_allocation ? stream->queue_allocation : 1024;
+            Uint8 *ptr;
+            while (newlen < needed) {
+                newlen *= 2;
+            }
+            ptr = (Uint8 *) SDL_malloc(newlen);
+            if (!ptr) {
+                SDL_OutOfMemory();
+                return NULL;
+            }
+            if (stream->queue_len) {
+                SDL_memcpy(ptr, stream->queue + stream->queue_head, stream->queue_len);
+            }
+            SDL_free(stream->queue);
+            stream->queue = ptr;
+            stream->queue_allocation = newlen;
+        }
+        stream->queue_head = 0;
+    }
+
+    return stream->queue + stream->queue_head + stream->queue_len;
+}
+
+static Uint8 *
+SDL_EnsureAudioStreamWorkBuffer(SDL_AudioStream *stream, const int newlen)
+{
+    if (stream->work_buffer_len < newlen) {
+        Uint8 *ptr = (Uint8 *) SDL_realloc(stream->work_buffer, newlen);
+        if (!ptr) {
+            SDL_OutOfMemory();
+            return NULL;
+        }
+        stream->work_buffer = ptr;
+        stream->work_buffer_len = newlen;
+    }
+    return stream->work_buffer;
+}
+
+/* The work buffer holds (resampler_padding) frames of history followed by
+   (newframes) frames of float data at (resample_channels). Run it
+   through the resampler and the final conversion, appending the result to
+   the queue. If (maxframes) >= 0, no more than that many frames are kept. */
+static int
+SDL_AudioStreamResample(SDL_AudioStream *stream, const int newframes, const Sint64 maxframes)
+{
+    const int framelen = stream->resample_channels * sizeof (float);
+    const int inframes = stream->resampler_padding + newframes;
+    const Sint64 maxout = ((((Sint64) inframes) * stream->dst_rate) / stream->src_rate) + 2;
+    SDL_AudioCVT *cvt = &stream->cvt_after_resampling;
+    float *workbuf = (float *) stream->work_buffer;
+    Uint8 *dst;
+    int outframes;
+
+    dst = SDL_ReserveAudioStreamQueue(stream, (int) (maxout * framelen * cvt->len_mult));
+    if (!dst) {
+        return -1;
+    }
+
+    outframes = stream->resampler_func(stream, workbuf, inframes, (float *) dst);
+    SDL_assert(outframes <= maxout);
+    if ((maxframes >= 0) && (outframes > maxframes)) {
+        outframes = (int) maxframes;
+    }
+    stream->total_frames_out += outframes;
+
+    /* the end of this chunk is the history for the next one. */
+    SDL_memmove(workbuf, workbuf + (newframes * stream->resample_channels),
+                stream->resampler_padding * framelen);
+
+    /* An upmix grows the data, but we reserved room for (len_mult). */
+    cvt->buf = dst;
+    cvt->len = outframes * framelen;
+    if (SDL_ConvertAudio(cvt) < 0) {
+        return -1;
+    }
+    stream->queue_len += cvt->len_cvt;
+    return 0;
+}
+
+static void
+SDL_ResetAudioStreamResampling(SDL_AudioStream *stream)
+{
+    stream->total_frames_in = stream->total_frames_out = 0;
+    SDL_memset(stream->work_buffer, '\0', stream->resampler_padding * stream->resample_channels * sizeof (float));
+    stream->reset_resampler_func(stream);
+}
+
+int
+SDL_AudioStreamPut(SDL_AudioStream *stream, const void *buf, int len)
+{
+    SDL_AudioCVT *cvt;
+    Uint8 *workbuf;
+    int histlen;
+
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    } else if (!buf) {
+        return SDL_InvalidParamError("buf");
+    } else if (len < 0) {
+        return SDL_InvalidParamError("len");
+    } else if (len == 0) {
+        return 0;  /* nothing to do. */
+    } else if ((len % stream->src_sample_frame_size) != 0) {
+        return SDL_SetError("Can't add partial sample frames");
+    }
+
+    cvt = &stream->cvt_before_resampling;
+
+    if (!stream->resampler_func) {
+        /* Convert in-place right at the end of the queue; no extra copies. */
+        workbuf = SDL_ReserveAudioStreamQueue(stream, len * cvt->len_mult);
+        if (!workbuf) {
+            return -1;
+        }
+        SDL_memcpy(workbuf, buf, len);
+        cvt->buf = workbuf;
+        cvt->len = len;
+        if (SDL_ConvertAudio(cvt) < 0) {
+            return -1;
+        }
+        stream->queue_len += cvt->len_cvt;
+        return 0;
+    }
+
+    /* Convert to float after the resampler's history, so it's contiguous. */
+    histlen = stream->resampler_padding * stream->resample_channels * sizeof (float);
+    workbuf = SDL_EnsureAudioStreamWorkBuffer(stream, histlen + (len * cvt->len_mult));
+    if (!workbuf) {
+        return -1;
+    }
+    SDL_memcpy(workbuf + histlen, buf, len);
+    cvt->buf = workbuf + histlen;
+    cvt->len = len;
+    if (SDL_ConvertAudio(cvt) < 0) {
+        return -1;
+    }
+
+    stream->total_frames_in += len / stream->src_sample_frame_size;
+    return SDL_AudioStreamResample(stream, cvt->len_cvt / (stream->resample_channels * sizeof (float)), -1);
+}
+
+int
+SDL_AudioStreamFlush(SDL_AudioStream *stream)
+{
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    }
+
+    if (stream->resampler_func && stream->total_frames_in) {
+        /* Push silence through the resampler to get the last frames out,
+           but don't keep more than the input actually covers. */
+        const int framelen = stream->resample_channels * sizeof (float);
+        const int padframes = stream->resampler_padding;
+        const Sint64 expected = (Sint64) (((stream->total_frames_in * stream->dst_rate) + stream->src_rate - 1) / stream->src_rate);
+        Uint8 *workbuf = SDL_EnsureAudioStreamWorkBuffer(stream, 2 * padframes * framelen);
+        if (!workbuf) {
+            return -1;
+        }
+        SDL_memset(workbuf + (padframes * framelen), '\0', padframes * framelen);
+        if (SDL_AudioStreamResample(stream, padframes, expected - (Sint64) stream->total_frames_out) < 0) {
+            return -1;
+        }
+
+        /* Anything put after this is a new stream, as far as the resampler cares. */
+        SDL_ResetAudioStreamResampling(stream);
+    }
+
+    return 0;
+}
+
+int
+SDL_AudioStreamGet(SDL_AudioStream *stream, void *buf, int len)
+{
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    } else if (!buf) {
+        return SDL_InvalidParamError("buf");
+    } else if (len < 0) {
+        return SDL_InvalidParamError("len");
+    }
+
+    /* only hand out complete sample frames. */
+    len -= len % stream->dst_sample_frame_size;
+    if (len > stream->queue_len) {
+        len = stream->queue_len;
+    }
+
+    if (len > 0) {
+        SDL_memcpy(buf, stream->queue + stream->queue_head, len);
+        stream->queue_head += len;
+        stream->queue_len -= len;
+        if (stream->queue_len == 0) {
+            stream->queue_head = 0;
+        }
+    }
+
+    return len;
+}
+
+int
+SDL_AudioStreamAvailable(SDL_AudioStream *stream)
+{
+    return stream ? stream->queue_len : 0;
+}
+
+void
+SDL_AudioStreamClear(SDL_AudioStream *stream)
+{
+    if (!stream) {
+        SDL_InvalidParamError("stream");
+    } else {
+        stream->queue_head = stream->queue_len = 0;
+        if (stream->resampler_func) {
+            SDL_ResetAudioStreamResampling(stream);
+        }
+    }
+}
+
+int
+SDL_AudioStreamSetChannelMatrix(SDL_AudioStream *stream, const float *matrix)
+{
+    SDL_ChannelMatrix *newmatrix = NULL;
+    SDL_AudioCVT cvt, cvt_after;
+
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    }
+
+    if (matrix) {
+        newmatrix = SDL_CreateChannelMatrix(stream->src_channels, stream->dst_channels, matrix);
+        if (!newmatrix) {
+            return -1;
+        }
+    }
+
+    /* the conversions around the resampler keep no state, so just rebuild them. */
+    if (SDL_BuildAudioStreamInputCVT(stream, &cvt, newmatrix) < 0) {
+        SDL_free(newmatrix);
+        return -1;
+    }
+    if (stream->resampler_func && (SDL_BuildAudioStreamOutputCVT(stream, &cvt_after, newmatrix) < 0)) {
+        SDL_SetAudioCVTParams(&cvt, NULL);
+        SDL_free(newmatrix);
+        return -1;
+    }
+
+    SDL_free(stream->channel_matrix);
+    stream->channel_matrix = newmatrix;
+    SDL_MoveAudioCVT(&stream->cvt_before_resampling, &cvt);
+    if (stream->resampler_func) {
+        SDL_MoveAudioCVT(&stream->cvt_after_resampling, &cvt_after);
+    }
+    return 0;
+}
+
+void
+SDL_FreeAudioStream(SDL_AudioStream *stream)
+{
+    if (stream) {
+        if (stream->cleanup_resampler_func) {
+            stream->cleanup_resampler_func(stream);
+        }
+        SDL_SetAudioCVTParams(&stream->cvt_before_resampling, NULL);
+        SDL_SetAudioCVTParams(&stream->cvt_after_resampling, NULL);
+        SDL_free(stream->channel_matrix);
+        SDL_free(stream->work_buffer);
+        SDL_free(stream->queue);
+        SDL_free(stream);
+    }
+}
+
 
 /* vi: set ts=4 sw=4 expandtab: */
@@ -26,6 +26,7 @@
 #include "SDL_timer.h"
 #include "SDL_audio.h"
 #include "SDL_sysaudio.h"
+#include "SDL_audio_c.h"
 
 /* This table is used to add two sound values together and pin
  * the value to avoid overflow.  (used with permission from ARDI)
@@ -85,11 +86,122 @@ static const Uint8 mix8[] = {
 #define ADJUST_VOLUME(s, v) (s = (s*v)/SDL_MIX_MAXVOLUME)
 #define ADJUST_VOLUME_U8(s, v)  (s = (((s-128)*v)/SDL_MIX_MAXVOLUME)+128)
 
+#ifdef __SSE2__
+/*
+ * SSE2 versions of the mixing loops for native byte order. Each handles as
+ *  many whole vectors as it can and returns how many samples that was; the
+ *  scalar loop finishes the rest. The results are identical to the scalar
+ *  code: volume is applied with the same truncating division, and clamping
+ *  is a saturating add (S8/S16) or min/max in a wider type (S32/F32).
+ *  Only valid for volume <= SDL_MIX_MAXVOLUME, where nothing overflows.
+ */
+
+/* (x * volume) / SDL_MIX_MAXVOLUME, rounding toward zero like C does. */
+#define ADJUST_VOLUME_SSE2(x, bits) \
+    _mm_srai_epi##bits(_mm_add_epi##bits(x, _mm_and_si128(_mm_srai_epi##bits(x, bits - 1), round)), 7)
+
+static Uint32
+SDL_MixAudio_S8_SSE2(Sint8 * dst, const Sint8 * src, const Uint32 len, const int volume)
+{
+    const __m128i vol = _mm_set1_epi16((Sint16) volume);
+    const __m128i round = _mm_set1_epi16(SDL_MIX_MAXVOLUME - 1);
+    Uint32 i;
+
+    for (i = 0; (i + 16) <= len; i += 16) {
+        const __m128i s = _mm_loadu_si128((const __m128i *) (src + i));
+        /* sign-extend to 16 bits, where (sample * volume) fits. */
+        __m128i lo = _mm_mullo_epi16(_mm_srai_epi16(_mm_unpacklo_epi8(s, s), 8), vol);
+        __m128i hi = _mm_mullo_epi16(_mm_srai_epi16(_mm_unpackhi_epi8(s, s), 8), vol);
+        lo = ADJUST_VOLUME_SSE2(lo, 16);
+        hi = ADJUST_VOLUME_SSE2(hi, 16);
+        _mm_storeu_si128((__m128i *) (dst + i),
+                         _mm_adds_epi8(_mm_loadu_si128((const __m128i *) (dst + i)), _mm_packs_epi16(lo, hi)));
+    }
+    return i;
+}
+
+static Uint32
+SDL_MixAudio_S16_SSE2(Sint16 * dst, const Sint16 * src, const Uint32 len, const int volume)
+{
+    const __m128i vol = _mm_set1_epi16((Sint16) volume);
+    const __m128i round = _mm_set1_epi32(SDL_MIX_MAXVOLUME - 1);
+    Uint32 i;
+
+    for (i = 0; (i + 8) <= len; i += 8) {
+        const __m128i s = _mm_loadu_si128((const __m128i *) (src + i));
+        /* full 32-bit products, from the low and high halves. */
+        const __m128i plo = _mm_mullo_epi16(s, vol);
+        const __m128i phi = _mm_mulhi_epi16(s, vol);
+        __m128i lo = _mm_unpacklo_epi16(plo, phi);
+        __m128i hi = _mm_unpackhi_epi16(plo, phi);
+        lo = ADJUST_VOLUME_SSE2(lo, 32);
+        hi = ADJUST_VOLUME_SSE2(hi, 32);
+        _mm_storeu_si128((__m128i *) (dst + i),
+                         _mm_adds_epi16(_mm_loadu_si128((const __m128i *) (dst + i)), _mm_packs_epi32(lo, hi)));
+    }
+    return i;
+}
+
+static Uint32
+SDL_MixAudio_S32_SSE2(Sint32 * dst, const Sint32 * src, const Uint32 len, const int volume)
+{
+    /* Doubles hold every intermediate value exactly, including the sum
+       before clamping, so this matches the scalar 64-bit math. */
+    const __m128d vol = _mm_set1_pd(((double) volume) / SDL_MIX_MAXVOLUME);
+    const __m128d max_audioval = _mm_set1_pd(2147483647.0);
+    const __m128d min_audioval = _mm_set1_pd(-2147483648.0);
+    Uint32 i;
+
+    for (i = 0; (i + 4) <= len; i += 4) {
+        const __m128i s = _mm_loadu_si128((const __m128i *) (src + i));
+        const __m128i d = _mm_loadu_si128((const __m128i *) (dst + i));
+        /* truncating to int and back rounds toward zero, like the division. */
+        __m128d lo = _mm_cvtepi32_pd(_mm_cvttpd_epi32(_mm_mul_pd(_mm_cvtepi32_pd(s), vol)));
+        __m128d hi = _mm_cvtepi32_pd(_mm_cvttpd_epi32(_mm_mul_pd(_mm_cvtepi32_pd(_mm_srli_si128(s, 8)), vol)));
+        lo = _mm_add_pd(lo, _mm_cvtepi32_pd(d));
+        hi = _mm_add_pd(hi, _mm_cvtepi32_pd(_mm_srli_si128(d, 8)));
+        lo = _mm_min_pd(_mm_max_pd(lo, min_audioval), max_audioval);
+        hi = _mm_min_pd(_mm_max_pd(hi, min_audioval), max_audioval);
+        _mm_storeu_si128((__m128i *) (dst + i), _mm_unpacklo_epi64(_mm_cvttpd_epi32(lo), _mm_cvttpd_epi32(hi)));
+    }
+    return i;
+}
+
+static Uint32
+SDL_MixAudio_F32_SSE2(float * dst, const float * src, const Uint32 len, const int volume)
+{
+    const __m128 fmaxvolume = _mm_set1_ps(1.0f / ((float) SDL_MIX_MAXVOLUME));
+    const __m128 fvolume = _mm_set1_ps((float) volume);
+    const __m128 max_audioval = _mm_set1_ps(3.402823466e+38F);
+    const __m128 min_audioval = _mm_set1_ps(-3.402823466e+38F);
+    Uint32 i;
+
+    /* A float add rounds the same as adding in double and converting back,
+       and an overflow to infinity clamps to the same value. The limits go
+       first in min/max so a NaN passes through, as it does in the scalar
+       comparisons. */
+    for (i = 0; (i + 4) <= len; i += 4) {
+        const __m128 s = _mm_mul_ps(_mm_mul_ps(_mm_loadu_ps(src + i), fvolume), fmaxvolume);
+        __m128 sum = _mm_add_ps(s, _mm_loadu_ps(dst + i));
+        sum = _mm_max_ps(min_audioval, _mm_min_ps(max_audioval, sum));
+        _mm_storeu_ps(dst + i, sum);
+    }
+    return i;
+}
+
+#undef ADJUST_VOLUME_SSE2
+#endif /* __SSE2__ */
+
 
 void
 SDL_MixAudioFormat(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
                    Uint32 len, int volume)
 {
+#ifdef __SSE2__
+    const SDL_bool use_sse2 = ((volume <= SDL_MIX_MAXVOLUME) &&
+                               (SDL_GetAudioCPUFeatures() & SDL_AUDIO_CPU_SSE2)) ? SDL_TRUE : SDL_FALSE;
+#endif
+
     if (volume == 0) {
         return;
     }
@@ -126,6 +238,14 @@ SDL_MixAudioFormat(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
 
             src8 = (Sint8 *) src;
             dst8 = (Sint8 *) dst;
+#ifdef __SSE2__
+            if (use_sse2) {
+                const Uint32 done = SDL_MixAudio_S8_SSE2(dst8, src8, len, volume);
+                src8 += done;
+                dst8 += done;
+                len -= done;
+            }
+#endif
             while (len--) {
                 src_sample = *src8;
                 ADJUST_VOLUME(src_sample, volume);
@@ -151,6 +271,14 @@ SDL_MixAudioFormat(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
             const int min_audioval = -(1 << (16 - 1));
 
             len /= 2;
+#if defined(__SSE2__) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+            if (use_sse2) {
+                const Uint32 done = SDL_MixAudio_S16_SSE2((Sint16 *) dst, (const Sint16 *) src, len, volume);
+                src += done * 2;
+                dst += done * 2;
+                len -= done;
+            }
+#endif
             while (len--) {
                 src1 = ((src[1]) << 8 | src[0]);
                 ADJUST_VOLUME(src1, volume);
@@ -212,6 +340,14 @@ SDL_MixAudioFormat(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
             const Sint64 min_audioval = -(((Sint64) 1) << (32 - 1));
 
             len /= 4;
+#if defined(__SSE2__) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+            if (use_sse2) {
+                const Uint32 done = SDL_MixAudio_S32_SSE2((Sint32 *) dst32, (const Sint32 *) src32, len, volume);
+                src32 += done;
+                dst32 += done;
+                len -= done;
+            }
+#endif
             while (len--) {
                 src1 = (Sint64) ((Sint32) SDL_SwapLE32(*src32));
                 src32++;
@@ -267,6 +403,14 @@ SDL_MixAudioFormat(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
             const double min_audioval = -3.402823466e+38F;
 
             len /= 4;
+#if defined(__SSE2__) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+            if (use_sse2) {
+                const Uint32 done = SDL_MixAudio_F32_SSE2(dst32, src32, len, volume);
+                src32 += done;
+                dst32 += done;
+                len -= done;
+            }
+#endif
             while (len--) {
                 src1 = ((SDL_SwapFloatLE(*src32) * fvolume) * fmaxvolume);
                 src2 = SDL_SwapFloatLE(*dst32);
@@ -318,4 +462,738 @@ SDL_MixAudioFormat(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
     }
 }
 
+/* The built-in mixer (SDL_CreateAudioVoice() and friends)... */
+
+static float
+get_voice_param(SDL_atomic_t *param)
+{
+    union { int i; float f; } u;
+    u.i = SDL_AtomicGet(param);
+    return u.f;
+}
+
+/* Acts on whatever the app asked for since the last buffer. A command
+   stays put until it's done, so SDL_IsAudioVoicePlaying() never sees a
+   gap between the command and (playing). A scheduled voice counts as
+   playing while it waits for its frame. */
+static SDL_bool
+take_voice_commands(SDL_AudioVoice *voice)
+{
+    int command;
+
+    while ((command = SDL_AtomicGet(&voice->command)) != 0) {
+        int sequence = 0;
+
+        if (command == SDL_AUDIOVOICE_PLAY_AT) {
+            Uint64 frame;
+            sequence = SDL_AtomicGet(&voice->start_sequence);
+            SDL_MemoryBarrierAcquire();
+            frame = (Uint64) (Uint32) SDL_AtomicGet(&voice->start_lo);
+            frame |= ((Uint64) (Uint32) SDL_AtomicGet(&voice->start_hi)) << 32;
+            SDL_MemoryBarrierAcquire();
+            if ((sequence & 1) || (SDL_AtomicGet(&voice->start_sequence) != sequence)) {
+                break;  /* the app's in the middle of it; try next buffer. */
+            }
+            voice->position = 0;
+            voice->start_frame = frame;
+            voice->scheduled = SDL_TRUE;
+            SDL_AtomicSet(&voice->playing, 1);
+        } else if (command == SDL_AUDIOVOICE_PLAY) {
+            voice->position = 0;
+            voice->scheduled = SDL_FALSE;
+            SDL_AtomicSet(&voice->playing, 1);
+        } else {
+            voice->scheduled = SDL_FALSE;
+            SDL_AtomicSet(&voice->playing, 0);
+        }
+        if (SDL_AtomicCAS(&voice->command, command, 0)) {
+            /* a reschedule that landed between our reads and the CAS
+               looks like the same command; put it back for next time. */
+            if ((command == SDL_AUDIOVOICE_PLAY_AT) && (SDL_AtomicGet(&voice->start_sequence) != sequence)) {
+                SDL_AtomicCAS(&voice->command, 0, SDL_AUDIOVOICE_PLAY_AT);
+            }
+            break;  /* otherwise the app changed its mind; do the new one. */
+        }
+    }
+    return SDL_AtomicGet(&voice->playing) ? SDL_TRUE : SDL_FALSE;
+}
+
+/* Mono output gets the average of both sides; anything past stereo only
+   gets the front left and right channels. Voices themselves are never more
+   than stereo: SDL_CreateAudioVoice() mixes bigger sounds down with
+   SDL_BuildAudioCVT()'s channel matrix, so (srcchannels - 1) is the right
+   side, or the mono sample again. */
+#define ACCUMULATE_VOICE_FRAME(dst, dstchannels, l, r, lgain, rgain) \
+    if (dstchannels == 1) { \
+        (dst)[0] += (((l) * (lgain)) + ((r) * (rgain))) * 0.5f; \
+    } else { \
+        (dst)[0] += (l) * (lgain); \
+        (dst)[1] += (r) * (rgain); \
+    }
+
+/* Mixes a stretch of a voice that plays at the device's rate. */
+static void
+mix_voice_run(float *dst, const int dstchannels, const float *src, const int srcchannels,
+              const Uint32 frames, const float lgain, const float rgain)
+{
+    Uint32 i = 0;
+
+#ifdef __SSE2__
+    if ((dstchannels == 2) && (SDL_GetAudioCPUFeatures() & SDL_AUDIO_CPU_SSE2)) {
+        const __m128 gain = _mm_setr_ps(lgain, rgain, lgain, rgain);
+        if (srcchannels == 2) {
+            for (; (i + 2) <= frames; i += 2) {
+                const __m128 s = _mm_mul_ps(_mm_loadu_ps(src + (i * 2)), gain);
+                _mm_storeu_ps(dst + (i * 2), _mm_add_ps(_mm_loadu_ps(dst + (i * 2)), s));
+            }
+        } else {
+            for (; (i + 4) <= frames; i += 4) {
+                /* each mono sample goes to both sides. */
+                const __m128 s = _mm_loadu_ps(src + i);
+                const __m128 lo = _mm_mul_ps(_mm_unpacklo_ps(s, s), gain);
+                const __m128 hi = _mm_mul_ps(_mm_unpackhi_ps(s, s), gain);
+                _mm_storeu_ps(dst + (i * 2), _mm_add_ps(_mm_loadu_ps(dst + (i * 2)), lo));
+                _mm_storeu_ps(dst + (i * 2) + 4, _mm_add_ps(_mm_loadu_ps(dst + (i * 2) + 4), hi));
+            }
+        }
+    }
+#endif
+
+    for (; i < frames; i++) {
+        const float *in = src + (i * srcchannels);
+        ACCUMULATE_VOICE_FRAME(dst + (i * dstchannels), dstchannels, in[0], in[srcchannels - 1], lgain, rgain);
+    }
+}
+
+/* How far a voice moves through its sound per output frame, in 32.32. */
+static Uint64
+get_voice_step(SDL_AudioVoice *voice, const int freq)
+{
+    const double rate = ((double) get_voice_param(&voice->ratio)) * voice->freq / freq;
+    return (Uint64) (rate * 4294967296.0);
+}
+
+/* For a scheduled voice, returns how many frames into this stretch (which
+   starts at (frame)) it starts, or (frames) if it starts later. A voice
+   that should have started already (the app scheduled it too late, or the
+   device was paused) skips what it missed, so it stays on the beat. */
+static Uint32
+start_scheduled_voice(SDL_AudioVoice *voice, const Uint64 frame, const Uint32 frames, const int freq)
+{
+    Uint32 offset = 0;
+
+    if (voice->start_frame >= (frame + frames)) {
+        return frames;
+    } else if (voice->start_frame >= frame) {
+        offset = (Uint32) (voice->start_frame - frame);
+    } else {
+        const double missed = (double) (frame - voice->start_frame);
+        const double end = (double) (((Uint64) voice->frames) << 32);
+        const double pos = missed * (double) get_voice_step(voice, freq);
+        if ((pos >= end) && !SDL_AtomicGet(&voice->looping)) {
+            voice->position = ((Uint64) voice->frames) << 32;  /* mix_voice() stops it. */
+        } else {
+            voice->position = (Uint64) (pos - (SDL_floor(pos / end) * end));
+        }
+    }
+    voice->scheduled = SDL_FALSE;
+    return offset;
+}
+
+/* Mixes (frames) frames of a playing voice into (dst). */
+static void
+mix_voice(SDL_AudioVoice *voice, float *dst, const int dstchannels, Uint32 frames, const int freq)
+{
+    const float gain = get_voice_param(&voice->gain);
+    const float pan = get_voice_param(&voice->pan);
+    const float lgain = (pan > 0.0f) ? gain * (1.0f - pan) : gain;
+    const float rgain = (pan < 0.0f) ? gain * (1.0f + pan) : gain;
+    const SDL_bool loop = SDL_AtomicGet(&voice->looping) ? SDL_TRUE : SDL_FALSE;
+    const Uint64 step = get_voice_step(voice, freq);
+    const Uint64 end = ((Uint64) voice->frames) << 32;
+    const float *src = voice->data;
+    const int srcchannels = voice->channels;
+    Uint64 pos = voice->position;
+
+    while (frames > 0) {
+        Uint32 run;
+
+        if (pos >= end) {
+            if (!loop) {
+                SDL_AtomicSet(&voice->playing, 0);
+                break;
+            }
+            pos %= end;
+        }
+
+        if ((step == (((Uint64) 1) << 32)) && ((pos & 0xFFFFFFFF) == 0)) {
+            /* not resampling, so it's a straight run to the end of the sound. */
+            const Uint32 idx = (Uint32) (pos >> 32);
+            run = SDL_min(frames, voice->frames - idx);
+            mix_voice_run(dst, dstchannels, src + (idx * srcchannels), srcchannels, run, lgain, rgain);
+            pos += ((Uint64) run) << 32;
+        } else {
+            /* linear interpolation, up to the end of the sound. */
+            for (run = 0; (run < frames) && (pos < end); run++) {
+                const Uint32 idx = (Uint32) (pos >> 32);
+                const Uint32 next = ((idx + 1) < voice->frames) ? (idx + 1) : (loop ? 0 : idx);
+                const float frac = ((float) (Uint32) (pos & 0xFFFFFFFF)) * (1.0f / 4294967296.0f);
+                const float *a = src + (idx * srcchannels);
+                const float *b = src + (next * srcchannels);
+                const float l = a[0] + ((b[0] - a[0]) * frac);
+                const float r = a[srcchannels - 1] + ((b[srcchannels - 1] - a[srcchannels - 1]) * frac);
+                ACCUMULATE_VOICE_FRAME(dst + (run * dstchannels), dstchannels, l, r, lgain, rgain);
+                pos += step;
+            }
+        }
+
+        dst += run * dstchannels;
+        frames -= run;
+    }
+
+    voice->position = pos;
+}
+
+#undef ACCUMULATE_VOICE_FRAME
+
+/* Runs the device's own callback, then mixes the voices on top of it. The
+   voices are summed in float, and then mixed in with one pass of
+   SDL_MixAudioFormat(), which clamps. */
+void SDLCALL
+SDL_AudioMixerCallback(void *userdata, Uint8 *stream, int len)
+{
+    /* this function always holds the mixer lock before being called. */
+    SDL_AudioDevice *device = (SDL_AudioDevice *) userdata;
+    SDL_AudioMixer *mixer = device->mixer;
+    const SDL_AudioSpec *spec = &device->callbackspec;
+    const int framesize = (SDL_AUDIO_BITSIZE(spec->format) / 8) * spec->channels;
+    Uint32 frames = ((Uint32) len) / framesize;
+    Uint64 frame = device->callback_frames;  /* where this buffer starts. */
+
+    (*mixer->callback) (mixer->userdata, stream, len);
+
+    while (frames > 0) {
+        const Uint32 todo = SDL_min(frames, mixer->mixbuf_frames);
+        SDL_bool mixed = SDL_FALSE;
+        int i;
+
+        for (i = 0; i < mixer->num_voices; i++) {
+            SDL_AudioVoice *voice = &mixer->voices[i];
+            Uint32 offset = 0;
+            if ((voice->id == 0) || !take_voice_commands(voice)) {
+                continue;
+            } else if (voice->scheduled) {
+                offset = start_scheduled_voice(voice, frame, todo, spec->freq);
+                if (offset == todo) {
+                    continue;  /* not yet. */
+                }
+            }
+            if (!mixed) {
+                SDL_memset(mixer->mixbuf, '\0', todo * spec->channels * sizeof (float));
+                mixed = SDL_TRUE;
+            }
+            mix_voice(voice, mixer->mixbuf + (offset * spec->channels), spec->channels, todo - offset, spec->freq);
+        }
+
+        /* if nothing's playing, a scheduled voice might still start later. */
+        if (mixed) {
+            mixer->cvt.buf = (Uint8 *) mixer->mixbuf;
+            mixer->cvt.len = (int) (todo * spec->channels * sizeof (float));
+            mixer->cvt.len_cvt = mixer->cvt.len;
+            if (mixer->cvt.needed) {
+                SDL_ConvertAudio(&mixer->cvt);
+            }
+            SDL_MixAudioFormat(stream, mixer->cvt.buf, spec->format, (Uint32) mixer->cvt.len_cvt, SDL_MIX_MAXVOLUME);
+        }
+
+        stream += todo * framesize;
+        frames -= todo;
+        frame += todo;
+    }
+}
+
+/* The effect chain (SDL_AddAudioEffect() and friends)... */
+
+/* Swaps in the app's latest parameters, if it's not in the middle of
+   writing them; otherwise, the old ones do for another buffer. */
+static void
+take_effect_params(SDL_AudioEffect *effect)
+{
+    const int sequence = SDL_AtomicGet(&effect->sequence);
+    float *incoming = (effect->params == effect->paramsbuf[0]) ? effect->paramsbuf[1] : effect->paramsbuf[0];
+    int count;
+    int i;
+
+    if ((sequence == effect->applied) || (sequence & 1)) {
+        return;
+    }
+
+    SDL_MemoryBarrierAcquire();
+    count = SDL_max(0, SDL_min(effect->pending_count, SDL_AUDIOEFFECT_MAX_TAPS));
+    SDL_memcpy(incoming, effect->pending, count * sizeof (float));
+    SDL_MemoryBarrierAcquire();
+    if (SDL_AtomicGet(&effect->sequence) != sequence) {
+        return;
+    }
+
+    if (effect->type == SDL_AUDIOEFFECT_CONVOLUTION) {
+        /* reversed, so each output is a plain dot product with the history. */
+        for (i = 0; i < count / 2; i++) {
+            const float tmp = incoming[i];
+            incoming[i] = incoming[count - 1 - i];
+            incoming[count - 1 - i] = tmp;
+        }
+    } else if (effect->type == SDL_AUDIOEFFECT_LIMITER) {
+        effect->release = (float) SDL_pow(0.5, 1000.0 / (incoming[1] * effect->freq));
+    }
+
+    effect->params = incoming;
+    effect->count = count;
+    effect->applied = sequence;
+}
+
+#ifdef __SSE2__
+/* The filters below are recursive, so each frame needs the one before it;
+   with SSE2 they run the channels side by side instead, a lane each. That
+   covers stereo and quad; other layouts go through the plain C loops. */
+#define EFFECT_FRAME_SSE2(channels) \
+    ((((channels) == 2) || ((channels) == 4)) && (SDL_GetAudioCPUFeatures() & SDL_AUDIO_CPU_SSE2))
+
+static __m128
+load_effect_frame(const float *data, const int channels)
+{
+    return (channels == 4) ? _mm_loadu_ps(data) : _mm_castpd_ps(_mm_load_sd((const double *) data));
+}
+
+static void
+store_effect_frame(float *data, const int channels, const __m128 x)
+{
+    if (channels == 4) {
+        _mm_storeu_ps(data, x);
+    } else {
+        _mm_store_sd((double *) data, _mm_castps_pd(x));
+    }
+}
+#endif
+
+/* Transposed direct form II, one set of state per channel. */
+static void
+run_biquad(SDL_AudioEffect *effect, float *data, const int channels, const Uint32 frames)
+{
+    const float b0 = effect->params[0], b1 = effect->params[1], b2 = effect->params[2];
+    const float a1 = effect->params[3], a2 = effect->params[4];
+    float *z1 = effect->state[0];
+    float *z2 = effect->state[1];
+    Uint32 i;
+    int c;
+
+#ifdef __SSE2__
+    if (EFFECT_FRAME_SSE2(channels)) {
+        const __m128 vb0 = _mm_set1_ps(b0), vb1 = _mm_set1_ps(b1), vb2 = _mm_set1_ps(b2);
+        const __m128 va1 = _mm_set1_ps(a1), va2 = _mm_set1_ps(a2);
+        __m128 vz1 = _mm_loadu_ps(z1);
+        __m128 vz2 = _mm_loadu_ps(z2);
+        for (i = 0; i < frames; i++, data += channels) {
+            const __m128 x = load_effect_frame(data, channels);
+            const __m128 y = _mm_add_ps(_mm_mul_ps(vb0, x), vz1);
+            vz1 = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(vb1, x), _mm_mul_ps(va1, y)), vz2);
+            vz2 = _mm_sub_ps(_mm_mul_ps(vb2, x), _mm_mul_ps(va2, y));
+            store_effect_frame(data, channels, y);
+        }
+        _mm_storeu_ps(z1, vz1);
+        _mm_storeu_ps(z2, vz2);
+        return;
+    }
+#endif
+
+    for (i = 0; i < frames; i++, data += channels) {
+        for (c = 0; c < channels; c++) {
+            const float x = data[c];
+            const float y = (b0 * x) + z1[c];
+            z1[c] = (b1 * x) - (a1 * y) + z2[c];
+            z2[c] = (b2 * x) - (a2 * y);
+            data[c] = y;
+        }
+    }
+}
+
+/* y[n] = x[n] - x[n-1] + pole * y[n-1] */
+static void
+run_dcblocker(SDL_AudioEffect *effect, float *data, const int channels, const Uint32 frames)
+{
+    const float pole = effect->params[0];
+    float *x1 = effect->state[0];
+    float *y1 = effect->state[1];
+    Uint32 i;
+    int c;
+
+#ifdef __SSE2__
+    if (EFFECT_FRAME_SSE2(channels)) {
+        const __m128 vpole = _mm_set1_ps(pole);
+        __m128 vx1 = _mm_loadu_ps(x1);
+        __m128 vy1 = _mm_loadu_ps(y1);
+        for (i = 0; i < frames; i++, data += channels) {
+            const __m128 x = load_effect_frame(data, channels);
+            vy1 = _mm_add_ps(_mm_sub_ps(x, vx1), _mm_mul_ps(vpole, vy1));
+            vx1 = x;
+            store_effect_frame(data, channels, vy1);
+        }
+        _mm_storeu_ps(x1, vx1);
+        _mm_storeu_ps(y1, vy1);
+        return;
+    }
+#endif
+
+    for (i = 0; i < frames; i++, data += channels) {
+        for (c = 0; c < channels; c++) {
+            const float x = data[c];
+            const float y = x - x1[c] + (pole * y1[c]);
+            x1[c] = x;
+            y1[c] = y;
+            data[c] = y;
+        }
+    }
+}
+
+/* All channels get the same gain, from the loudest, so the image holds. */
+static void
+run_limiter(SDL_AudioEffect *effect, float *data, const int channels, const Uint32 frames)
+{
+    const float threshold = effect->params[0];
+    const float release = effect->release;
+    float envelope = effect->envelope;
+    Uint32 i;
+    int c;
+
+#ifdef __SSE2__
+    if (EFFECT_FRAME_SSE2(channels)) {
+        const __m128 magnitude = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+        for (i = 0; i < frames; i++, data += channels) {
+            const __m128 x = load_effect_frame(data, channels);
+            __m128 peak = _mm_and_ps(x, magnitude);  /* unused lanes are zero. */
+            float p;
+            peak = _mm_max_ps(peak, _mm_shuffle_ps(peak, peak, _MM_SHUFFLE(1, 0, 3, 2)));
+            peak = _mm_max_ps(peak, _mm_shuffle_ps(peak, peak, _MM_SHUFFLE(2, 3, 0, 1)));
+            p = _mm_cvtss_f32(peak);
+            envelope = (p >= envelope) ? p : (p + ((envelope - p) * release));
+            if (envelope > threshold) {
+                store_effect_frame(data, channels, _mm_mul_ps(x, _mm_set1_ps(threshold / envelope)));
+            }
+        }
+        effect->envelope = envelope;
+        return;
+    }
+#endif
+
+    for (i = 0; i < frames; i++, data += channels) {
+        float peak = 0.0f;
+        for (c = 0; c < channels; c++) {
+            const float x = (data[c] < 0.0f) ? -data[c] : data[c];
+            peak = (x > peak) ? x : peak;
+        }
+        envelope = (peak >= envelope) ? peak : (peak + ((envelope - peak) * release));
+        if (envelope > threshold) {
+            const float gain = threshold / envelope;
+            for (c = 0; c < channels; c++) {
+                data[c] *= gain;
+            }
+        }
+    }
+    effect->envelope = envelope;
+}
+
+#ifdef __SSE2__
+#undef EFFECT_FRAME_SSE2
+#endif
+
+static float
+convolve(const float *x, const float *h, const int count, const SDL_bool use_sse2)
+{
+    float sum = 0.0f;
+    int i = 0;
+
+#ifdef __SSE2__
+    if (use_sse2) {
+        __m128 acc = _mm_setzero_ps();
+        float partial[4];
+        for (; (i + 4) <= count; i += 4) {
+            acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(x + i), _mm_loadu_ps(h + i)));
+        }
+        _mm_storeu_ps(partial, acc);
+        sum = (partial[0] + partial[1]) + (partial[2] + partial[3]);
+    }
+#endif
+
+    for (; i < count; i++) {
+        sum += x[i] * h[i];
+    }
+    return sum;
+}
+
+/* Each channel's history is a ring of SDL_AUDIOEFFECT_MAX_TAPS inputs,
+   stored twice over, so the latest (count) are always contiguous. */
+static void
+run_convolution(SDL_AudioEffect *effect, float *data, const int channels, const Uint32 frames)
+{
+    const SDL_bool use_sse2 = (SDL_GetAudioCPUFeatures() & SDL_AUDIO_CPU_SSE2) ? SDL_TRUE : SDL_FALSE;
+    const int ringlen = SDL_AUDIOEFFECT_MAX_TAPS;
+    const int count = effect->count;
+    const float *taps = effect->params;
+    int pos = effect->history_pos;
+    Uint32 i;
+    int c;
+
+    for (i = 0; i < frames; i++, data += channels) {
+        for (c = 0; c < channels; c++) {
+            float *history = effect->history + (c * ringlen * 2);
+            history[pos] = history[pos + ringlen] = data[c];
+            data[c] = convolve(history + pos + ringlen - count + 1, taps, count, use_sse2);
+        }
+        pos = (pos + 1) % ringlen;
+    }
+    effect->history_pos = pos;
+}
+
+static void meter_float(SDL_AudioDevice *device, const float *data, const int channels, const Uint32 frames);
+
+/* Runs the part of the chain that goes before or after conversion over a
+   buffer in that stage's format. The device is locked. Before conversion,
+   with metering on, it meters the result while it's in float, and returns
+   SDL_TRUE if it did. */
+SDL_bool
+SDL_RunAudioEffects(SDL_AudioDevice *device, Uint8 *stream, int len, const SDL_bool after_conversion)
+{
+    SDL_AudioEffectChain *chain = device->effects;
+    const int which = after_conversion ? 1 : 0;
+    const SDL_AudioSpec *spec = after_conversion ? &device->spec : &device->callbackspec;
+    const Uint32 frames = ((Uint32) len) / ((SDL_AUDIO_BITSIZE(spec->format) / 8) * spec->channels);
+    float *data = (float *) stream;
+    SDL_bool converted = SDL_FALSE;
+    SDL_bool metered = SDL_FALSE;
+    int i;
+
+    for (i = 0; i < chain->num_effects; i++) {
+        SDL_AudioEffect *effect = chain->effects[i];
+        if (effect->after_conversion != after_conversion) {
+            continue;
+        }
+
+        take_effect_params(effect);
+        if (effect->count == 0) {
+            continue;  /* its first parameters haven't come in yet. */
+        }
+
+        if (!converted && chain->to_float[which].needed) {
+            SDL_AudioCVT *cvt = &chain->to_float[which];
+            SDL_memcpy(chain->work, stream, len);
+            cvt->buf = (Uint8 *) chain->work;
+            cvt->len = len;
+            SDL_ConvertAudio(cvt);
+            data = chain->work;
+        }
+        converted = SDL_TRUE;
+
+        switch (effect->type) {
+        case SDL_AUDIOEFFECT_BIQUAD: run_biquad(effect, data, spec->channels, frames); break;
+        case SDL_AUDIOEFFECT_LIMITER: run_limiter(effect, data, spec->channels, frames); break;
+        case SDL_AUDIOEFFECT_DCBLOCKER: run_dcblocker(effect, data, spec->channels, frames); break;
+        case SDL_AUDIOEFFECT_CONVOLUTION: run_convolution(effect, data, spec->channels, frames); break;
+        }
+    }
+
+    /* saves SDL_MeterAudio() converting it to float all over again. */
+    if (converted && !after_conversion && SDL_AtomicGet(&device->metering)) {
+        meter_float(device, data, spec->channels, frames);
+        metered = SDL_TRUE;
+    }
+
+    if (converted && chain->from_float[which].needed) {
+        SDL_AudioCVT *cvt = &chain->from_float[which];
+        cvt->buf = (Uint8 *) chain->work;
+        cvt->len = (int) (frames * spec->channels * sizeof (float));
+        SDL_ConvertAudio(cvt);
+        SDL_memcpy(stream, cvt->buf, cvt->len_cvt);
+    }
+    return metered;
+}
+
+/* Level metering (SDL_GetAudioDeviceMeter)... */
+
+/* Adds each channel's peak, sum of squares and samples at or past full
+   scale in (frames) of float audio to (peak), (sumsq) and (clips). */
+static void
+measure_float(const float *data, const int channels, const Uint32 frames,
+              float *peak, float *sumsq, Uint32 *clips)
+{
+    const Uint32 total = frames * channels;
+    Uint32 i = 0;
+
+#ifdef __SSE2__
+    /* with 1, 2 or 4 channels, each lane always holds the same channel. */
+    if ((SDL_GetAudioCPUFeatures() & SDL_AUDIO_CPU_SSE2) && ((4 % channels) == 0)) {
+        const __m128 absmask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+        const __m128 full = _mm_set1_ps(1.0f);
+        __m128 maxv = _mm_setzero_ps();
+        __m128 sumv = _mm_setzero_ps();
+        __m128i clipv = _mm_setzero_si128();
+        float maxl[4], suml[4];
+        Uint32 clipl[4];
+        int j;
+
+        for (; (i + 4) <= total; i += 4) {
+            const __m128 x = _mm_and_ps(_mm_loadu_ps(data + i), absmask);
+            maxv = _mm_max_ps(x, maxv);  /* this way round, NaNs are ignored. */
+            sumv = _mm_add_ps(sumv, _mm_mul_ps(x, x));
+            clipv = _mm_sub_epi32(clipv, _mm_castps_si128(_mm_cmpge_ps(x, full)));
+        }
+        _mm_storeu_ps(maxl, maxv);
+        _mm_storeu_ps(suml, sumv);
+        _mm_storeu_si128((__m128i *) clipl, clipv);
+        for (j = 0; j < 4; j++) {
+            const int c = j % channels;
+            peak[c] = SDL_max(peak[c], maxl[j]);
+            sumsq[c] += suml[j];
+            clips[c] += clipl[j];
+        }
+    }
+#endif
+
+    for (; i < total; i++) {
+        const int c = (int) (i % channels);
+        const float x = (data[i] < 0.0f) ? -data[i] : data[i];
+        if (x > peak[c]) {
+            peak[c] = x;
+        }
+        sumsq[c] += x * x;
+        if (x >= 1.0f) {
+            clips[c]++;
+        }
+    }
+}
+
+/* The same for native Sint16, scaled like SDL's conversion to float. */
+static void
+measure_s16(const Sint16 *data, const int channels, const Uint32 frames,
+            float *peak, float *sumsq, Uint32 *clips)
+{
+    const Uint32 total = frames * channels;
+    int peaks[SDL_AUDIO_METER_CHANNELS];
+    float sums[SDL_AUDIO_METER_CHANNELS];
+    Uint32 i;
+    int c;
+
+    for (c = 0; c < channels; c++) {
+        peaks[c] = 0;
+        sums[c] = 0.0f;
+    }
+
+    for (i = 0; i < total; i++) {
+        const int x = (data[i] < 0) ? -data[i] : data[i];
+        c = (int) (i % channels);
+        if (x > peaks[c]) {
+            peaks[c] = x;
+        }
+        sums[c] += (float) (x * x);
+        if (x >= 32767) {
+            clips[c]++;
+        }
+    }
+
+    for (c = 0; c < channels; c++) {
+        peak[c] = SDL_max(peak[c], peaks[c] * DIVBY32767);
+        sumsq[c] += sums[c] * (DIVBY32767 * DIVBY32767);
+    }
+}
+
+/* Device thread: adds one buffer's measurements to the running levels,
+   and publishes them. */
+static void
+publish_meter(SDL_AudioDevice *device, const int channels, const Uint32 frames,
+              const float *peak, const float *sumsq, const Uint32 *clips)
+{
+    SDL_AudioMeter *meter = &device->meter;
+    int c;
+
+    SDL_AtomicIncRef(&device->meter_sequence);  /* odd: readers keep out. */
+
+    if (SDL_AtomicCAS(&device->meter_reset, 1, 0)) {
+        SDL_zerop(meter);
+        SDL_zero(device->meter_sums);
+    }
+
+    meter->channels = channels;
+    meter->frames += frames;
+    for (c = 0; c < channels; c++) {
+        device->meter_sums[c] += sumsq[c];
+        meter->peak[c] = SDL_max(meter->peak[c], peak[c]);
+        meter->rms[c] = meter->frames ? (float) SDL_sqrt(device->meter_sums[c] / meter->frames) : 0.0f;
+        meter->clips[c] += clips[c];
+    }
+
+    SDL_MemoryBarrierRelease();
+    SDL_AtomicIncRef(&device->meter_sequence);  /* even: done. */
+}
+
+/* Device thread: meters float audio that's already at hand, like the
+   effect chain's work buffer. */
+static void
+meter_float(SDL_AudioDevice *device, const float *data, const int channels, const Uint32 frames)
+{
+    float peak[SDL_AUDIO_METER_CHANNELS];
+    float sumsq[SDL_AUDIO_METER_CHANNELS];
+    Uint32 clips[SDL_AUDIO_METER_CHANNELS];
+    int c;
+
+    if (channels > SDL_AUDIO_METER_CHANNELS) {
+        return;  /* SDL never opens more than this many, but just in case. */
+    }
+
+    for (c = 0; c < channels; c++) {
+        peak[c] = sumsq[c] = 0.0f;
+        clips[c] = 0;
+    }
+    measure_float(data, channels, frames, peak, sumsq, clips);
+    publish_meter(device, channels, frames, peak, sumsq, clips);
+}
+
+/* Device thread: measures a buffer in the callback's format and
+   publishes the running levels. Float and native Sint16 are one pass
+   over the buffer; anything else is copied and converted to float first. */
+void
+SDL_MeterAudio(SDL_AudioDevice *device, const Uint8 *stream, int len)
+{
+    const SDL_AudioSpec *spec = &device->callbackspec;
+    const int channels = SDL_min(spec->channels, SDL_AUDIO_METER_CHANNELS);
+    const Uint32 frames = ((Uint32) len) / ((SDL_AUDIO_BITSIZE(spec->format) / 8) * spec->channels);
+    float peak[SDL_AUDIO_METER_CHANNELS];
+    float sumsq[SDL_AUDIO_METER_CHANNELS];
+    Uint32 clips[SDL_AUDIO_METER_CHANNELS];
+    int c;
+
+    if (channels != spec->channels) {
+        return;  /* SDL never opens more than this many, but just in case. */
+    }
+
+    for (c = 0; c < channels; c++) {
+        peak[c] = sumsq[c] = 0.0f;
+        clips[c] = 0;
+    }
+
+    /* measure outside the sequence, so readers are kept out only briefly. */
+    if (spec->format == AUDIO_F32SYS) {
+        measure_float((const float *) stream, channels, frames, peak, sumsq, clips);
+    } else if (spec->format == AUDIO_S16SYS) {
+        measure_s16((const Sint16 *) stream, channels, frames, peak, sumsq, clips);
+    } else if (device->meter_work) {
+        SDL_AudioCVT *cvt = &device->meter_cvt;
+        SDL_memcpy(device->meter_work, stream, len);
+        cvt->buf = (Uint8 *) device->meter_work;
+        cvt->len = len;
+        SDL_ConvertAudio(cvt);
+        measure_float(device->meter_work, channels, frames, peak, sumsq, clips);
+    }
+
+    publish_meter(device, channels, frames, peak, sumsq, clips);
+}
+
 /* vi: set ts=4 sw=4 expandtab: */
@@ -23,6 +23,7 @@
 #ifndef _SDL_sysaudio_h
 #define _SDL_sysaudio_h
 
+#include "SDL_atomic.h"
 #include "SDL_mutex.h"
 #include "SDL_thread.h"
 
@@ -30,6 +31,15 @@
 typedef struct SDL_AudioDevice SDL_AudioDevice;
 #define _THIS   SDL_AudioDevice *_this
 
+/* Where the build found timerfd, eventfd and a monotonic clock_gettime()
+   (Linux), fake output is paced with a timerfd, and the thread is woken
+   with an eventfd. Everything else uses a semaphore with a timeout. */
+#ifdef HAVE_TIMERFD
+#define SDL_AUDIO_PACE_TIMERFD 1
+#else
+#define SDL_AUDIO_PACE_TIMERFD 0
+#endif
+
 /* Audio targets should call this as devices are added to the system (such as
    a USB headset being plugged in), and should also be called for
    for every device found during DetectDevices(). */
@@ -46,25 +56,137 @@ extern void SDL_RemoveAudioDevice(const int iscapture, void *handle);
 extern void SDL_OpenedAudioDeviceDisconnected(SDL_AudioDevice *device);
 
 
-/* This is the size of a packet when using SDL_QueueAudio(). We allocate
-   these as necessary and pool them, under the assumption that we'll
-   eventually end up with a handful that keep recycling, meeting whatever
-   the app needs. We keep packing data tightly as more arrives to avoid
-   wasting space, and if we get a giant block of data, we'll split them
-   into multiple packets behind the scenes. My expectation is that most
-   apps will have 2-3 of these in the pool. 8k should cover most needs, but
-   if this is crippling for some embedded system, we can #ifdef this.
-   The system preallocates enough packets for 2 callbacks' worth of data. */
-#define SDL_AUDIOBUFFERQUEUE_PACKETLEN (8 * 1024)
-
-/* Used by apps that queue audio instead of using the callback. */
-typedef struct SDL_AudioBufferQueue
+/* Used by apps that queue audio instead of using the callback: a lock-free
+   ring buffer with one producer thread and one consumer thread. (size) is
+   a power of two; the positions run freely and wrap around. When a ring
+   is full, the producer can start a bigger one and link it from (next),
+   and the consumer moves on to it once this one is drained. */
+typedef struct SDL_AudioRingBuffer
+{
+    Uint8 *data;
+    Uint32 size;
+    SDL_atomic_t readpos;  /* only the consumer changes this. */
+    SDL_atomic_t writepos;  /* only the producer changes this. */
+    struct SDL_AudioRingBuffer *next;  /* set once, by the producer. */
+} SDL_AudioRingBuffer;
+
+/* A converter for queued audio in one format. App threads make these, and
+   only app threads ever free them; the audio thread just switches between
+   them. (refs) counts queued chunks that use it, plus one while it's the
+   audio thread's current converter. At zero the app can reuse or free it. */
+typedef struct SDL_AudioQueueStream
+{
+    SDL_AudioStream *stream;
+    SDL_AudioFormat format;
+    Uint8 channels;
+    int freq;
+    SDL_atomic_t refs;
+    struct SDL_AudioQueueStream *next;  /* app side, under (queue_lock). */
+} SDL_AudioQueueStream;
+
+/* Every push to a playback queue starts with one of these in the ring, so
+   each one can be in its own format; the audio thread converts as it goes. */
+typedef struct SDL_AudioQueueChunk
+{
+    Uint32 len;  /* bytes of audio data following this header. */
+    Uint32 outlen;  /* about how many bytes that makes in (callbackspec). */
+    SDL_AudioFormat format;
+    Uint8 channels;
+    int freq;
+    SDL_AudioQueueStream *stream;  /* NULL if it's already in (callbackspec). */
+} SDL_AudioQueueChunk;
+
+/* Commands the app leaves in SDL_AudioVoice::command for the audio thread. */
+#define SDL_AUDIOVOICE_PLAY 1
+#define SDL_AUDIOVOICE_STOP 2
+#define SDL_AUDIOVOICE_PLAY_AT 3  /* SDL_AUDIOVOICE_PLAY, at (start_lo, start_hi). */
+
+/* A voice of the built-in mixer. The app only sets up and frees one with
+   the device locked; after that, it talks to the audio thread through the
+   atomics, so changing parameters never waits on the audio thread. */
+typedef struct SDL_AudioVoice
+{
+    SDL_AudioVoiceID id;  /* 0 if this slot is free. */
+    float *data;  /* the sound, as float, mono or stereo, at its own rate. */
+    Uint32 frames;
+    int channels;
+    int freq;
+
+    SDL_atomic_t gain;  /* floats, stored as their bits. */
+    SDL_atomic_t pan;
+    SDL_atomic_t ratio;
+    SDL_atomic_t looping;
+    SDL_atomic_t command;  /* SDL_AUDIOVOICE_*, or 0 once the audio thread took it. */
+    SDL_atomic_t playing;  /* set by the audio thread. */
+
+    /* SDL_PlayAudioVoiceAt()'s frame, in halves so they're atomic. The app
+       writes them while (start_sequence) is odd, and the audio thread
+       leaves SDL_AUDIOVOICE_PLAY_AT alone until it reads the same even
+       sequence before and after. */
+    SDL_atomic_t start_lo;
+    SDL_atomic_t start_hi;
+    SDL_atomic_t start_sequence;
+
+    Uint64 position;  /* audio thread only: in frames, 32.32 fixed point. */
+    Uint64 start_frame;  /* audio thread only: when a scheduled voice starts... */
+    SDL_bool scheduled;  /* ...if it hasn't yet. */
+} SDL_AudioVoice;
+
+/* The built-in mixer wraps the device's callback (or queue) and mixes the
+   voices on top of whatever it produced, in float. */
+typedef struct SDL_AudioMixer
+{
+    SDL_AudioCallback callback;  /* the device's own callback... */
+    void *userdata;  /* ...and its userdata. */
+    SDL_AudioVoice *voices;
+    int num_voices;
+    Uint32 serial;  /* makes voice IDs unique, so stale ones fail. */
+    SDL_SpinLock schedule_lock;  /* serializes app threads scheduling voices. */
+    float *mixbuf;  /* the voices get mixed here... */
+    Uint32 mixbuf_frames;
+    SDL_AudioCVT cvt;  /* ...and converted to the callback's format. */
+} SDL_AudioMixer;
+
+/* A stage of a device's effect chain. The app sets one up and removes it
+   with the device locked. New parameters go in (pending), which the app
+   writes while (sequence) is odd; the audio thread copies them out once it
+   reads the same even sequence before and after, and swaps them in. */
+typedef struct SDL_AudioEffect
 {
-    Uint8 data[SDL_AUDIOBUFFERQUEUE_PACKETLEN];  /* packet data. */
-    Uint32 datalen;  /* bytes currently in use in this packet. */
-    Uint32 startpos;  /* bytes currently consumed in this packet. */
-    struct SDL_AudioBufferQueue *next;  /* next item in linked list. */
-} SDL_AudioBufferQueue;
+    SDL_AudioEffectID id;
+    SDL_AudioEffectType type;
+    SDL_bool after_conversion;
+    int channels;
+    int freq;
+
+    float pending[SDL_AUDIOEFFECT_MAX_TAPS];
+    int pending_count;
+    SDL_atomic_t sequence;
+
+    /* Audio thread only, from here on. */
+    float paramsbuf[2][SDL_AUDIOEFFECT_MAX_TAPS];
+    float *params;  /* one of (paramsbuf); convolution taps are reversed. */
+    int count;
+    int applied;  /* the (sequence) (params) came from. */
+    float release;  /* limiter: how much of the gain reduction lasts a frame. */
+    float envelope;  /* limiter: the peak level it's pulling down to. */
+    float state[2][8];  /* biquad and DC blocker: per channel. */
+    float *history;  /* convolution: each channel's last inputs, twice over, */
+    int history_pos;  /* so the last (count) are always in one piece. */
+} SDL_AudioEffect;
+
+/* A device's effect chain, in order. Formats other than float get
+   converted in (work) around the stages that run on them. */
+typedef struct SDL_AudioEffectChain
+{
+    SDL_AudioEffect *effects[SDL_AUDIO_MAX_EFFECTS];
+    int num_effects;
+    Uint32 serial;  /* makes effect IDs unique, so stale ones fail. */
+    SDL_SpinLock params_lock;  /* app threads: held to change (effects) or their parameters. */
+    float *work;
+    SDL_AudioCVT to_float[2];  /* before and after conversion... */
+    SDL_AudioCVT from_float[2];
+} SDL_AudioEffectChain;
 
 typedef struct SDL_AudioDriverImpl
 {
@@ -74,7 +196,10 @@ typedef struct SDL_AudioDriverImpl
     void (*WaitDevice) (_THIS);
     void (*PlayDevice) (_THIS);
     int (*GetPendingBytes) (_THIS);
-    Uint8 *(*GetDeviceBuf) (_THIS);
+    int (*GetPlaybackDelay) (_THIS);  /* frames given to PlayDevice not played yet, or -1 if unknown. Device thread only. */
+    Uint8 *(*GetDeviceBuf) (_THIS);  /* must hold at least spec.size bytes */
+    int (*CaptureFromDevice) (_THIS, void *buffer, int buflen);  /* bytes read, or -1 on failure */
+    void (*FlushCapture) (_THIS);  /* drop whatever has been captured so far */
     void (*WaitDone) (_THIS);
     void (*CloseDevice) (_THIS);
     void (*LockDevice) (_THIS);
@@ -92,6 +217,7 @@ typedef struct SDL_AudioDriverImpl
     int OnlyHasDefaultOutputDevice;
     int OnlyHasDefaultInputDevice;
     int AllowsArbitraryDeviceNames;
+    int SupportsAdaptiveLatency;  /* WaitDevice honors SDL_AudioDevice::adaptive_frames. */
 } SDL_AudioDriverImpl;
 
 
@@ -130,15 +256,6 @@ typedef struct SDL_AudioDriver
 } SDL_AudioDriver;
 
 
-/* Streamer */
-typedef struct
-{
-    Uint8 *buffer;
-    int max_len;                /* the maximum length in bytes */
-    int read_pos, write_pos;    /* the position of the write and read heads in bytes */
-} SDL_AudioStreamer;
-
-
 /* Define the SDL audio driver structure */
 struct SDL_AudioDevice
 {
@@ -149,12 +266,20 @@ struct SDL_AudioDevice
     /* The current audio specification (shared with audio thread) */
     SDL_AudioSpec spec;
 
+    /* The spec the app's callback (or queue) works in. */
+    SDL_AudioSpec callbackspec;
+
     /* An audio conversion block for audio format emulation */
     SDL_AudioCVT convert;
 
-    /* The streamer, if sample rate conversion necessitates it */
-    int use_streamer;
-    SDL_AudioStreamer streamer;
+    /* If true, the device buffer is big enough to hold every stage of
+       (convert), so the callback fills it directly and we convert there,
+       instead of converting in (convert.buf) and copying the result. */
+    SDL_bool convert_in_place;
+
+    /* The stream, if sample rate conversion necessitates it. Resampling
+       needs state between callbacks, which (convert) can't keep. */
+    SDL_AudioStream *stream;
 
     /* Current state flags */
     /* !!! FIXME: should be SDL_bool */
@@ -167,6 +292,11 @@ struct SDL_AudioDevice
     /* Fake audio buffer for when the audio hardware is busy */
     Uint8 *fake_stream;
 
+    /* Capture devices hand the app (callback_len) bytes per callback. If
+       (stream) converts for them, the app's data is gathered here. */
+    Uint8 *work_buffer;
+    Uint32 callback_len;
+
     /* A mutex for locking the mixing buffers */
     SDL_mutex *mixer_lock;
 
@@ -174,11 +304,91 @@ struct SDL_AudioDevice
     SDL_Thread *thread;
     SDL_threadID threadid;
 
-    /* Queued buffers (if app not using callback). */
-    SDL_AudioBufferQueue *buffer_queue_head; /* device fed from here. */
-    SDL_AudioBufferQueue *buffer_queue_tail; /* queue fills to here. */
-    SDL_AudioBufferQueue *buffer_queue_pool; /* these are unused packets. */
-    Uint32 queued_bytes;  /* number of bytes of audio data in the queue. */
+    /* Queued audio (if app not using callback). For playback, the app fills
+       (queue_tail) and the audio thread drains (queue_head). For capture
+       it's the other way around, and there is only ever the one ring. */
+    SDL_AudioRingBuffer *queue_head;  /* consumer's ring. */
+    SDL_AudioRingBuffer *queue_tail;  /* producer's ring. */
+    SDL_AudioRingBuffer *queue_oldest;  /* drained rings before (queue_head) are freed from here. */
+    SDL_mutex *queue_lock;  /* serializes app threads; the audio thread never takes it. */
+    SDL_atomic_t queued_bytes;  /* number of bytes of audio data in the queue. */
+    SDL_bool queue_can_grow;
+    SDL_AudioQueueStream *queue_streams;  /* app side: one converter per format, under (queue_lock). */
+
+    /* Audio thread side of a playback queue: the chunk being drained, how
+       much of it is still in the ring, and how much of its (outlen) has
+       come off (queued_bytes). Chunks not in (callbackspec) go through
+       their converter, which becomes (queue_stream). */
+    SDL_AudioQueueChunk queue_chunk;
+    Uint32 queue_chunk_left;
+    Uint32 queue_chunk_counted;
+    SDL_AudioQueueStream *queue_stream;
+    SDL_bool queue_stream_flushed;
+
+    /* The built-in mixer, once the app creates a voice. */
+    SDL_AudioMixer *mixer;
+
+    /* The effect chain, once the app adds an effect. */
+    SDL_AudioEffectChain *effects;
+
+    /* Performance counters (SDL_GetAudioDeviceStats). Only the device's
+       thread writes (stats), while (stats_sequence) is odd; readers copy
+       it until they get the same even sequence before and after. */
+    SDL_AudioDeviceStats stats;
+    SDL_atomic_t stats_sequence;
+    SDL_atomic_t stats_reset;  /* the app wants the timings cleared. */
+    SDL_atomic_t queue_underruns;  /* counted wherever the queue drains... */
+    SDL_atomic_t xruns;  /* ...and wherever the driver notices. */
+    SDL_bool queue_playing;  /* the queue had data last time it drained. */
+    Uint64 stats_last_start;  /* device thread: when the last buffer started, */
+    Uint64 stats_last_log;  /* when it last logged, */
+    Uint64 stats_log_interval;  /* and how often to, in counter ticks (0 for never). */
+
+    /* Level meter (SDL_GetAudioDeviceMeter), published like (stats). The
+       device thread measures (callbackspec) buffers while (metering) is
+       set; formats it can't measure directly go through float in
+       (meter_work) first. */
+    SDL_atomic_t metering;
+    SDL_AudioMeter meter;
+    SDL_atomic_t meter_sequence;
+    SDL_atomic_t meter_reset;  /* the app wants the meter started over. */
+    double meter_sums[SDL_AUDIO_METER_CHANNELS];  /* device thread: sums of squares. */
+    float *meter_work;
+    SDL_AudioCVT meter_cvt;
+
+    /* Driver buffering between GetDeviceBuf() and the speaker, in
+       microseconds. OpenDevice sets it if it knows better than one buffer. */
+    Uint32 latency_us;
+
+    /* Playback position (SDL_GetAudioDevicePosition). The device thread
+       counts the frames it hands the driver, and after each buffer takes
+       off what the driver still holds. It publishes the result and when
+       it measured it under (position_sequence), like (stats). */
+    Uint64 frames_written;  /* device thread only, in (spec) frames. */
+    Uint64 callback_frames;  /* device thread only, in (callbackspec) frames. */
+    Uint64 position_frames;
+    Uint64 position_time;
+    SDL_atomic_t position_sequence;
+
+    /* Adaptive latency (SDL_HINT_AUDIO_ADAPTIVE_LATENCY). OpenDevice sees
+       (adaptive) set and makes room for (adaptive_max) frames; the device
+       thread then keeps only (adaptive_frames) of it queued, doubling that
+       on an underrun and giving a buffer back after a while without one.
+       The fake stream emulates this for drivers without GetDeviceBuf. */
+    SDL_bool adaptive;
+    Uint32 adaptive_frames;  /* device thread only, in (spec) frames. */
+    Uint32 adaptive_max;
+    Uint32 adaptive_stable;  /* device thread only: frames since the last change. */
+    int adaptive_xruns;  /* device thread only: (xruns) when it last looked. */
+    SDL_atomic_t adaptive_latency_us;  /* (adaptive_frames), for SDL_GetAudioDeviceLatency(). */
+
+    /* When there's no device to block on, the thread sleeps until absolute
+       deadlines, and wake_audio_thread() cuts the sleep short. */
+#if SDL_AUDIO_PACE_TIMERFD
+    int pace_timerfd;
+    int pace_eventfd;
+#endif
+    SDL_sem *pace_sem;
 
     /* * * */
     /* Data private to this driver */
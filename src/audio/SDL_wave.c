@@ -23,87 +23,110 @@
 /* Microsoft WAVE file loading routines */
 
 #include "SDL_audio.h"
+#include "SDL_cpuinfo.h"
+#include "SDL_hints.h"
 #include "SDL_wave.h"
+#include "../thread/SDL_systhread.h"
 
 
 static int ReadChunk(SDL_RWops * src, Chunk * chunk);
 
+/* Any channel count SDL_AudioSpec can describe. */
+#define WAVE_MAX_CHANNELS 255
+
+/* Decoding less than this much audio isn't worth starting a thread for. */
+#define WAVE_MIN_DECODE_PER_THREAD  (1024 * 1024)
+#define WAVE_MAX_DECODE_THREADS     16
+
 struct MS_ADPCM_decodestate
 {
-    Uint8 hPredictor;
     Uint16 iDelta;
     Sint16 iSamp1;
     Sint16 iSamp2;
+    const Sint16 *coeff;
 };
-static struct MS_ADPCM_decoder
+struct MS_ADPCM_decoder
 {
     WaveFMT wavefmt;
     Uint16 wSamplesPerBlock;
     Uint16 wNumCoef;
     Sint16 aCoeff[7][2];
-    /* * * */
-    struct MS_ADPCM_decodestate state[2];
-} MS_ADPCM_state;
+};
 
 static int
-InitMS_ADPCM(WaveFMT * format)
+InitMS_ADPCM(struct MS_ADPCM_decoder *decoder, WaveFMT * format, Uint32 fmtlen)
 {
     Uint8 *rogue_feel;
+    Uint32 headerlen, nibbles;
     int i;
 
+    /* the extra info, samples per block and 7 coefficient pairs */
+    if (fmtlen < (sizeof(*format) + 2 + 2 + 2 + (7 * 4))) {
+        SDL_SetError("MS ADPCM format chunk is too small");
+        return (-1);
+    }
+
     /* Set the rogue pointer to the MS_ADPCM specific data */
-    MS_ADPCM_state.wavefmt.encoding = SDL_SwapLE16(format->encoding);
-    MS_ADPCM_state.wavefmt.channels = SDL_SwapLE16(format->channels);
-    MS_ADPCM_state.wavefmt.frequency = SDL_SwapLE32(format->frequency);
-    MS_ADPCM_state.wavefmt.byterate = SDL_SwapLE32(format->byterate);
-    MS_ADPCM_state.wavefmt.blockalign = SDL_SwapLE16(format->blockalign);
-    MS_ADPCM_state.wavefmt.bitspersample =
+    decoder->wavefmt.encoding = SDL_SwapLE16(format->encoding);
+    decoder->wavefmt.channels = SDL_SwapLE16(format->channels);
+    decoder->wavefmt.frequency = SDL_SwapLE32(format->frequency);
+    decoder->wavefmt.byterate = SDL_SwapLE32(format->byterate);
+    decoder->wavefmt.blockalign = SDL_SwapLE16(format->blockalign);
+    decoder->wavefmt.bitspersample =
         SDL_SwapLE16(format->bitspersample);
     rogue_feel = (Uint8 *) format + sizeof(*format);
     if (sizeof(*format) == 16) {
         /* const Uint16 extra_info = ((rogue_feel[1] << 8) | rogue_feel[0]); */
         rogue_feel += sizeof(Uint16);
     }
-    MS_ADPCM_state.wSamplesPerBlock = ((rogue_feel[1] << 8) | rogue_feel[0]);
+    decoder->wSamplesPerBlock = ((rogue_feel[1] << 8) | rogue_feel[0]);
     rogue_feel += sizeof(Uint16);
-    MS_ADPCM_state.wNumCoef = ((rogue_feel[1] << 8) | rogue_feel[0]);
+    decoder->wNumCoef = ((rogue_feel[1] << 8) | rogue_feel[0]);
     rogue_feel += sizeof(Uint16);
-    if (MS_ADPCM_state.wNumCoef != 7) {
+    if (decoder->wNumCoef != 7) {
         SDL_SetError("Unknown set of MS_ADPCM coefficients");
         return (-1);
     }
-    for (i = 0; i < MS_ADPCM_state.wNumCoef; ++i) {
-        MS_ADPCM_state.aCoeff[i][0] = ((rogue_feel[1] << 8) | rogue_feel[0]);
+    for (i = 0; i < decoder->wNumCoef; ++i) {
+        decoder->aCoeff[i][0] = ((rogue_feel[1] << 8) | rogue_feel[0]);
         rogue_feel += sizeof(Uint16);
-        MS_ADPCM_state.aCoeff[i][1] = ((rogue_feel[1] << 8) | rogue_feel[0]);
+        decoder->aCoeff[i][1] = ((rogue_feel[1] << 8) | rogue_feel[0]);
         rogue_feel += sizeof(Uint16);
     }
+
+    /* Every block has to hold the samples it claims to. */
+    if ((decoder->wavefmt.channels < 1) || (decoder->wavefmt.channels > WAVE_MAX_CHANNELS)) {
+        SDL_SetError("MS ADPCM decoder can only handle 1 to %d channels", WAVE_MAX_CHANNELS);
+        return (-1);
+    }
+    headerlen = 7 * decoder->wavefmt.channels;
+    nibbles = (decoder->wSamplesPerBlock - 2) * decoder->wavefmt.channels;
+    if ((decoder->wSamplesPerBlock < 2) || (nibbles & 1) ||
+        (decoder->wavefmt.blockalign < headerlen + (nibbles / 2))) {
+        SDL_SetError("Invalid MS ADPCM block size");
+        return (-1);
+    }
     return (0);
 }
 
-static Sint32
-MS_ADPCM_nibble(struct MS_ADPCM_decodestate *state,
-                Uint8 nybble, Sint16 * coeff)
+SDL_FORCE_INLINE Sint16
+MS_ADPCM_nibble(struct MS_ADPCM_decodestate *state, const Uint8 nybble)
 {
-    const Sint32 max_audioval = ((1 << (16 - 1)) - 1);
-    const Sint32 min_audioval = -(1 << (16 - 1));
-    const Sint32 adaptive[] = {
+    static const Sint32 adaptive[16] = {
         230, 230, 230, 230, 307, 409, 512, 614,
         768, 614, 512, 409, 307, 230, 230, 230
     };
+    /* the nibble is a signed 4-bit value. */
+    const Sint32 signed_nybble = ((Sint32) nybble) - ((nybble & 0x08) << 1);
     Sint32 new_sample, delta;
 
-    new_sample = ((state->iSamp1 * coeff[0]) +
-                  (state->iSamp2 * coeff[1])) / 256;
-    if (nybble & 0x08) {
-        new_sample += state->iDelta * (nybble - 0x10);
-    } else {
-        new_sample += state->iDelta * nybble;
-    }
-    if (new_sample < min_audioval) {
-        new_sample = min_audioval;
-    } else if (new_sample > max_audioval) {
-        new_sample = max_audioval;
+    new_sample = ((state->iSamp1 * state->coeff[0]) +
+                  (state->iSamp2 * state->coeff[1])) / 256;
+    new_sample += state->iDelta * signed_nybble;
+    if (new_sample < -32768) {
+        new_sample = -32768;
+    } else if (new_sample > 32767) {
+        new_sample = 32767;
     }
     delta = ((Sint32) state->iDelta * adaptive[nybble]) / 256;
     if (delta < 16) {
@@ -112,294 +135,444 @@ MS_ADPCM_nibble(struct MS_ADPCM_decodestate *state,
     state->iDelta = (Uint16) delta;
     state->iSamp2 = state->iSamp1;
     state->iSamp1 = (Sint16) new_sample;
-    return (new_sample);
+    return (Sint16) new_sample;
 }
 
+/* Decodes one block, (wSamplesPerBlock) sample frames of 16-bit audio.
+   Blocks don't depend on each other, so any number of threads can decode
+   different blocks with the same decoder. */
 static int
-MS_ADPCM_decode(Uint8 ** audio_buf, Uint32 * audio_len)
+MS_ADPCM_decode_block(const struct MS_ADPCM_decoder *decoder,
+                      const Uint8 * encoded, Uint8 * decoded)
 {
-    struct MS_ADPCM_decodestate *state[2];
-    Uint8 *freeable, *encoded, *decoded;
-    Sint32 encoded_len, samplesleft;
-    Sint8 nybble;
-    Uint8 stereo;
-    Sint16 *coeff[2];
-    Sint32 new_sample;
-
-    /* Allocate the proper sized output buffer */
-    encoded_len = *audio_len;
-    encoded = *audio_buf;
-    freeable = *audio_buf;
-    *audio_len = (encoded_len / MS_ADPCM_state.wavefmt.blockalign) *
-        MS_ADPCM_state.wSamplesPerBlock *
-        MS_ADPCM_state.wavefmt.channels * sizeof(Sint16);
-    *audio_buf = (Uint8 *) SDL_malloc(*audio_len);
-    if (*audio_buf == NULL) {
-        return SDL_OutOfMemory();
+    struct MS_ADPCM_decodestate state[WAVE_MAX_CHANNELS];
+    const unsigned int channels = decoder->wavefmt.channels;
+    Sint16 *out = (Sint16 *) decoded;
+    Sint32 samplesleft;
+    unsigned int c;
+
+    /* Grab the initial information for this block: every channel's
+       predictor, then every delta, then the two starting samples. */
+    for (c = 0; c < channels; ++c) {
+        const Uint8 predictor = encoded[c];
+        if (predictor >= decoder->wNumCoef) {
+            return SDL_SetError("Invalid MS ADPCM predictor");
+        }
+        state[c].coeff = decoder->aCoeff[predictor];
+    }
+    encoded += channels;
+    for (c = 0; c < channels; ++c, encoded += 2) {
+        state[c].iDelta = (Uint16) ((encoded[1] << 8) | encoded[0]);
+    }
+    for (c = 0; c < channels; ++c, encoded += 2) {
+        state[c].iSamp1 = (Sint16) ((encoded[1] << 8) | encoded[0]);
+    }
+    for (c = 0; c < channels; ++c, encoded += 2) {
+        state[c].iSamp2 = (Sint16) ((encoded[1] << 8) | encoded[0]);
     }
-    decoded = *audio_buf;
 
-    /* Get ready... Go! */
-    stereo = (MS_ADPCM_state.wavefmt.channels == 2);
-    state[0] = &MS_ADPCM_state.state[0];
-    state[1] = &MS_ADPCM_state.state[stereo];
-    while (encoded_len >= MS_ADPCM_state.wavefmt.blockalign) {
-        /* Grab the initial information for this block */
-        state[0]->hPredictor = *encoded++;
-        if (stereo) {
-            state[1]->hPredictor = *encoded++;
-        }
-        state[0]->iDelta = ((encoded[1] << 8) | encoded[0]);
-        encoded += sizeof(Sint16);
-        if (stereo) {
-            state[1]->iDelta = ((encoded[1] << 8) | encoded[0]);
-            encoded += sizeof(Sint16);
-        }
-        state[0]->iSamp1 = ((encoded[1] << 8) | encoded[0]);
-        encoded += sizeof(Sint16);
-        if (stereo) {
-            state[1]->iSamp1 = ((encoded[1] << 8) | encoded[0]);
-            encoded += sizeof(Sint16);
-        }
-        state[0]->iSamp2 = ((encoded[1] << 8) | encoded[0]);
-        encoded += sizeof(Sint16);
-        if (stereo) {
-            state[1]->iSamp2 = ((encoded[1] << 8) | encoded[0]);
-            encoded += sizeof(Sint16);
-        }
-        coeff[0] = MS_ADPCM_state.aCoeff[state[0]->hPredictor];
-        coeff[1] = MS_ADPCM_state.aCoeff[state[1]->hPredictor];
-
-        /* Store the two initial samples we start with */
-        decoded[0] = state[0]->iSamp2 & 0xFF;
-        decoded[1] = state[0]->iSamp2 >> 8;
-        decoded += 2;
-        if (stereo) {
-            decoded[0] = state[1]->iSamp2 & 0xFF;
-            decoded[1] = state[1]->iSamp2 >> 8;
-            decoded += 2;
-        }
-        decoded[0] = state[0]->iSamp1 & 0xFF;
-        decoded[1] = state[0]->iSamp1 >> 8;
-        decoded += 2;
-        if (stereo) {
-            decoded[0] = state[1]->iSamp1 & 0xFF;
-            decoded[1] = state[1]->iSamp1 >> 8;
-            decoded += 2;
-        }
+    /* Store the two initial samples we start with */
+    for (c = 0; c < channels; ++c) {
+        out[c] = (Sint16) SDL_SwapLE16(state[c].iSamp2);
+        out[channels + c] = (Sint16) SDL_SwapLE16(state[c].iSamp1);
+    }
+    out += 2 * channels;
 
-        /* Decode and store the other samples in this block */
-        samplesleft = (MS_ADPCM_state.wSamplesPerBlock - 2) *
-            MS_ADPCM_state.wavefmt.channels;
+    /* Decode and store the other samples in this block. The nibbles are
+       interleaved like the samples, high nibble first. */
+    samplesleft = (decoder->wSamplesPerBlock - 2) * channels;
+    if (channels <= 2) {
+        struct MS_ADPCM_decodestate *second = &state[channels - 1];
         while (samplesleft > 0) {
-            nybble = (*encoded) >> 4;
-            new_sample = MS_ADPCM_nibble(state[0], nybble, coeff[0]);
-            decoded[0] = new_sample & 0xFF;
-            new_sample >>= 8;
-            decoded[1] = new_sample & 0xFF;
-            decoded += 2;
-
-            nybble = (*encoded) & 0x0F;
-            new_sample = MS_ADPCM_nibble(state[1], nybble, coeff[1]);
-            decoded[0] = new_sample & 0xFF;
-            new_sample >>= 8;
-            decoded[1] = new_sample & 0xFF;
-            decoded += 2;
-
-            ++encoded;
+            const Uint8 byte = *(encoded++);
+            out[0] = (Sint16) SDL_SwapLE16(MS_ADPCM_nibble(&state[0], byte >> 4));
+            out[1] = (Sint16) SDL_SwapLE16(MS_ADPCM_nibble(second, byte & 0x0F));
+            out += 2;
             samplesleft -= 2;
         }
-        encoded_len -= MS_ADPCM_state.wavefmt.blockalign;
+        return (0);
+    }
+    c = 0;
+    while (samplesleft > 0) {
+        const Uint8 byte = *(encoded++);
+        *(out++) = (Sint16) SDL_SwapLE16(MS_ADPCM_nibble(&state[c], byte >> 4));
+        if (++c == channels) {
+            c = 0;
+        }
+        *(out++) = (Sint16) SDL_SwapLE16(MS_ADPCM_nibble(&state[c], byte & 0x0F));
+        if (++c == channels) {
+            c = 0;
+        }
+        samplesleft -= 2;
     }
-    SDL_free(freeable);
     return (0);
 }
 
-struct IMA_ADPCM_decodestate
-{
-    Sint32 sample;
-    Sint8 index;
-};
-static struct IMA_ADPCM_decoder
+struct IMA_ADPCM_decoder
 {
     WaveFMT wavefmt;
     Uint16 wSamplesPerBlock;
     /* * * */
-    struct IMA_ADPCM_decodestate state[2];
-} IMA_ADPCM_state;
+    Uint16 step_delta[89][8];   /* what a nibble's magnitude adds, per step index */
+    Uint8 next_index[89][8];    /* ...and the step index it moves to */
+};
 
 static int
-InitIMA_ADPCM(WaveFMT * format)
+InitIMA_ADPCM(struct IMA_ADPCM_decoder *decoder, WaveFMT * format, Uint32 fmtlen)
 {
+    static const int index_table[8] = {
+        -1, -1, -1, -1, 2, 4, 6, 8
+    };
+    static const Sint32 step_table[89] = {
+        7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31,
+        34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130,
+        143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408,
+        449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282,
+        1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+        3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630,
+        9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350,
+        22385, 24623, 27086, 29794, 32767
+    };
     Uint8 *rogue_feel;
+    Uint32 channels;
+    int i, nybble;
+
+    /* the extra info and samples per block */
+    if (fmtlen < (sizeof(*format) + 2 + 2)) {
+        SDL_SetError("IMA ADPCM format chunk is too small");
+        return (-1);
+    }
 
     /* Set the rogue pointer to the IMA_ADPCM specific data */
-    IMA_ADPCM_state.wavefmt.encoding = SDL_SwapLE16(format->encoding);
-    IMA_ADPCM_state.wavefmt.channels = SDL_SwapLE16(format->channels);
-    IMA_ADPCM_state.wavefmt.frequency = SDL_SwapLE32(format->frequency);
-    IMA_ADPCM_state.wavefmt.byterate = SDL_SwapLE32(format->byterate);
-    IMA_ADPCM_state.wavefmt.blockalign = SDL_SwapLE16(format->blockalign);
-    IMA_ADPCM_state.wavefmt.bitspersample =
+    decoder->wavefmt.encoding = SDL_SwapLE16(format->encoding);
+    decoder->wavefmt.channels = SDL_SwapLE16(format->channels);
+    decoder->wavefmt.frequency = SDL_SwapLE32(format->frequency);
+    decoder->wavefmt.byterate = SDL_SwapLE32(format->byterate);
+    decoder->wavefmt.blockalign = SDL_SwapLE16(format->blockalign);
+    decoder->wavefmt.bitspersample =
         SDL_SwapLE16(format->bitspersample);
     rogue_feel = (Uint8 *) format + sizeof(*format);
     if (sizeof(*format) == 16) {
         /* const Uint16 extra_info = ((rogue_feel[1] << 8) | rogue_feel[0]); */
         rogue_feel += sizeof(Uint16);
     }
-    IMA_ADPCM_state.wSamplesPerBlock = ((rogue_feel[1] << 8) | rogue_feel[0]);
+    decoder->wSamplesPerBlock = ((rogue_feel[1] << 8) | rogue_feel[0]);
+
+    channels = decoder->wavefmt.channels;
+    if ((channels < 1) || (channels > WAVE_MAX_CHANNELS)) {
+        SDL_SetError("IMA ADPCM decoder can only handle 1 to %d channels", WAVE_MAX_CHANNELS);
+        return (-1);
+    }
+
+    /* Every block has to hold the samples it claims to, 8 at a time. */
+    if ((decoder->wSamplesPerBlock < 1) ||
+        (((decoder->wSamplesPerBlock - 1) % 8) != 0) ||
+        (decoder->wavefmt.blockalign <
+         (4 * channels) + (((decoder->wSamplesPerBlock - 1) / 2) * channels))) {
+        SDL_SetError("Invalid IMA ADPCM block size");
+        return (-1);
+    }
+
+    /* Work out each step's deltas once, instead of for every nibble. */
+    for (i = 0; i < 89; ++i) {
+        const Sint32 step = step_table[i];
+        for (nybble = 0; nybble < 8; ++nybble) {
+            Sint32 delta = step >> 3;
+            if (nybble & 0x04)
+                delta += step;
+            if (nybble & 0x02)
+                delta += (step >> 1);
+            if (nybble & 0x01)
+                delta += (step >> 2);
+            decoder->step_delta[i][nybble] = (Uint16) delta;
+            decoder->next_index[i][nybble] = (Uint8) SDL_max(0, SDL_min(88, i + index_table[nybble]));
+        }
+    }
     return (0);
 }
 
-static Sint32
-IMA_ADPCM_nibble(struct IMA_ADPCM_decodestate *state, Uint8 nybble)
+SDL_FORCE_INLINE Sint16
+IMA_ADPCM_nibble(const struct IMA_ADPCM_decoder *decoder,
+                 Sint32 * sample, Uint8 * index, const Uint8 nybble)
 {
-    const Sint32 max_audioval = ((1 << (16 - 1)) - 1);
-    const Sint32 min_audioval = -(1 << (16 - 1));
-    const int index_table[16] = {
-        -1, -1, -1, -1,
-        2, 4, 6, 8,
-        -1, -1, -1, -1,
-        2, 4, 6, 8
-    };
-    const Sint32 step_table[89] = {
-        7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31,
-        34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130,
-        143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408,
-        449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282,
-        1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
-        3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630,
-        9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350,
-        22385, 24623, 27086, 29794, 32767
-    };
-    Sint32 delta, step;
-
-    /* Compute difference and new sample value */
-    if (state->index > 88) {
-        state->index = 88;
-    } else if (state->index < 0) {
-        state->index = 0;
-    }
-    /* explicit cast to avoid gcc warning about using 'char' as array index */
-    step = step_table[(int)state->index];
-    delta = step >> 3;
-    if (nybble & 0x04)
-        delta += step;
-    if (nybble & 0x02)
-        delta += (step >> 1);
-    if (nybble & 0x01)
-        delta += (step >> 2);
-    if (nybble & 0x08)
-        delta = -delta;
-    state->sample += delta;
-
-    /* Update index value */
-    state->index += index_table[nybble];
+    const Sint32 delta = decoder->step_delta[*index][nybble & 0x07];
+    Sint32 new_sample = (nybble & 0x08) ? (*sample - delta) : (*sample + delta);
+
+    *index = decoder->next_index[*index][nybble & 0x07];
 
     /* Clamp output sample */
-    if (state->sample > max_audioval) {
-        state->sample = max_audioval;
-    } else if (state->sample < min_audioval) {
-        state->sample = min_audioval;
+    if (new_sample > 32767) {
+        new_sample = 32767;
+    } else if (new_sample < -32768) {
+        new_sample = -32768;
     }
-    return (state->sample);
+    *sample = new_sample;
+    return (Sint16) new_sample;
 }
 
-/* Fill the decode buffer with a channel block of data (8 samples) */
-static void
-Fill_IMA_ADPCM_block(Uint8 * decoded, Uint8 * encoded,
-                     int channel, int numchannels,
-                     struct IMA_ADPCM_decodestate *state)
+/* Decodes one block, (wSamplesPerBlock) sample frames of 16-bit audio.
+   Like MS ADPCM, blocks are independent, so threads can share a decoder. */
+static int
+IMA_ADPCM_decode_block(const struct IMA_ADPCM_decoder *decoder,
+                       const Uint8 * encoded, Uint8 * decoded)
 {
+    Sint32 sample[WAVE_MAX_CHANNELS];
+    Uint8 index[WAVE_MAX_CHANNELS];
+    const unsigned int channels = decoder->wavefmt.channels;
+    Sint16 *out = (Sint16 *) decoded;
+    Uint32 groups;
+    unsigned int c;
     int i;
-    Sint8 nybble;
-    Sint32 new_sample;
-
-    decoded += (channel * 2);
-    for (i = 0; i < 4; ++i) {
-        nybble = (*encoded) & 0x0F;
-        new_sample = IMA_ADPCM_nibble(state, nybble);
-        decoded[0] = new_sample & 0xFF;
-        new_sample >>= 8;
-        decoded[1] = new_sample & 0xFF;
-        decoded += 2 * numchannels;
-
-        nybble = (*encoded) >> 4;
-        new_sample = IMA_ADPCM_nibble(state, nybble);
-        decoded[0] = new_sample & 0xFF;
-        new_sample >>= 8;
-        decoded[1] = new_sample & 0xFF;
-        decoded += 2 * numchannels;
-
-        ++encoded;
+
+    /* Grab the initial information for this block */
+    for (c = 0; c < channels; ++c) {
+        const Sint8 initial_index = (Sint8) encoded[2];
+        sample[c] = (Sint16) ((encoded[1] << 8) | encoded[0]);
+        index[c] = (Uint8) SDL_max(0, SDL_min(88, initial_index));
+        /* encoded[3] is reserved, and should be 0. */
+        encoded += 4;
+
+        /* Store the initial sample we start with */
+        out[c] = (Sint16) SDL_SwapLE16((Sint16) sample[c]);
+    }
+    out += channels;
+
+    /* Decode and store the other samples in this block: each channel in
+       turn gets 4 bytes, 8 samples, low nibble first. */
+    for (groups = (decoder->wSamplesPerBlock - 1) / 8; groups > 0; --groups) {
+        for (c = 0; c < channels; ++c) {
+            Sint16 *dst = out + c;
+            Sint32 chsample = sample[c];
+            Uint8 chindex = index[c];
+            for (i = 0; i < 4; ++i) {
+                const Uint8 byte = *(encoded++);
+                *dst = (Sint16) SDL_SwapLE16(IMA_ADPCM_nibble(decoder, &chsample, &chindex, byte & 0x0F));
+                dst += channels;
+                *dst = (Sint16) SDL_SwapLE16(IMA_ADPCM_nibble(decoder, &chsample, &chindex, byte >> 4));
+                dst += channels;
+            }
+            sample[c] = chsample;
+            index[c] = chindex;
+        }
+        out += 8 * channels;
     }
+    return (0);
 }
 
+/* Everything needed to turn a WAVE file's data chunk into samples. */
+typedef struct WaveDecoder
+{
+    Uint16 encoding;
+    struct MS_ADPCM_decoder ms;
+    struct IMA_ADPCM_decoder ima;
+} WaveDecoder;
+
 static int
-IMA_ADPCM_decode(Uint8 ** audio_buf, Uint32 * audio_len)
+WaveDecodeBlock(const WaveDecoder * decoder, const Uint8 * encoded, Uint8 * decoded)
+{
+    if (decoder->encoding == MS_ADPCM_CODE) {
+        return MS_ADPCM_decode_block(&decoder->ms, encoded, decoded);
+    }
+    return IMA_ADPCM_decode_block(&decoder->ima, encoded, decoded);
+}
+
+/* A run of consecutive blocks, for one thread to decode. */
+typedef struct WaveDecodeJob
+{
+    const WaveDecoder *decoder;
+    const Uint8 *encoded;
+    Uint8 *decoded;
+    Uint32 blocks;
+    Uint32 blockalign;
+    Uint32 decoded_blocklen;
+    int result;
+} WaveDecodeJob;
+
+static int SDLCALL
+WaveDecodeBlocks(void *data)
 {
-    struct IMA_ADPCM_decodestate *state;
+    WaveDecodeJob *job = (WaveDecodeJob *) data;
+    const Uint8 *encoded = job->encoded;
+    Uint8 *decoded = job->decoded;
+    Uint32 i;
+
+    job->result = 0;
+    for (i = 0; i < job->blocks; ++i) {
+        if (WaveDecodeBlock(job->decoder, encoded, decoded) < 0) {
+            job->result = -1;
+            break;
+        }
+        encoded += job->blockalign;
+        decoded += job->decoded_blocklen;
+    }
+    return job->result;
+}
+
+/* Decodes a whole data chunk of ADPCM, replacing (audio_buf) with the
+   16-bit samples. If SDL_HINT_WAVE_DECODE_THREADS asks for it, big files
+   are split across that many threads ("0" is one per CPU). */
+static int
+ADPCM_decode(const WaveDecoder * decoder, Uint8 ** audio_buf, Uint32 * audio_len)
+{
+    WaveDecodeJob jobs[WAVE_MAX_DECODE_THREADS];
+    SDL_Thread *threads[WAVE_MAX_DECODE_THREADS];
+    const char *hint = SDL_GetHint(SDL_HINT_WAVE_DECODE_THREADS);
+    const WaveFMT *wavefmt;
+    Uint32 blockalign, decoded_blocklen, blocks;
     Uint8 *freeable, *encoded, *decoded;
-    Sint32 encoded_len, samplesleft;
-    unsigned int c, channels;
-
-    /* Check to make sure we have enough variables in the state array */
-    channels = IMA_ADPCM_state.wavefmt.channels;
-    if (channels > SDL_arraysize(IMA_ADPCM_state.state)) {
-        SDL_SetError("IMA ADPCM decoder can only handle %u channels",
-                     (unsigned int)SDL_arraysize(IMA_ADPCM_state.state));
-        return (-1);
+    int numjobs, i;
+    int retval = 0;
+
+    if (decoder->encoding == MS_ADPCM_CODE) {
+        wavefmt = &decoder->ms.wavefmt;
+        decoded_blocklen = decoder->ms.wSamplesPerBlock;
+    } else {
+        wavefmt = &decoder->ima.wavefmt;
+        decoded_blocklen = decoder->ima.wSamplesPerBlock;
     }
-    state = IMA_ADPCM_state.state;
+    blockalign = wavefmt->blockalign;
+    decoded_blocklen *= wavefmt->channels * sizeof(Sint16);
 
     /* Allocate the proper sized output buffer */
-    encoded_len = *audio_len;
     encoded = *audio_buf;
     freeable = *audio_buf;
-    *audio_len = (encoded_len / IMA_ADPCM_state.wavefmt.blockalign) *
-        IMA_ADPCM_state.wSamplesPerBlock *
-        IMA_ADPCM_state.wavefmt.channels * sizeof(Sint16);
+    blocks = *audio_len / blockalign;
+    *audio_len = blocks * decoded_blocklen;
     *audio_buf = (Uint8 *) SDL_malloc(*audio_len);
     if (*audio_buf == NULL) {
+        SDL_free(freeable);
         return SDL_OutOfMemory();
     }
     decoded = *audio_buf;
 
-    /* Get ready... Go! */
-    while (encoded_len >= IMA_ADPCM_state.wavefmt.blockalign) {
-        /* Grab the initial information for this block */
-        for (c = 0; c < channels; ++c) {
-            /* Fill the state information for this block */
-            state[c].sample = ((encoded[1] << 8) | encoded[0]);
-            encoded += 2;
-            if (state[c].sample & 0x8000) {
-                state[c].sample -= 0x10000;
-            }
-            state[c].index = *encoded++;
-            /* Reserved byte in buffer header, should be 0 */
-            if (*encoded++ != 0) {
-                /* Uh oh, corrupt data?  Buggy code? */ ;
-            }
+    numjobs = hint ? SDL_atoi(hint) : 1;
+    if (numjobs == 0) {
+        numjobs = SDL_GetCPUCount();
+    }
+    numjobs = SDL_min(numjobs, (int) (*audio_len / WAVE_MIN_DECODE_PER_THREAD));
+    numjobs = SDL_min(numjobs, (int) SDL_min(blocks, WAVE_MAX_DECODE_THREADS));
+    numjobs = SDL_max(1, numjobs);
+
+    /* Get ready... Go! This thread takes the first run itself. Every job
+       gets at least one block, the odd ones spread out between them. */
+    for (i = 0; i < numjobs; ++i) {
+        const Uint32 first = (Uint32) ((((Uint64) blocks) * i) / numjobs);
+        const Uint32 end = (Uint32) ((((Uint64) blocks) * (i + 1)) / numjobs);
+        jobs[i].decoder = decoder;
+        jobs[i].encoded = encoded + (first * blockalign);
+        jobs[i].decoded = decoded + (first * decoded_blocklen);
+        jobs[i].blocks = end - first;
+        jobs[i].blockalign = blockalign;
+        jobs[i].decoded_blocklen = decoded_blocklen;
+        threads[i] = NULL;
+        if (i > 0) {
+            threads[i] = SDL_CreateThreadInternal(WaveDecodeBlocks, "SDLWaveDecode", 0, &jobs[i]);
+        }
+    }
+    for (i = 0; i < numjobs; ++i) {
+        if (threads[i] != NULL) {
+            SDL_WaitThread(threads[i], NULL);
+        } else if (WaveDecodeBlocks(&jobs[i]) < 0) {
+            retval = -1;
+        }
+    }
 
-            /* Store the initial sample we start with */
-            decoded[0] = (Uint8) (state[c].sample & 0xFF);
-            decoded[1] = (Uint8) (state[c].sample >> 8);
-            decoded += 2;
+    /* Another thread's error message doesn't reach this one; decode its
+       run again here to get it. */
+    for (i = 0; (retval == 0) && (i < numjobs); ++i) {
+        if (jobs[i].result < 0) {
+            retval = WaveDecodeBlocks(&jobs[i]);
         }
+    }
 
-        /* Decode and store the other samples in this block */
-        samplesleft = (IMA_ADPCM_state.wSamplesPerBlock - 1) * channels;
-        while (samplesleft > 0) {
-            for (c = 0; c < channels; ++c) {
-                Fill_IMA_ADPCM_block(decoded, encoded,
-                                     c, channels, &state[c]);
-                encoded += 4;
-                samplesleft -= 8;
+    SDL_free(freeable);
+    if (retval < 0) {
+        SDL_free(*audio_buf);
+        *audio_buf = NULL;
+    }
+    return retval;
+}
+
+/* Checks the format chunk, fills in (spec), and gets the decoder ready. */
+static int
+ReadWaveFormat(WaveFMT * format, Uint32 fmtlen, SDL_AudioSpec * spec,
+               WaveDecoder * decoder)
+{
+    int was_error = 0;
+
+    if (fmtlen < sizeof(*format)) {
+        return SDL_SetError("Complex WAVE files not supported");
+    }
+
+    decoder->encoding = SDL_SwapLE16(format->encoding);
+    switch (decoder->encoding) {
+    case PCM_CODE:
+        /* We can understand this */
+        break;
+    case IEEE_FLOAT_CODE:
+        /* We can understand this */
+        break;
+    case MS_ADPCM_CODE:
+        /* Try to understand this */
+        if (InitMS_ADPCM(&decoder->ms, format, fmtlen) < 0) {
+            return (-1);
+        }
+        break;
+    case IMA_ADPCM_CODE:
+        /* Try to understand this */
+        if (InitIMA_ADPCM(&decoder->ima, format, fmtlen) < 0) {
+            return (-1);
+        }
+        break;
+    case MP3_CODE:
+        return SDL_SetError("MPEG Layer 3 data not supported");
+    default:
+        return SDL_SetError("Unknown WAVE data format: 0x%.4x",
+                            decoder->encoding);
+    }
+    SDL_memset(spec, 0, (sizeof *spec));
+    spec->freq = SDL_SwapLE32(format->frequency);
+
+    if (decoder->encoding == IEEE_FLOAT_CODE) {
+        if ((SDL_SwapLE16(format->bitspersample)) != 32) {
+            was_error = 1;
+        } else {
+            spec->format = AUDIO_F32;
+        }
+    } else {
+        switch (SDL_SwapLE16(format->bitspersample)) {
+        case 4:
+            if ((decoder->encoding == MS_ADPCM_CODE) ||
+                (decoder->encoding == IMA_ADPCM_CODE)) {
+                spec->format = AUDIO_S16;
+            } else {
+                was_error = 1;
             }
-            decoded += (channels * 8 * 2);
+            break;
+        case 8:
+            spec->format = AUDIO_U8;
+            break;
+        case 16:
+            spec->format = AUDIO_S16;
+            break;
+        case 32:
+            spec->format = AUDIO_S32;
+            break;
+        default:
+            was_error = 1;
+            break;
         }
-        encoded_len -= IMA_ADPCM_state.wavefmt.blockalign;
     }
-    SDL_free(freeable);
+
+    if (was_error) {
+        return SDL_SetError("Unknown %d-bit PCM data format",
+                            SDL_SwapLE16(format->bitspersample));
+    }
+    spec->channels = (Uint8) SDL_SwapLE16(format->channels);
+    spec->samples = 4096;       /* Good default buffer size */
+    if (spec->channels == 0) {
+        return SDL_SetError("WAVE file has no channels");
+    }
     return (0);
 }
 
@@ -410,8 +583,9 @@ SDL_LoadWAV_RW(SDL_RWops * src, int freesrc,
     int was_error;
     Chunk chunk;
     int lenread;
-    int IEEE_float_encoded, MS_ADPCM_encoded, IMA_ADPCM_encoded;
     int samplesize;
+    Uint32 fmtlen;
+    WaveDecoder decoder;
 
     /* WAV magic header */
     Uint32 RIFFchunk;
@@ -464,86 +638,17 @@ SDL_LoadWAV_RW(SDL_RWops * src, int freesrc,
 
     /* Decode the audio data format */
     format = (WaveFMT *) chunk.data;
+    fmtlen = chunk.length;
     if (chunk.magic != FMT) {
         SDL_SetError("Complex WAVE files not supported");
         was_error = 1;
         goto done;
     }
-    IEEE_float_encoded = MS_ADPCM_encoded = IMA_ADPCM_encoded = 0;
-    switch (SDL_SwapLE16(format->encoding)) {
-    case PCM_CODE:
-        /* We can understand this */
-        break;
-    case IEEE_FLOAT_CODE:
-        IEEE_float_encoded = 1;
-        /* We can understand this */
-        break;
-    case MS_ADPCM_CODE:
-        /* Try to understand this */
-        if (InitMS_ADPCM(format) < 0) {
-            was_error = 1;
-            goto done;
-        }
-        MS_ADPCM_encoded = 1;
-        break;
-    case IMA_ADPCM_CODE:
-        /* Try to understand this */
-        if (InitIMA_ADPCM(format) < 0) {
-            was_error = 1;
-            goto done;
-        }
-        IMA_ADPCM_encoded = 1;
-        break;
-    case MP3_CODE:
-        SDL_SetError("MPEG Layer 3 data not supported");
-        was_error = 1;
-        goto done;
-    default:
-        SDL_SetError("Unknown WAVE data format: 0x%.4x",
-                     SDL_SwapLE16(format->encoding));
+    SDL_zero(decoder);
+    if (ReadWaveFormat(format, fmtlen, spec, &decoder) < 0) {
         was_error = 1;
         goto done;
     }
-    SDL_memset(spec, 0, (sizeof *spec));
-    spec->freq = SDL_SwapLE32(format->frequency);
-
-    if (IEEE_float_encoded) {
-        if ((SDL_SwapLE16(format->bitspersample)) != 32) {
-            was_error = 1;
-        } else {
-            spec->format = AUDIO_F32;
-        }
-    } else {
-        switch (SDL_SwapLE16(format->bitspersample)) {
-        case 4:
-            if (MS_ADPCM_encoded || IMA_ADPCM_encoded) {
-                spec->format = AUDIO_S16;
-            } else {
-                was_error = 1;
-            }
-            break;
-        case 8:
-            spec->format = AUDIO_U8;
-            break;
-        case 16:
-            spec->format = AUDIO_S16;
-            break;
-        case 32:
-            spec->format = AUDIO_S32;
-            break;
-        default:
-            was_error = 1;
-            break;
-        }
-    }
-
-    if (was_error) {
-        SDL_SetError("Unknown %d-bit PCM data format",
-                     SDL_SwapLE16(format->bitspersample));
-        goto done;
-    }
-    spec->channels = (Uint8) SDL_SwapLE16(format->channels);
-    spec->samples = 4096;       /* Good default buffer size */
 
     /* Read the audio data chunk */
     *audio_buf = NULL;
@@ -562,14 +667,8 @@ SDL_LoadWAV_RW(SDL_RWops * src, int freesrc,
     } while (chunk.magic != DATA);
     headerDiff += 2 * sizeof(Uint32);   /* for the data chunk and len */
 
-    if (MS_ADPCM_encoded) {
-        if (MS_ADPCM_decode(audio_buf, audio_len) < 0) {
-            was_error = 1;
-            goto done;
-        }
-    }
-    if (IMA_ADPCM_encoded) {
-        if (IMA_ADPCM_decode(audio_buf, audio_len) < 0) {
+    if ((decoder.encoding == MS_ADPCM_CODE) || (decoder.encoding == IMA_ADPCM_CODE)) {
+        if (ADPCM_decode(&decoder, audio_buf, audio_len) < 0) {
             was_error = 1;
             goto done;
         }
@@ -577,7 +676,7 @@ SDL_LoadWAV_RW(SDL_RWops * src, int freesrc,
 
     /* Don't return a buffer that isn't a multiple of samplesize */
     samplesize = ((SDL_AUDIO_BITSIZE(spec->format)) / 8) * spec->channels;
-    *audio_len &= ~(samplesize - 1);
+    *audio_len -= *audio_len % samplesize;
 
   done:
     SDL_free(format);
@@ -604,6 +703,293 @@ SDL_FreeWAV(Uint8 * audio_buf)
     SDL_free(audio_buf);
 }
 
+struct _SDL_WAVStream
+{
+    SDL_RWops *src;
+    int freesrc;
+    WaveDecoder decoder;
+    Sint64 data_start;          /* file offset of the first sample */
+    Uint32 blockalign;          /* encoded bytes per block (ADPCM only) */
+    Uint32 block_frames;        /* sample frames per block (ADPCM only) */
+    Uint32 framesize;           /* decoded bytes per sample frame */
+    Sint64 frames;              /* length of the whole file, in frames */
+    Sint64 position;            /* the next frame SDL_WAVStreamRead returns */
+    Uint8 *block;               /* one encoded block; NULL for PCM */
+    Uint8 *decoded;             /* ...and what it decoded to */
+    Uint32 decoded_pos;         /* frames of (decoded) already read */
+};
+
+/* Reads and decodes the next block at the file's current position. */
+static int
+WAVStreamDecodeBlock(SDL_WAVStream * stream)
+{
+    if (SDL_RWread(stream->src, stream->block, stream->blockalign, 1) != 1) {
+        return SDL_Error(SDL_EFREAD);
+    }
+    if (WaveDecodeBlock(&stream->decoder, stream->block, stream->decoded) < 0) {
+        return (-1);
+    }
+    stream->decoded_pos = 0;
+    return (0);
+}
+
+SDL_WAVStream *
+SDL_OpenWAVStream_RW(SDL_RWops * src, int freesrc, SDL_AudioSpec * spec)
+{
+    SDL_WAVStream *stream = NULL;
+    WaveFMT *format = NULL;
+    Uint32 fmtlen = 0;
+    Uint32 magic, length;
+    Sint64 data_len = -1;
+    Sint64 filelen;
+
+    if (src == NULL) {
+        SDL_InvalidParamError("src");
+        return NULL;
+    }
+    if (spec == NULL) {
+        SDL_InvalidParamError("spec");
+        goto failed;
+    }
+
+    stream = (SDL_WAVStream *) SDL_calloc(1, sizeof (*stream));
+    if (stream == NULL) {
+        SDL_OutOfMemory();
+        goto failed;
+    }
+    stream->src = src;
+    stream->freesrc = freesrc;
+
+    /* Check the magic header */
+    magic = SDL_ReadLE32(src);
+    SDL_ReadLE32(src);
+    if ((magic != RIFF) || (SDL_ReadLE32(src) != WAVE)) {
+        SDL_SetError("Unrecognized file type (not WAVE)");
+        goto failed;
+    }
+
+    /* Walk the chunks up to the data, skipping everything but the format. */
+    while (data_len < 0) {
+        magic = SDL_ReadLE32(src);
+        length = SDL_ReadLE32(src);
+        if (magic == DATA) {
+            if (format == NULL) {
+                SDL_SetError("Complex WAVE files not supported");
+                goto failed;
+            }
+            stream->data_start = SDL_RWtell(src);
+            data_len = length;
+        } else if ((magic == FMT) && (format == NULL)) {
+            format = (WaveFMT *) SDL_malloc(length);
+            if (format == NULL) {
+                SDL_OutOfMemory();
+                goto failed;
+            }
+            fmtlen = length;
+            if (SDL_RWread(src, format, length, 1) != 1) {
+                SDL_Error(SDL_EFREAD);
+                goto failed;
+            }
+            if (length & 1) {
+                SDL_RWseek(src, 1, RW_SEEK_CUR);  /* chunks are padded to an even size. */
+            }
+        } else if ((magic == 0) && (length == 0)) {
+            SDL_SetError("WAVE file has no data chunk");
+            goto failed;
+        } else if (SDL_RWseek(src, ((Sint64) length) + (length & 1), RW_SEEK_CUR) < 0) {
+            goto failed;
+        }
+    }
+
+    if (ReadWaveFormat(format, fmtlen, spec, &stream->decoder) < 0) {
+        goto failed;
+    }
+
+    /* a header written before the length was known might overstate it. */
+    filelen = SDL_RWsize(src);
+    if ((filelen >= 0) && (stream->data_start >= 0) &&
+        (data_len > filelen - stream->data_start)) {
+        data_len = filelen - stream->data_start;
+    }
+
+    stream->framesize = ((SDL_AUDIO_BITSIZE(spec->format)) / 8) * spec->channels;
+    switch (stream->decoder.encoding) {
+    case MS_ADPCM_CODE:
+        stream->blockalign = stream->decoder.ms.wavefmt.blockalign;
+        stream->block_frames = stream->decoder.ms.wSamplesPerBlock;
+        break;
+    case IMA_ADPCM_CODE:
+        stream->blockalign = stream->decoder.ima.wavefmt.blockalign;
+        stream->block_frames = stream->decoder.ima.wSamplesPerBlock;
+        break;
+    default:
+        break;
+    }
+
+    if (stream->blockalign) {
+        stream->frames = (data_len / stream->blockalign) * stream->block_frames;
+        stream->block = (Uint8 *) SDL_malloc(stream->blockalign);
+        stream->decoded = (Uint8 *) SDL_malloc(stream->block_frames * stream->framesize);
+        if ((stream->block == NULL) || (stream->decoded == NULL)) {
+            SDL_OutOfMemory();
+            goto failed;
+        }
+        stream->decoded_pos = stream->block_frames;  /* nothing decoded yet. */
+    } else {
+        stream->frames = data_len / stream->framesize;
+    }
+
+    SDL_free(format);
+    return stream;
+
+failed:
+    SDL_free(format);
+    if (stream != NULL) {
+        SDL_free(stream->block);
+        SDL_free(stream->decoded);
+        SDL_free(stream);
+    }
+    if (freesrc) {
+        SDL_RWclose(src);
+    }
+    return NULL;
+}
+
+Sint64
+SDL_WAVStreamLength(SDL_WAVStream * stream)
+{
+    if (stream == NULL) {
+        return SDL_InvalidParamError("stream");
+    }
+    return stream->frames;
+}
+
+Sint64
+SDL_WAVStreamTell(SDL_WAVStream * stream)
+{
+    if (stream == NULL) {
+        return SDL_InvalidParamError("stream");
+    }
+    return stream->position;
+}
+
+int
+SDL_WAVStreamSeek(SDL_WAVStream * stream, Sint64 frame)
+{
+    Sint64 block;
+
+    if (stream == NULL) {
+        return SDL_InvalidParamError("stream");
+    } else if ((frame < 0) || (frame > stream->frames)) {
+        return SDL_SetError("Seek past the ends of the WAVE data");
+    }
+
+    if (stream->block == NULL) {
+        if (SDL_RWseek(stream->src, stream->data_start + (frame * stream->framesize), RW_SEEK_SET) < 0) {
+            return (-1);
+        }
+        stream->position = frame;
+        return (0);
+    }
+
+    /* ADPCM blocks only decode from their start. */
+    block = frame / stream->block_frames;
+    if (SDL_RWseek(stream->src, stream->data_start + (block * stream->blockalign), RW_SEEK_SET) < 0) {
+        return (-1);
+    }
+    stream->decoded_pos = stream->block_frames;
+    stream->position = block * stream->block_frames;
+    if (frame > stream->position) {
+        if (WAVStreamDecodeBlock(stream) < 0) {
+            return (-1);
+        }
+        stream->decoded_pos = (Uint32) (frame - stream->position);
+        stream->position = frame;
+    }
+    return (0);
+}
+
+int
+SDL_WAVStreamRead(SDL_WAVStream * stream, void *buf, int len)
+{
+    const Uint32 framesize = stream ? stream->framesize : 0;
+    Uint8 *dst = (Uint8 *) buf;
+    Sint64 frames;
+    int total = 0;
+
+    if (stream == NULL) {
+        return SDL_InvalidParamError("stream");
+    } else if (buf == NULL) {
+        return SDL_InvalidParamError("buf");
+    } else if (len < 0) {
+        return SDL_InvalidParamError("len");
+    }
+
+    frames = SDL_min((Sint64) (len / framesize), stream->frames - stream->position);
+    if (frames <= 0) {
+        return 0;
+    }
+
+    /* PCM goes straight from the file to the caller. */
+    if (stream->block == NULL) {
+        size_t got = SDL_RWread(stream->src, dst, 1, (size_t) (frames * framesize));
+        size_t partial = got % framesize;
+        /* a short read can stop partway into a frame; finish that frame, so
+           the file stays on a frame boundary for the next call. */
+        while (partial != 0) {
+            const size_t more = SDL_RWread(stream->src, dst + got, 1, framesize - partial);
+            if (more == 0) {
+                /* can't finish it now; put the piece back for next time. */
+                if (SDL_RWseek(stream->src, -((Sint64) partial), RW_SEEK_CUR) < 0) {
+                    return -1;
+                }
+                got -= partial;
+                break;
+            }
+            got += more;
+            partial = got % framesize;
+        }
+        if (got == 0) {
+            return SDL_Error(SDL_EFREAD);
+        }
+        stream->position += got / framesize;
+        return (int) got;
+    }
+
+    while (frames > 0) {
+        Uint32 avail;
+        if (stream->decoded_pos == stream->block_frames) {
+            if (WAVStreamDecodeBlock(stream) < 0) {
+                return total ? total : -1;
+            }
+        }
+        avail = stream->block_frames - stream->decoded_pos;
+        if (frames < avail) {
+            avail = (Uint32) frames;
+        }
+        SDL_memcpy(dst, stream->decoded + (stream->decoded_pos * framesize), avail * framesize);
+        dst += avail * framesize;
+        total += avail * framesize;
+        stream->decoded_pos += avail;
+        stream->position += avail;
+        frames -= avail;
+    }
+    return total;
+}
+
+void
+SDL_CloseWAVStream(SDL_WAVStream * stream)
+{
+    if (stream != NULL) {
+        if (stream->freesrc) {
+            SDL_RWclose(stream->src);
+        }
+        SDL_free(stream->block);
+        SDL_free(stream->decoded);
+        SDL_free(stream);
+    }
+}
+
 static int
 ReadChunk(SDL_RWops * src, Chunk * chunk)
 {
@@ -28,6 +28,7 @@
 #include <signal.h>             /* For kill() */
 #include <errno.h>
 #include <string.h>
+#include <poll.h>
 
 #include "SDL_timer.h"
 #include "SDL_audio.h"
@@ -35,6 +36,9 @@
 #include "../SDL_audio_c.h"
 #include "SDL_alsa_audio.h"
 
+/* In adaptive mode, the hardware buffer can grow to this many periods. */
+#define ALSA_ADAPTIVE_PERIODS 8
+
 #ifdef SDL_AUDIO_DRIVER_ALSA_DYNAMIC
 #include "SDL_loadso.h"
 #endif
@@ -44,6 +48,21 @@ static int (*ALSA_snd_pcm_open)
 static int (*ALSA_snd_pcm_close) (snd_pcm_t * pcm);
 static snd_pcm_sframes_t(*ALSA_snd_pcm_writei)
   (snd_pcm_t *, const void *, snd_pcm_uframes_t);
+static snd_pcm_sframes_t(*ALSA_snd_pcm_mmap_writei)
+  (snd_pcm_t *, const void *, snd_pcm_uframes_t);
+static int (*ALSA_snd_pcm_mmap_begin)
+  (snd_pcm_t *, const snd_pcm_channel_area_t **, snd_pcm_uframes_t *, snd_pcm_uframes_t *);
+static snd_pcm_sframes_t(*ALSA_snd_pcm_mmap_commit)
+  (snd_pcm_t *, snd_pcm_uframes_t, snd_pcm_uframes_t);
+static snd_pcm_sframes_t(*ALSA_snd_pcm_avail_update) (snd_pcm_t *);
+static int (*ALSA_snd_pcm_delay) (snd_pcm_t *, snd_pcm_sframes_t *);
+static snd_pcm_state_t(*ALSA_snd_pcm_state) (snd_pcm_t *);
+static int (*ALSA_snd_pcm_start) (snd_pcm_t *);
+static int (*ALSA_snd_pcm_poll_descriptors_count) (snd_pcm_t *);
+static int (*ALSA_snd_pcm_poll_descriptors)
+  (snd_pcm_t *, struct pollfd *, unsigned int);
+static int (*ALSA_snd_pcm_poll_descriptors_revents)
+  (snd_pcm_t *, struct pollfd *, unsigned int, unsigned short *);
 static int (*ALSA_snd_pcm_recover) (snd_pcm_t *, int, int);
 static int (*ALSA_snd_pcm_prepare) (snd_pcm_t *);
 static int (*ALSA_snd_pcm_drain) (snd_pcm_t *);
@@ -121,6 +140,16 @@ load_alsa_syms(void)
     SDL_ALSA_SYM(snd_pcm_open);
     SDL_ALSA_SYM(snd_pcm_close);
     SDL_ALSA_SYM(snd_pcm_writei);
+    SDL_ALSA_SYM(snd_pcm_mmap_writei);
+    SDL_ALSA_SYM(snd_pcm_mmap_begin);
+    SDL_ALSA_SYM(snd_pcm_mmap_commit);
+    SDL_ALSA_SYM(snd_pcm_avail_update);
+    SDL_ALSA_SYM(snd_pcm_delay);
+    SDL_ALSA_SYM(snd_pcm_state);
+    SDL_ALSA_SYM(snd_pcm_start);
+    SDL_ALSA_SYM(snd_pcm_poll_descriptors_count);
+    SDL_ALSA_SYM(snd_pcm_poll_descriptors);
+    SDL_ALSA_SYM(snd_pcm_poll_descriptors_revents);
     SDL_ALSA_SYM(snd_pcm_recover);
     SDL_ALSA_SYM(snd_pcm_prepare);
     SDL_ALSA_SYM(snd_pcm_drain);
@@ -227,11 +256,98 @@ get_audio_device(void *handle, const int channels)
 }
 
 
-/* This function waits until it is possible to write a full sound buffer */
+/* Something went wrong with the stream: count underruns and try to get
+   going again. Returns -1 (after reporting the device lost) if we can't. */
+static int
+ALSA_recover(_THIS, int status)
+{
+    if (status == -EPIPE) {
+        SDL_AtomicIncRef(&this->xruns);  /* underrun */
+    }
+    status = ALSA_snd_pcm_recover(this->hidden->pcm_handle, status, 0);
+    if (status < 0) {
+        /* Hmm, not much we can do - abort */
+        fprintf(stderr, "ALSA write failed (unrecoverable): %s\n",
+                ALSA_snd_strerror(status));
+        SDL_OpenedAudioDeviceDisconnected(this);
+        return -1;
+    }
+    return 0;
+}
+
+/* Sleeps on the PCM's poll descriptors until it's writable, it needs
+   recovering, or the timeout passes. Returns 1 if writable, 0 on timeout,
+   or a negative error code for ALSA_recover(). */
+static int
+ALSA_poll(_THIS)
+{
+    struct SDL_PrivateAudioData *h = this->hidden;
+
+    for (;;) {
+        unsigned short revents = 0;
+        int status = poll(h->pfds, h->pfd_count, h->poll_timeout);
+        if (status < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return -errno;
+        } else if (status == 0) {
+            return 0;
+        }
+
+        /* plugins may use descriptors that don't map directly to the PCM. */
+        status = ALSA_snd_pcm_poll_descriptors_revents(h->pcm_handle, h->pfds, h->pfd_count, &revents);
+        if (status < 0) {
+            return status;
+        } else if (revents & POLLERR) {
+            switch (ALSA_snd_pcm_state(h->pcm_handle)) {
+            case SND_PCM_STATE_XRUN: return -EPIPE;
+            case SND_PCM_STATE_SUSPENDED: return -ESTRPIPE;
+            default: return -EIO;
+            }
+        } else if (revents & POLLOUT) {
+            return 1;
+        }
+    }
+}
+
+/* This function waits until it is possible to write a full sound buffer.
+   In adaptive mode, that's when writing one leaves (adaptive_frames)
+   queued, which can be well before the hardware buffer has room. */
 static void
 ALSA_WaitDevice(_THIS)
 {
-    /* We're in blocking mode, so there's nothing to do here */
+    struct SDL_PrivateAudioData *h = this->hidden;
+
+    while (this->enabled) {
+        const snd_pcm_sframes_t avail = ALSA_snd_pcm_avail_update(h->pcm_handle);
+        snd_pcm_sframes_t room = (snd_pcm_sframes_t) this->spec.samples;
+        int status;
+
+        if (this->adaptive) {
+            room += (snd_pcm_sframes_t) (h->bufsize - this->adaptive_frames);
+        }
+
+        if (avail < 0) {
+            status = (int) avail;
+        } else if (avail >= room) {
+            return;
+        } else if (avail >= (snd_pcm_sframes_t) this->spec.samples) {
+            /* poll() would say it's writable already; sleep until enough
+               of what's queued has played. */
+            SDL_Delay((Uint32) (((((Uint64) (room - avail)) * 1000) + this->spec.freq - 1) / this->spec.freq));
+            continue;
+        } else {
+            status = ALSA_poll(this);
+            if (status == 0) {
+                return;  /* the device is stalled; let PlayDevice deal with it. */
+            }
+        }
+
+        if ((status < 0) && (ALSA_recover(this, status) < 0)) {
+            return;
+        }
+    }
 }
 
 
@@ -242,7 +358,7 @@ ALSA_WaitDevice(_THIS)
  *  and for Windows DirectX [and CoreAudio], this is FL-FR-C-LFE-RL-RR"
  */
 #define SWIZ6(T) \
-    T *ptr = (T *) this->hidden->mixbuf; \
+    T *ptr = (T *) buf; \
     Uint32 i; \
     for (i = 0; i < this->spec.samples; i++, ptr += 6) { \
         T tmp; \
@@ -251,25 +367,25 @@ ALSA_WaitDevice(_THIS)
     }
 
 static SDL_INLINE void
-swizzle_alsa_channels_6_64bit(_THIS)
+swizzle_alsa_channels_6_64bit(_THIS, Uint8 *buf)
 {
     SWIZ6(Uint64);
 }
 
 static SDL_INLINE void
-swizzle_alsa_channels_6_32bit(_THIS)
+swizzle_alsa_channels_6_32bit(_THIS, Uint8 *buf)
 {
     SWIZ6(Uint32);
 }
 
 static SDL_INLINE void
-swizzle_alsa_channels_6_16bit(_THIS)
+swizzle_alsa_channels_6_16bit(_THIS, Uint8 *buf)
 {
     SWIZ6(Uint16);
 }
 
 static SDL_INLINE void
-swizzle_alsa_channels_6_8bit(_THIS)
+swizzle_alsa_channels_6_8bit(_THIS, Uint8 *buf)
 {
     SWIZ6(Uint8);
 }
@@ -278,22 +394,22 @@ swizzle_alsa_channels_6_8bit(_THIS)
 
 
 /*
- * Called right before feeding this->hidden->mixbuf to the hardware. Swizzle
+ * Called right before feeding a period to the hardware. Swizzle
  *  channels from Windows/Mac order to the format alsalib will want.
  */
 static SDL_INLINE void
-swizzle_alsa_channels(_THIS)
+swizzle_alsa_channels(_THIS, Uint8 *buf)
 {
     if (this->spec.channels == 6) {
         const Uint16 fmtsize = (this->spec.format & 0xFF);      /* bits/channel. */
         if (fmtsize == 16)
-            swizzle_alsa_channels_6_16bit(this);
+            swizzle_alsa_channels_6_16bit(this, buf);
         else if (fmtsize == 8)
-            swizzle_alsa_channels_6_8bit(this);
+            swizzle_alsa_channels_6_8bit(this, buf);
         else if (fmtsize == 32)
-            swizzle_alsa_channels_6_32bit(this);
+            swizzle_alsa_channels_6_32bit(this, buf);
         else if (fmtsize == 64)
-            swizzle_alsa_channels_6_64bit(this);
+            swizzle_alsa_channels_6_64bit(this, buf);
     }
 
     /* !!! FIXME: update this for 7.1 if needed, later. */
@@ -303,46 +419,100 @@ swizzle_alsa_channels(_THIS)
 static void
 ALSA_PlayDevice(_THIS)
 {
-    int status;
-    const Uint8 *sample_buf = (const Uint8 *) this->hidden->mixbuf;
-    const int frame_size = (((int) (this->spec.format & 0xFF)) / 8) *
-                                this->spec.channels;
+    struct SDL_PrivateAudioData *h = this->hidden;
+    const Uint8 *sample_buf = (const Uint8 *) h->mixbuf;
     snd_pcm_uframes_t frames_left = ((snd_pcm_uframes_t) this->spec.samples);
+    snd_pcm_sframes_t status;
+
+    if (h->mmap_frames) {
+        /* the callback rendered straight into the ring buffer; publish it. */
+        const snd_pcm_uframes_t frames = h->mmap_frames;
+        swizzle_alsa_channels(this, h->mmap_buf);
+        h->mmap_frames = 0;
+        status = ALSA_snd_pcm_mmap_commit(h->pcm_handle, h->mmap_offset, frames);
+        if (status != (snd_pcm_sframes_t) frames) {
+            ALSA_recover(this, (status < 0) ? (int) status : -EPIPE);
+        } else if (ALSA_snd_pcm_state(h->pcm_handle) == SND_PCM_STATE_PREPARED) {
+            /* unlike the write calls, commits don't honor the start threshold. */
+            status = ALSA_snd_pcm_start(h->pcm_handle);
+            if (status < 0) {
+                ALSA_recover(this, (int) status);
+            }
+        }
+        return;
+    }
 
-    swizzle_alsa_channels(this);
+    swizzle_alsa_channels(this, h->mixbuf);
 
     while ( frames_left > 0 && this->enabled ) {
-        /* !!! FIXME: This works, but needs more testing before going live */
-        /* ALSA_snd_pcm_wait(this->hidden->pcm_handle, -1); */
-        status = ALSA_snd_pcm_writei(this->hidden->pcm_handle,
-                                     sample_buf, frames_left);
+        if (h->mmap) {
+            status = ALSA_snd_pcm_mmap_writei(h->pcm_handle, sample_buf, frames_left);
+        } else {
+            status = ALSA_snd_pcm_writei(h->pcm_handle, sample_buf, frames_left);
+        }
 
-        if (status < 0) {
-            if (status == -EAGAIN) {
-                /* Apparently snd_pcm_recover() doesn't handle this case -
-                   does it assume snd_pcm_wait() above? */
-                SDL_Delay(1);
+        if (status == -EAGAIN) {
+            /* no room yet; sleep until there is (or the stream breaks). */
+            status = ALSA_poll(this);
+            if (status >= 0) {
                 continue;
             }
-            status = ALSA_snd_pcm_recover(this->hidden->pcm_handle, status, 0);
-            if (status < 0) {
-                /* Hmm, not much we can do - abort */
-                fprintf(stderr, "ALSA write failed (unrecoverable): %s\n",
-                        ALSA_snd_strerror(status));
-                SDL_OpenedAudioDeviceDisconnected(this);
+        }
+        if (status < 0) {
+            if (ALSA_recover(this, (int) status) < 0) {
                 return;
             }
             continue;
         }
-        sample_buf += status * frame_size;
+        sample_buf += status * h->frame_size;
         frames_left -= status;
     }
 }
 
+static int
+ALSA_GetPlaybackDelay(_THIS)
+{
+    snd_pcm_sframes_t delay = 0;
+
+    /* an xrun means it all played; ALSA_WaitDevice() recovers from it. */
+    if (ALSA_snd_pcm_delay(this->hidden->pcm_handle, &delay) < 0) {
+        return -1;
+    }
+    return (delay > 0) ? (int) delay : 0;
+}
+
 static Uint8 *
 ALSA_GetDeviceBuf(_THIS)
 {
-    return (this->hidden->mixbuf);
+    struct SDL_PrivateAudioData *h = this->hidden;
+
+    if (h->mmap) {
+        const snd_pcm_channel_area_t *areas = NULL;
+        snd_pcm_uframes_t offset = 0;
+        snd_pcm_uframes_t frames = this->spec.samples;
+        snd_pcm_sframes_t avail = ALSA_snd_pcm_avail_update(h->pcm_handle);
+
+        if (avail < 0) {
+            ALSA_recover(this, (int) avail);
+            avail = ALSA_snd_pcm_avail_update(h->pcm_handle);
+        }
+
+        /* We can only render in place if a whole period fits before the
+           ring buffer wraps; otherwise, it goes through the mixing buffer. */
+        if ((avail >= (snd_pcm_sframes_t) frames) &&
+            (ALSA_snd_pcm_mmap_begin(h->pcm_handle, &areas, &offset, &frames) == 0)) {
+            if ((frames == this->spec.samples) && (areas[0].first == 0) &&
+                (areas[0].step == (unsigned int) (h->frame_size * 8))) {
+                h->mmap_buf = ((Uint8 *) areas[0].addr) + (offset * h->frame_size);
+                h->mmap_offset = offset;
+                h->mmap_frames = frames;
+                return h->mmap_buf;
+            }
+            ALSA_snd_pcm_mmap_commit(h->pcm_handle, offset, 0);
+        }
+    }
+
+    return (h->mixbuf);
 }
 
 static void
@@ -351,7 +521,11 @@ ALSA_CloseDevice(_THIS)
     if (this->hidden != NULL) {
         SDL_FreeAudioMem(this->hidden->mixbuf);
         this->hidden->mixbuf = NULL;
+        SDL_free(this->hidden->pfds);
+        this->hidden->pfds = NULL;
         if (this->hidden->pcm_handle) {
+            /* drain only waits for the queued audio in blocking mode. */
+            ALSA_snd_pcm_nonblock(this->hidden->pcm_handle, 0);
             ALSA_snd_pcm_drain(this->hidden->pcm_handle);
             ALSA_snd_pcm_close(this->hidden->pcm_handle);
             this->hidden->pcm_handle = NULL;
@@ -378,12 +552,23 @@ ALSA_finalize_hardware(_THIS, snd_pcm_hw_params_t *hwparams, int override)
     if ( status < 0 ) {
         return(-1);
     }
-    if ( !override && bufsize != this->spec.samples * 2 ) {
+    if ( !override && bufsize != this->spec.samples * this->hidden->periods ) {
         return(-1);
     }
 
+    /* When overriding, the device may have settled on a different number of
+       periods than we asked for; size the callback by what it really uses. */
+    if ( override ) {
+        unsigned int periods = 0;
+        status = ALSA_snd_pcm_hw_params_get_periods(hwparams, &periods, NULL);
+        if ( status >= 0 && periods > 0 ) {
+            this->hidden->periods = periods;
+        }
+    }
+
     /* !!! FIXME: Is this safe to do? */
-    this->spec.samples = bufsize / 2;
+    this->spec.samples = bufsize / this->hidden->periods;
+    this->hidden->bufsize = bufsize;
 
     /* This is useful for debugging */
     if ( SDL_getenv("SDL_AUDIO_ALSA_DEBUG") ) {
@@ -431,7 +616,7 @@ ALSA_set_period_size(_THIS, snd_pcm_hw_params_t *params, int override)
         return(-1);
     }
 
-    periods = 2;
+    periods = this->hidden->periods;
     status = ALSA_snd_pcm_hw_params_set_periods_near(
                 this->hidden->pcm_handle, hwparams, &periods, NULL);
     if ( status < 0 ) {
@@ -463,7 +648,7 @@ ALSA_set_buffer_size(_THIS, snd_pcm_hw_params_t *params, int override)
         }
     }
 
-    frames = this->spec.samples * 2;
+    frames = this->spec.samples * this->hidden->periods;
     status = ALSA_snd_pcm_hw_params_set_buffer_size_near(
                     this->hidden->pcm_handle, hwparams, &frames);
     if ( status < 0 ) {
@@ -479,7 +664,9 @@ ALSA_OpenDevice(_THIS, void *handle, const char *devname, int iscapture)
     int status = 0;
     snd_pcm_t *pcm_handle = NULL;
     snd_pcm_hw_params_t *hwparams = NULL;
+    snd_pcm_hw_params_t *rwparams = NULL;
     snd_pcm_sw_params_t *swparams = NULL;
+    const char *env = NULL;
     snd_pcm_format_t format = 0;
     SDL_AudioFormat test_format = 0;
     unsigned int rate = 0;
@@ -516,9 +703,24 @@ ALSA_OpenDevice(_THIS, void *handle, const char *devname, int iscapture)
                             ALSA_snd_strerror(status));
     }
 
-    /* SDL only uses interleaved sample output */
-    status = ALSA_snd_pcm_hw_params_set_access(pcm_handle, hwparams,
-                                               SND_PCM_ACCESS_RW_INTERLEAVED);
+    /* SDL only uses interleaved sample output. SDL_AUDIO_ALSA_MMAP=1 asks
+       for mmap access, so the callback can render straight into the ring
+       buffer; it's opt-in until it has seen more hardware. Otherwise, or if
+       the device refuses, copy through snd_pcm_writei(). */
+    snd_pcm_hw_params_alloca(&rwparams);
+    ALSA_snd_pcm_hw_params_copy(rwparams, hwparams);
+    env = SDL_getenv("SDL_AUDIO_ALSA_MMAP");
+    status = -1;
+    if (env && SDL_atoi(env)) {
+        status = ALSA_snd_pcm_hw_params_set_access(pcm_handle, hwparams,
+                                                   SND_PCM_ACCESS_MMAP_INTERLEAVED);
+        this->hidden->mmap = (status >= 0) ? SDL_TRUE : SDL_FALSE;
+    }
+    if (status < 0) {
+        ALSA_snd_pcm_hw_params_copy(hwparams, rwparams);
+        status = ALSA_snd_pcm_hw_params_set_access(pcm_handle, hwparams,
+                                                   SND_PCM_ACCESS_RW_INTERLEAVED);
+    }
     if (status < 0) {
         ALSA_CloseDevice(this);
         return SDL_SetError("ALSA: Couldn't set interleaved access: %s",
@@ -603,7 +805,8 @@ ALSA_OpenDevice(_THIS, void *handle, const char *devname, int iscapture)
     }
     this->spec.freq = rate;
 
-    /* Set the buffer size, in samples */
+    /* Set the buffer size, in samples. Adaptive mode gets room to grow. */
+    this->hidden->periods = this->adaptive ? ALSA_ADAPTIVE_PERIODS : 2;
     if ( ALSA_set_period_size(this, hwparams, 0) < 0 &&
          ALSA_set_buffer_size(this, hwparams, 0) < 0 ) {
         /* Failed to set desired buffer size, do the best you can... */
@@ -651,9 +854,42 @@ ALSA_OpenDevice(_THIS, void *handle, const char *devname, int iscapture)
         return SDL_OutOfMemory();
     }
     SDL_memset(this->hidden->mixbuf, this->spec.silence, this->hidden->mixlen);
+    this->hidden->frame_size = (SDL_AUDIO_BITSIZE(this->spec.format) / 8) * this->spec.channels;
 
-    /* Switch to blocking mode for playback */
-    ALSA_snd_pcm_nonblock(pcm_handle, 0);
+    /* The device stays in non-blocking mode: WaitDevice and PlayDevice
+       sleep on its poll descriptors instead, which wake up as soon as a
+       period is free, so short periods work reliably. */
+    status = ALSA_snd_pcm_poll_descriptors_count(pcm_handle);
+    if (status <= 0) {
+        ALSA_CloseDevice(this);
+        return SDL_SetError("ALSA: Couldn't get poll descriptors: %s",
+                            ALSA_snd_strerror(status));
+    }
+    this->hidden->pfd_count = status;
+    this->hidden->pfds = (struct pollfd *) SDL_calloc(status, sizeof (struct pollfd));
+    if (this->hidden->pfds == NULL) {
+        ALSA_CloseDevice(this);
+        return SDL_OutOfMemory();
+    }
+    status = ALSA_snd_pcm_poll_descriptors(pcm_handle, this->hidden->pfds, this->hidden->pfd_count);
+    if (status < 0) {
+        ALSA_CloseDevice(this);
+        return SDL_SetError("ALSA: Couldn't get poll descriptors: %s",
+                            ALSA_snd_strerror(status));
+    }
+
+    /* a stalled device shouldn't hang the audio thread; wait a bit
+       longer than a full buffer takes to drain. */
+    this->hidden->poll_timeout = (int) ((((Uint64) this->hidden->bufsize) * 1000) / this->spec.freq) + 10;
+
+    if (this->adaptive) {
+        this->adaptive_max = (Uint32) this->hidden->bufsize;
+    }
+
+    if ( SDL_getenv("SDL_AUDIO_ALSA_DEBUG") ) {
+        fprintf(stderr, "ALSA: %s access, %d poll descriptors\n",
+                this->hidden->mmap ? "mmap" : "read/write", this->hidden->pfd_count);
+    }
 
     /* We're ready to rock and roll. :-) */
     return 0;
@@ -755,10 +991,12 @@ ALSA_Init(SDL_AudioDriverImpl * impl)
     impl->OpenDevice = ALSA_OpenDevice;
     impl->WaitDevice = ALSA_WaitDevice;
     impl->GetDeviceBuf = ALSA_GetDeviceBuf;
+    impl->GetPlaybackDelay = ALSA_GetPlaybackDelay;
     impl->PlayDevice = ALSA_PlayDevice;
     impl->CloseDevice = ALSA_CloseDevice;
     impl->Deinitialize = ALSA_Deinitialize;
     impl->FreeDeviceHandle = ALSA_FreeDeviceHandle;
+    impl->SupportsAdaptiveLatency = 1;
 
     return 1;   /* this audio target is available. */
 }
@@ -23,6 +23,7 @@
 #ifndef _SDL_ALSA_audio_h
 #define _SDL_ALSA_audio_h
 
+#include <poll.h>
 #include <alsa/asoundlib.h>
 
 #include "../SDL_sysaudio.h"
@@ -38,6 +39,25 @@ struct SDL_PrivateAudioData
     /* Raw mixing buffer */
     Uint8 *mixbuf;
     int mixlen;
+    int frame_size;
+
+    /* The hardware buffer holds (periods) of the device's buffer size; in
+       adaptive mode, WaitDevice keeps only part of (bufsize) queued. */
+    unsigned int periods;
+    snd_pcm_uframes_t bufsize;
+
+    /* Poll descriptors WaitDevice and PlayDevice sleep on */
+    struct pollfd *pfds;
+    int pfd_count;
+    int poll_timeout;
+
+    /* With mmap access, GetDeviceBuf hands out the ring buffer itself when
+       a whole period is contiguous; mmap_frames is nonzero until it's
+       committed. */
+    SDL_bool mmap;
+    Uint8 *mmap_buf;
+    snd_pcm_uframes_t mmap_offset;
+    snd_pcm_uframes_t mmap_frames;
 };
 
 #endif /* _SDL_ALSA_audio_h */
@@ -22,7 +22,12 @@
 
 #if SDL_AUDIO_DRIVER_DISK
 
-/* Output raw audio data to a file. */
+/* Output raw audio data to a file, or capture it from one.
+
+   Output to a file whose name ends in ".wav" gets a WAV header, and the
+   device uses a format WAV files can hold. With SDL_DISKAUDIODELAY set to
+   0, the device thread never sleeps, so the app's callback runs as fast
+   as it can: audio renders offline, faster than realtime. */
 
 #if HAVE_STDIO_H
 #include <stdio.h>
@@ -38,61 +43,189 @@
 /* environment variables and defaults. */
 #define DISKENVR_OUTFILE         "SDL_DISKAUDIOFILE"
 #define DISKDEFAULT_OUTFILE      "sdlaudio.raw"
+#define DISKENVR_INFILE          "SDL_DISKAUDIOFILEIN"
+#define DISKDEFAULT_INFILE       "sdlaudio-in.raw"
 #define DISKENVR_WRITEDELAY      "SDL_DISKAUDIODELAY"
 #define DISKDEFAULT_WRITEDELAY   150
+#define DISKDEFAULT_WRITEBUFFER  (64 * 1024)
 
 static const char *
-DISKAUD_GetOutputFilename(const char *devname)
+DISKAUD_GetFilename(const char *devname, int iscapture)
 {
     if (devname == NULL) {
-        devname = SDL_getenv(DISKENVR_OUTFILE);
+        devname = SDL_getenv(iscapture ? DISKENVR_INFILE : DISKENVR_OUTFILE);
         if (devname == NULL) {
-            devname = DISKDEFAULT_OUTFILE;
+            devname = iscapture ? DISKDEFAULT_INFILE : DISKDEFAULT_OUTFILE;
         }
     }
     return devname;
 }
 
-/* This function waits until it is possible to write a full sound buffer */
+/* Only the WAV formats for what SDL can play: unsigned 8-bit, and signed
+   16- and 32-bit and float, all little endian. */
+static SDL_AudioFormat
+DISKAUD_GetWavFormat(SDL_AudioFormat format)
+{
+    switch (SDL_AUDIO_BITSIZE(format)) {
+    case 8:
+        return AUDIO_U8;
+    case 16:
+        return AUDIO_S16LSB;
+    default:
+        return SDL_AUDIO_ISFLOAT(format) ? AUDIO_F32LSB : AUDIO_S32LSB;
+    }
+}
+
+/* The sizes are left zero until DISKAUD_FinishWavHeader(). */
+static int
+DISKAUD_WriteWavHeader(_THIS)
+{
+    SDL_RWops *io = this->hidden->io;
+    const Uint16 bits = (Uint16) SDL_AUDIO_BITSIZE(this->spec.format);
+    const Uint16 blockalign = (bits / 8) * this->spec.channels;
+    size_t ok = 1;
+
+    ok &= SDL_RWwrite(io, "RIFF", 4, 1);
+    ok &= SDL_WriteLE32(io, 0);
+    ok &= SDL_RWwrite(io, "WAVE", 4, 1);
+    ok &= SDL_RWwrite(io, "fmt ", 4, 1);
+    ok &= SDL_WriteLE32(io, 16);
+    ok &= SDL_WriteLE16(io, SDL_AUDIO_ISFLOAT(this->spec.format) ? 0x0003 : 0x0001);
+    ok &= SDL_WriteLE16(io, this->spec.channels);
+    ok &= SDL_WriteLE32(io, (Uint32) this->spec.freq);
+    ok &= SDL_WriteLE32(io, ((Uint32) this->spec.freq) * blockalign);
+    ok &= SDL_WriteLE16(io, blockalign);
+    ok &= SDL_WriteLE16(io, bits);
+    ok &= SDL_RWwrite(io, "data", 4, 1);
+    ok &= SDL_WriteLE32(io, 0);
+
+    return ok ? 0 : SDL_SetError("Couldn't write WAV header");
+}
+
 static void
-DISKAUD_WaitDevice(_THIS)
+DISKAUD_FinishWavHeader(_THIS)
 {
-    SDL_Delay(this->hidden->write_delay);
+    SDL_RWops *io = this->hidden->io;
+    const Uint32 written = this->hidden->written;
+
+    /* chunks are padded to an even size. */
+    if (written & 1) {
+        SDL_WriteU8(io, 0);
+    }
+    if (SDL_RWseek(io, 4, RW_SEEK_SET) == 4) {
+        SDL_WriteLE32(io, 36 + written + (written & 1));
+    }
+    if (SDL_RWseek(io, 40, RW_SEEK_SET) == 40) {
+        SDL_WriteLE32(io, written);
+    }
 }
 
+/* Writes out everything that piled up in mixbuf. */
 static void
-DISKAUD_PlayDevice(_THIS)
+DISKAUD_FlushOutput(_THIS)
 {
+    struct SDL_PrivateAudioData *h = this->hidden;
     size_t written;
 
-    /* Write the audio data */
-    written = SDL_RWwrite(this->hidden->output,
-                          this->hidden->mixbuf, 1, this->hidden->mixlen);
+    if (h->mixbuf_used == 0) {
+        return;
+    }
+
+    written = SDL_RWwrite(h->io, h->mixbuf, 1, h->mixbuf_used);
+    h->written += (Uint32) written;
 
     /* If we couldn't write, assume fatal error for now */
-    if (written != this->hidden->mixlen) {
+    if (written != h->mixbuf_used) {
         SDL_OpenedAudioDeviceDisconnected(this);
     }
 #ifdef DEBUG_AUDIO
-    fprintf(stderr, "Wrote %d bytes of audio data\n", written);
+    fprintf(stderr, "Wrote %d bytes of audio data\n", (int) written);
 #endif
+    h->mixbuf_used = 0;
+}
+
+/* This function waits until it is possible to write a full sound buffer */
+static void
+DISKAUD_WaitDevice(_THIS)
+{
+    /* no delay at all renders as fast as the app can keep up. */
+    if (this->hidden->write_delay) {
+        SDL_Delay(this->hidden->write_delay);
+    }
+}
+
+static void
+DISKAUD_PlayDevice(_THIS)
+{
+    struct SDL_PrivateAudioData *h = this->hidden;
+
+    /* the buffer was filled in place; write only once another won't fit. */
+    h->mixbuf_used += h->mixlen;
+    if ((h->mixbuf_size - h->mixbuf_used) < h->mixlen) {
+        DISKAUD_FlushOutput(this);
+    }
+}
+
+static int
+DISKAUD_GetPlaybackDelay(_THIS)
+{
+    return 0;  /* a buffer is as good as in the file once it's played. */
 }
 
 static Uint8 *
 DISKAUD_GetDeviceBuf(_THIS)
 {
-    return (this->hidden->mixbuf);
+    return (this->hidden->mixbuf + this->hidden->mixbuf_used);
+}
+
+static int
+DISKAUD_CaptureFromDevice(_THIS, void *buffer, int buflen)
+{
+    struct SDL_PrivateAudioData *h = this->hidden;
+    const int origbuflen = buflen;
+
+    /* pretend the hardware takes a while to fill up, like output does. */
+    if (h->write_delay) {
+        SDL_Delay(h->write_delay);
+    }
+
+    if (h->io) {
+        const size_t br = SDL_RWread(h->io, buffer, 1, buflen);
+        buflen -= (int) br;
+        buffer = ((Uint8 *) buffer) + br;
+        if (buflen > 0) {  /* EOF (or error, but whatever). */
+            SDL_RWclose(h->io);
+            h->io = NULL;
+        }
+    }
+
+    /* if we ran out of file, just write silence. */
+    SDL_memset(buffer, this->spec.silence, buflen);
+
+    return origbuflen;
+}
+
+static void
+DISKAUD_FlushCapture(_THIS)
+{
+    /* no op...we don't advance the file pointer or anything. */
 }
 
 static void
 DISKAUD_CloseDevice(_THIS)
 {
     if (this->hidden != NULL) {
+        if ((this->hidden->io != NULL) && (this->hidden->mixbuf != NULL)) {
+            DISKAUD_FlushOutput(this);
+            if (this->hidden->wav) {
+                DISKAUD_FinishWavHeader(this);
+            }
+        }
         SDL_FreeAudioMem(this->hidden->mixbuf);
         this->hidden->mixbuf = NULL;
-        if (this->hidden->output != NULL) {
-            SDL_RWclose(this->hidden->output);
-            this->hidden->output = NULL;
+        if (this->hidden->io != NULL) {
+            SDL_RWclose(this->hidden->io);
+            this->hidden->io = NULL;
         }
         SDL_free(this->hidden);
         this->hidden = NULL;
@@ -103,8 +236,9 @@ static int
 DISKAUD_OpenDevice(_THIS, void *handle, const char *devname, int iscapture)
 {
     /* handle != NULL means "user specified the placeholder name on the fake detected device list" */
-    const char *fname = DISKAUD_GetOutputFilename(handle ? NULL : devname);
+    const char *fname = DISKAUD_GetFilename(handle ? NULL : devname, iscapture);
     const char *envr = SDL_getenv(DISKENVR_WRITEDELAY);
+    const size_t fnamelen = SDL_strlen(fname);
 
     this->hidden = (struct SDL_PrivateAudioData *)
         SDL_malloc(sizeof(*this->hidden));
@@ -113,29 +247,45 @@ DISKAUD_OpenDevice(_THIS, void *handle, const char *devname, int iscapture)
     }
     SDL_memset(this->hidden, 0, sizeof(*this->hidden));
 
-    this->hidden->mixlen = this->spec.size;
     this->hidden->write_delay =
         (envr) ? SDL_atoi(envr) : DISKDEFAULT_WRITEDELAY;
 
+    if (!iscapture && (fnamelen >= 4) && (SDL_strcasecmp(fname + fnamelen - 4, ".wav") == 0)) {
+        this->hidden->wav = SDL_TRUE;
+        this->spec.format = DISKAUD_GetWavFormat(this->spec.format);
+        SDL_CalculateAudioSpec(&this->spec);
+    }
+    this->hidden->mixlen = this->spec.size;
+
     /* Open the audio device */
-    this->hidden->output = SDL_RWFromFile(fname, "wb");
-    if (this->hidden->output == NULL) {
+    this->hidden->io = SDL_RWFromFile(fname, iscapture ? "rb" : "wb");
+    if (this->hidden->io == NULL) {
         DISKAUD_CloseDevice(this);
         return -1;
     }
 
-    /* Allocate mixing buffer */
-    this->hidden->mixbuf = (Uint8 *) SDL_AllocAudioMem(this->hidden->mixlen);
-    if (this->hidden->mixbuf == NULL) {
+    if (this->hidden->wav && (DISKAUD_WriteWavHeader(this) < 0)) {
         DISKAUD_CloseDevice(this);
         return -1;
     }
-    SDL_memset(this->hidden->mixbuf, this->spec.silence, this->spec.size);
+
+    /* Allocate mixing buffer, with room for several buffers of output. */
+    if (!iscapture) {
+        const Uint32 mixlen = this->hidden->mixlen;
+        this->hidden->mixbuf_size = SDL_max(DISKDEFAULT_WRITEBUFFER / mixlen, 1) * mixlen;
+        this->hidden->mixbuf = (Uint8 *) SDL_AllocAudioMem(this->hidden->mixbuf_size);
+        if (this->hidden->mixbuf == NULL) {
+            DISKAUD_CloseDevice(this);
+            return SDL_OutOfMemory();
+        }
+        SDL_memset(this->hidden->mixbuf, this->spec.silence, this->hidden->mixbuf_size);
+    }
 
 #if HAVE_STDIO_H
     fprintf(stderr,
-            "WARNING: You are using the SDL disk writer audio driver!\n"
-            " Writing to file [%s].\n", fname);
+            "WARNING: You are using the SDL disk %s audio driver!\n"
+            " %s file [%s].\n", iscapture ? "reader" : "writer",
+            iscapture ? "Reading from" : "Writing to", fname);
 #endif
 
     /* We're ready to rock and roll. :-) */
@@ -145,8 +295,9 @@ DISKAUD_OpenDevice(_THIS, void *handle, const char *devname, int iscapture)
 static void
 DISKAUD_DetectDevices(void)
 {
-    /* !!! FIXME: stole this literal string from DEFAULT_OUTPUT_DEVNAME in SDL_audio.c */
+    /* !!! FIXME: stole these literal strings from DEFAULT_*_DEVNAME in SDL_audio.c */
     SDL_AddAudioDevice(SDL_FALSE, "System audio output device", (void *) 0x1);
+    SDL_AddAudioDevice(SDL_TRUE, "System audio capture device", (void *) 0x2);
 }
 
 static int
@@ -156,11 +307,15 @@ DISKAUD_Init(SDL_AudioDriverImpl * impl)
     impl->OpenDevice = DISKAUD_OpenDevice;
     impl->WaitDevice = DISKAUD_WaitDevice;
     impl->PlayDevice = DISKAUD_PlayDevice;
+    impl->GetPlaybackDelay = DISKAUD_GetPlaybackDelay;
     impl->GetDeviceBuf = DISKAUD_GetDeviceBuf;
+    impl->CaptureFromDevice = DISKAUD_CaptureFromDevice;
+    impl->FlushCapture = DISKAUD_FlushCapture;
     impl->CloseDevice = DISKAUD_CloseDevice;
     impl->DetectDevices = DISKAUD_DetectDevices;
 
     impl->AllowsArbitraryDeviceNames = 1;
+    impl->HasCaptureSupport = 1;
 
     return 1;   /* this audio target is available. */
 }
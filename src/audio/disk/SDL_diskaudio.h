@@ -32,10 +32,14 @@
 struct SDL_PrivateAudioData
 {
     /* The file descriptor for the audio device */
-    SDL_RWops *output;
-    Uint8 *mixbuf;
+    SDL_RWops *io;
+    Uint8 *mixbuf;  /* output piles up here, (mixlen) bytes a buffer... */
     Uint32 mixlen;
+    Uint32 mixbuf_size;  /* ...and goes to disk when another won't fit. */
+    Uint32 mixbuf_used;
     Uint32 write_delay;
+    SDL_bool wav;  /* writing a .wav file; its header is finished on close. */
+    Uint32 written;  /* bytes of audio written to the file so far. */
 };
 
 #endif /* _SDL_diskaudio_h */
@@ -42,6 +42,7 @@
 
 #include "SDL_timer.h"
 #include "SDL_audio.h"
+#include "SDL_hints.h"
 #include "../SDL_audiomem.h"
 #include "../SDL_audio_c.h"
 #include "SDL_pulseaudio.h"
@@ -101,6 +102,11 @@ static pa_stream * (*PULSEAUDIO_pa_stream_new) (pa_context *, const char *,
 static int (*PULSEAUDIO_pa_stream_connect_playback) (pa_stream *, const char *,
     const pa_buffer_attr *, pa_stream_flags_t, pa_cvolume *, pa_stream *);
 static pa_stream_state_t (*PULSEAUDIO_pa_stream_get_state) (pa_stream *);
+static void (*PULSEAUDIO_pa_stream_set_write_callback) (pa_stream *,
+    pa_stream_request_cb_t, void *);
+static const pa_buffer_attr * (*PULSEAUDIO_pa_stream_get_buffer_attr) (pa_stream *);
+static pa_usec_t (*PULSEAUDIO_pa_bytes_to_usec) (uint64_t, const pa_sample_spec *);
+static int (*PULSEAUDIO_pa_stream_get_latency) (pa_stream *, pa_usec_t *, int *);
 static size_t (*PULSEAUDIO_pa_stream_writable_size) (pa_stream *);
 static int (*PULSEAUDIO_pa_stream_write) (pa_stream *, const void *, size_t,
     pa_free_cb_t, int64_t, pa_seek_mode_t);
@@ -207,6 +213,10 @@ load_pulseaudio_syms(void)
     SDL_PULSEAUDIO_SYM(pa_stream_new);
     SDL_PULSEAUDIO_SYM(pa_stream_connect_playback);
     SDL_PULSEAUDIO_SYM(pa_stream_get_state);
+    SDL_PULSEAUDIO_SYM(pa_stream_set_write_callback);
+    SDL_PULSEAUDIO_SYM(pa_stream_get_buffer_attr);
+    SDL_PULSEAUDIO_SYM(pa_bytes_to_usec);
+    SDL_PULSEAUDIO_SYM(pa_stream_get_latency);
     SDL_PULSEAUDIO_SYM(pa_stream_writable_size);
     SDL_PULSEAUDIO_SYM(pa_stream_write);
     SDL_PULSEAUDIO_SYM(pa_stream_drain);
@@ -327,18 +337,30 @@ PULSEAUDIO_WaitDevice(_THIS)
     struct SDL_PrivateAudioData *h = this->hidden;
 
     while (this->enabled) {
+        if (h->low_latency && (h->bytes_requested >= (size_t) h->mixlen)) {
+            return;  /* the write callback already asked for a buffer. */
+        }
         if (PULSEAUDIO_pa_context_get_state(h->context) != PA_CONTEXT_READY ||
             PULSEAUDIO_pa_stream_get_state(h->stream) != PA_STREAM_READY ||
             PULSEAUDIO_pa_mainloop_iterate(h->mainloop, 1, NULL) < 0) {
             SDL_OpenedAudioDeviceDisconnected(this);
             return;
         }
-        if (PULSEAUDIO_pa_stream_writable_size(h->stream) >= h->mixlen) {
+        if (!h->low_latency && (PULSEAUDIO_pa_stream_writable_size(h->stream) >= h->mixlen)) {
             return;
         }
     }
 }
 
+/* Called from pa_mainloop_iterate() when the server wants more data;
+   (nbytes) is everything it has room for right now. */
+static void
+StreamWriteCallback(pa_stream *s, size_t nbytes, void *userdata)
+{
+    struct SDL_PrivateAudioData *h = (struct SDL_PrivateAudioData *) userdata;
+    h->bytes_requested = nbytes;
+}
+
 static void
 PULSEAUDIO_PlayDevice(_THIS)
 {
@@ -348,7 +370,27 @@ PULSEAUDIO_PlayDevice(_THIS)
         if (PULSEAUDIO_pa_stream_write(h->stream, h->mixbuf, h->mixlen, NULL, 0LL, PA_SEEK_RELATIVE) < 0) {
             SDL_OpenedAudioDeviceDisconnected(this);
         }
+        if (h->bytes_requested > (size_t) h->mixlen) {
+            h->bytes_requested -= h->mixlen;
+        } else {
+            h->bytes_requested = 0;
+        }
+    }
+}
+
+static int
+PULSEAUDIO_GetPlaybackDelay(_THIS)
+{
+    pa_usec_t latency = 0;
+    int negative = 0;
+
+    /* fails until the server sends the first timing update. */
+    if (PULSEAUDIO_pa_stream_get_latency(this->hidden->stream, &latency, &negative) < 0) {
+        return -1;
+    } else if (negative) {
+        return 0;
     }
+    return (int) ((latency * this->spec.freq) / 1000000);
 }
 
 static void
@@ -433,6 +475,10 @@ PULSEAUDIO_OpenDevice(_THIS, void *handle, const char *devname, int iscapture)
     pa_buffer_attr paattr;
     pa_channel_map pacmap;
     pa_stream_flags_t flags = 0;
+    const pa_buffer_attr *actualattr = NULL;
+#ifdef PA_STREAM_ADJUST_LATENCY
+    const char *hint = NULL;
+#endif
     int state = 0;
 
     /* Initialize all variables that we clean on shutdown */
@@ -490,7 +536,11 @@ PULSEAUDIO_OpenDevice(_THIS, void *handle, const char *devname, int iscapture)
 
     /* Calculate the final parameters for this audio specification */
 #ifdef PA_STREAM_ADJUST_LATENCY
-    this->spec.samples /= 2; /* Mix in smaller chunck to avoid underruns */
+    hint = SDL_GetHint(SDL_HINT_AUDIO_PULSEAUDIO_LOW_LATENCY);
+    h->low_latency = (hint && (*hint != '0')) ? SDL_TRUE : SDL_FALSE;
+    if (!h->low_latency) {
+        this->spec.samples /= 2; /* Mix in smaller chunck to avoid underruns */
+    }
 #endif
     SDL_CalculateAudioSpec(&this->spec);
 
@@ -508,13 +558,24 @@ PULSEAUDIO_OpenDevice(_THIS, void *handle, const char *devname, int iscapture)
 
     /* Reduced prebuffering compared to the defaults. */
 #ifdef PA_STREAM_ADJUST_LATENCY
-    /* 2x original requested bufsize */
-    paattr.tlength = h->mixlen * 4;
-    paattr.prebuf = -1;
-    paattr.maxlength = -1;
-    /* -1 can lead to pa_stream_writable_size() >= mixlen never being true */
-    paattr.minreq = h->mixlen;
-    flags = PA_STREAM_ADJUST_LATENCY;
+    if (h->low_latency) {
+        /* Two buffers on the server, refilled a buffer at a time, and
+           playback starts as soon as the first one arrives. */
+        paattr.tlength = h->mixlen * 2;
+        paattr.prebuf = h->mixlen;
+        paattr.maxlength = h->mixlen * 2;
+        paattr.minreq = h->mixlen;
+        paattr.fragsize = -1;
+        flags = PA_STREAM_ADJUST_LATENCY;
+    } else {
+        /* 2x original requested bufsize */
+        paattr.tlength = h->mixlen * 4;
+        paattr.prebuf = -1;
+        paattr.maxlength = -1;
+        /* -1 can lead to pa_stream_writable_size() >= mixlen never being true */
+        paattr.minreq = h->mixlen;
+        flags = PA_STREAM_ADJUST_LATENCY;
+    }
 #else
     paattr.tlength = h->mixlen*2;
     paattr.prebuf = h->mixlen*2;
@@ -549,12 +610,19 @@ PULSEAUDIO_OpenDevice(_THIS, void *handle, const char *devname, int iscapture)
         return SDL_SetError("Could not set up PulseAudio stream");
     }
 
+    if (h->low_latency) {
+        PULSEAUDIO_pa_stream_set_write_callback(h->stream, StreamWriteCallback, h);
+    }
+
     /* now that we have multi-device support, don't move a stream from
         a device that was unplugged to something else, unless we're default. */
     if (h->device_name != NULL) {
         flags |= PA_STREAM_DONT_MOVE;
     }
 
+    /* keep the server's playback position current for GetPlaybackDelay. */
+    flags |= PA_STREAM_INTERPOLATE_TIMING | PA_STREAM_AUTO_TIMING_UPDATE;
+
     if (PULSEAUDIO_pa_stream_connect_playback(h->stream, h->device_name, &paattr, flags,
             NULL, NULL) < 0) {
         PULSEAUDIO_CloseDevice(this);
@@ -573,6 +641,12 @@ PULSEAUDIO_OpenDevice(_THIS, void *handle, const char *devname, int iscapture)
         }
     } while (state != PA_STREAM_READY);
 
+    /* the server may not have given us the buffering we asked for. */
+    actualattr = PULSEAUDIO_pa_stream_get_buffer_attr(h->stream);
+    if (actualattr) {
+        this->latency_us = (Uint32) PULSEAUDIO_pa_bytes_to_usec(actualattr->tlength, &paspec);
+    }
+
     /* We're ready to rock and roll. :-) */
     return 0;
 }
@@ -684,6 +758,7 @@ PULSEAUDIO_Init(SDL_AudioDriverImpl * impl)
     impl->PlayDevice = PULSEAUDIO_PlayDevice;
     impl->WaitDevice = PULSEAUDIO_WaitDevice;
     impl->GetDeviceBuf = PULSEAUDIO_GetDeviceBuf;
+    impl->GetPlaybackDelay = PULSEAUDIO_GetPlaybackDelay;
     impl->CloseDevice = PULSEAUDIO_CloseDevice;
     impl->WaitDone = PULSEAUDIO_WaitDone;
     impl->Deinitialize = PULSEAUDIO_Deinitialize;
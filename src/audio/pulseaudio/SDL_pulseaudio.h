@@ -42,6 +42,11 @@ struct SDL_PrivateAudioData
     /* Raw mixing buffer */
     Uint8 *mixbuf;
     int mixlen;
+
+    /* In low latency mode, the stream's write callback says how much the
+       server wants, instead of WaitDevice asking after every wakeup. */
+    SDL_bool low_latency;
+    size_t bytes_requested;
 };
 
 #endif /* _SDL_pulseaudio_h */
@@ -16,9 +16,33 @@ my @audiotypes = qw(
     F32MSB
 );
 
-my @channels = ( 1, 2, 4, 6, 8 );
+# The hottest conversions that change the channel count get a converter
+#  that changes the data type and remixes in the same pass, instead of
+#  converting to float, remixing, and converting back. SDL_BuildAudioCVT
+#  uses them, with or without a resampler between the halves, whenever the
+#  formats and channel counts match one of these exactly and the CPU can't
+#  run the SSE2 type converters and remixer, which are faster than these.
+#  5.1 downmixes aren't here; they measured no faster than the separate passes.
+my @fusedconverters = (
+    # from, channels, to, channels
+    [ 'U8', 1, 'S16LSB', 2 ],
+    [ 'U8', 1, 'F32LSB', 2 ],
+    [ 'S16LSB', 1, 'S16LSB', 2 ],
+    [ 'S16LSB', 1, 'F32LSB', 2 ],
+    [ 'S16LSB', 2, 'S16LSB', 1 ],
+    [ 'S16LSB', 2, 'F32LSB', 1 ],
+    [ 'S16LSB', 2, 'S16LSB', 6 ],
+    [ 'F32LSB', 1, 'S16LSB', 2 ],
+    [ 'F32LSB', 2, 'S16LSB', 1 ],
+    [ 'F32LSB', 2, 'S16LSB', 6 ],
+    [ 'S32LSB', 1, 'F32LSB', 2 ],
+    [ 'S32LSB', 2, 'F32LSB', 1 ],
+    [ 'F32LSB', 1, 'S32LSB', 2 ],
+);
+
 my %funcs;
 my $custom_converters = 0;
+my $fused_converters = 0;
 
 
 sub getTypeConvertHashId {
@@ -27,12 +51,6 @@ sub getTypeConvertHashId {
 }
 
 
-sub getResamplerHashId {
-    my ($from, $channels, $upsample, $multiple) = @_;
-    return "RESAMPLER $from/$channels/$upsample/$multiple";
-}
-
-
 sub outputHeader {
     print <<EOF;
 /* DO NOT EDIT!  This file is generated by sdlgenaudiocvt.pl */
@@ -68,16 +86,6 @@ sub outputHeader {
 
 /* If you can guarantee your data and need space, you can eliminate code... */
 
-/* Just build the arbitrary resamplers if you're saving code space. */
-#ifndef LESS_RESAMPLERS
-#define LESS_RESAMPLERS 0
-#endif
-
-/* Don't build any resamplers if you're REALLY saving code space. */
-#ifndef NO_RESAMPLERS
-#define NO_RESAMPLERS 0
-#endif
-
 /* Don't build any type converters if you're saving code space. */
 #ifndef NO_CONVERTERS
 #define NO_CONVERTERS 0
@@ -87,20 +95,12 @@ sub outputHeader {
 /* *INDENT-OFF* */
 
 EOF
-
-    my @vals = ( 127, 32767, 2147483647 );
-    foreach (@vals) {
-        my $val = $_;
-        my $fval = 1.0 / $val;
-        print("#define DIVBY${val} ${fval}f\n");
-    }
-
-    print("\n");
 }
 
 sub outputFooter {
     print <<EOF;
 /* $custom_converters converters generated. */
+/* $fused_converters fused converters generated. */
 
 /* *INDENT-ON* */
 
@@ -168,6 +168,17 @@ sub getFloatToIntMult {
     return $val;
 }
 
+# Float to int truncates the product, so it has to be rounded to float
+#  first, like SIMD code does, or x87 math can truncate a different value.
+#  32-bit ints multiply in double, which SIMD code doesn't try to match.
+sub getRoundedProductCode {
+    my ($size, $code, $mult) = @_;
+    if ($size < 32) {
+        return "SDL_RoundFloat($code * $mult)";
+    }
+    return "($code * $mult)";
+}
+
 sub getIntToFloatDivBy {
     my $size = shift;
     return 'DIVBY' . maxIntVal($size);
@@ -245,7 +256,8 @@ EOF
                 if (!$tsigned) {   # bump from -1.0f/1.0f to 0.0f/2.0f
                     $code = "($code + 1.0f)";
                 }
-                $code = "(($tctype) ($code * $mult))";
+                $code = getRoundedProductCode($tsize, $code, $mult);
+                $code = "(($tctype) $code)";
             } else {
                 # $divby will be the reciprocal, to avoid pipeline stalls
                 #  from floating point division...so multiply it.
@@ -341,418 +353,151 @@ sub buildTypeConverters {
     print "};\n\n\n";
 }
 
-sub getBiggerCtype {
-    my ($isfloat, $size) = @_;
-
-    if ($isfloat) {
-        if ($size == 32) {
-            return 'double';
+# The expressions the fused converters use: the same arithmetic as
+#  buildCvtFunc and SDL_RemixChannels, rounded to float at every step
+#  they store or round one, so fusing doesn't change a single bit of the
+#  output.
+sub getToFloatCode {
+    my ($from, $val) = @_;
+    my ($fsigned, $ffloat, $fsize, $fendian, $fctype) = splittype($from);
+    my $code = getSwapFunc($fsize, $fsigned, $ffloat, $fendian, $val);
+    if (!$ffloat) {
+        my $divby = getIntToFloatDivBy($fsize);
+        $code = "(((float) $code) * $divby)";
+        if (!$fsigned) {
+            $code = "($code - 1.0f)";
         }
-        die("bug in script.\n");
     }
+    return $code;
+}
 
-    if ($size == 8) {
-        return 'Sint16';
-    } elsif ($size == 16) {
-        return 'Sint32'
-    } elsif ($size == 32) {
-        return 'Sint64'
+sub getFromFloatCode {
+    my ($to, $val) = @_;
+    my ($tsigned, $tfloat, $tsize, $tendian, $tctype) = splittype($to);
+    my $code = $val;
+    if (!$tfloat) {
+        my $mult = getFloatToIntMult($tsize);
+        if (!$tsigned) {
+            $code = "($code + 1.0f)";
+        }
+        $code = getRoundedProductCode($tsize, $code, $mult);
+        $code = "(($tctype) $code)";
     }
-
-    die("bug in script.\n");
+    return $code;
 }
 
-
-# These handle arbitrary resamples...44100Hz to 48000Hz, for example.
-# Man, this code is skanky.
-sub buildArbitraryResampleFunc {
-    # !!! FIXME: we do a lot of unnecessary and ugly casting in here, due to getSwapFunc().
-    my ($from, $channels, $upsample) = @_;
+sub buildFusedCvtFunc {
+    my ($from, $fchans, $to, $tchans) = @_;
     my ($fsigned, $ffloat, $fsize, $fendian, $fctype) = splittype($from);
+    my ($tsigned, $tfloat, $tsize, $tendian, $tctype) = splittype($to);
+    my $sym = "SDL_Convert_${from}_${fchans}ch_to_${to}_${tchans}ch";
+    my $srctype = (($ffloat) ? 'float' : "Uint${fsize}");
+    my $silence = ((!$tsigned) and ($tsize == 8)) ? '0x80' : "'\\0'";
+    my ($i, $j);
 
-    my $bigger = getBiggerCtype($ffloat, $fsize);
-    my $interp = ($ffloat) ? '* 0.5' : '>> 1';
-
-    my $resample = ($upsample) ? 'Upsample' : 'Downsample';
-    my $hashid = getResamplerHashId($from, $channels, $upsample, 0);
-    my $sym = "SDL_${resample}_${from}_${channels}c";
-    $funcs{$hashid} = $sym;
-    $custom_converters++;
-
-    my $fudge = $fsize * $channels * 2;  # !!! FIXME
-    my $eps_adjust = ($upsample) ? 'dstsize' : 'srcsize';
-    my $incr = '';
-    my $incr2 = '';
-    my $block_align = $channels * $fsize/8;
-
+    $funcs{"FUSED $from/$fchans/$to/$tchans"} = $sym;
+    $fused_converters++;
 
-    # !!! FIXME: DEBUG_CONVERT should report frequencies.
     print <<EOF;
 static void SDLCALL
 ${sym}(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 {
+    const SDL_ChannelMatrix *matrix = SDL_GetCVTChannelMatrix(cvt);
+    const int frames = cvt->len_cvt / ($fchans * sizeof ($srctype));
+    const $srctype *src;
+    $tctype *dst;
+    int i;
+
 #if DEBUG_CONVERT
-    fprintf(stderr, "$resample arbitrary (x%f) AUDIO_${from}, ${channels} channels.\\n", cvt->rate_incr);
+    fprintf(stderr, "Converting AUDIO_${from} to AUDIO_${to}, $fchans to $tchans channels.\\n");
 #endif
 
-    const int srcsize = cvt->len_cvt - $fudge;
-    const int dstsize = (int) (((double)(cvt->len_cvt/${block_align})) * cvt->rate_incr) * ${block_align};
-    register int eps = 0;
-EOF
-
-    my $endcomparison = '!=';
-
-    # Upsampling (growing the buffer) needs to work backwards, since we
-    #  overwrite the buffer as we go.
-    if ($upsample) {
-        $endcomparison = '>=';  # dst > target
-        print <<EOF;
-    $fctype *dst = (($fctype *) (cvt->buf + dstsize)) - $channels;
-    const $fctype *src = (($fctype *) (cvt->buf + cvt->len_cvt)) - $channels;
-    const $fctype *target = ((const $fctype *) cvt->buf);
-EOF
+    if (!matrix) {
+        /* out of memory; the best we can do is silence of the right size. */
+        cvt->len_cvt = frames * $tchans * sizeof ($tctype);
+        SDL_memset(cvt->buf, $silence, cvt->len_cvt);
     } else {
-        $endcomparison = '<';  # dst < target
-        print <<EOF;
-    $fctype *dst = ($fctype *) cvt->buf;
-    const $fctype *src = ($fctype *) cvt->buf;
-    const $fctype *target = (const $fctype *) (cvt->buf + dstsize);
 EOF
-    }
-
-    for (my $i = 0; $i < $channels; $i++) {
-        my $idx = ($upsample) ? (($channels - $i) - 1) : $i;
-        my $val = getSwapFunc($fsize, $fsigned, $ffloat, $fendian, "src[$idx]");
-        print <<EOF;
-    $fctype sample${idx} = $val;
-EOF
-    }
 
-    for (my $i = 0; $i < $channels; $i++) {
-        my $idx = ($upsample) ? (($channels - $i) - 1) : $i;
-        print <<EOF;
-    $fctype last_sample${idx} = sample${idx};
-EOF
-    }
-
-    print <<EOF;
-    while (dst $endcomparison target) {
-EOF
-
-    if ($upsample) {
-        for (my $i = 0; $i < $channels; $i++) {
-            # !!! FIXME: don't do this swap every write, just when the samples change.
-            my $idx = (($channels - $i) - 1);
-            my $val = getSwapFunc($fsize, $fsigned, $ffloat, $fendian, "sample${idx}");
-            print <<EOF;
-        dst[$idx] = $val;
-EOF
-        }
-
-        $incr = ($channels == 1) ? 'dst--' : "dst -= $channels";
-        $incr2 = ($channels == 1) ? 'src--' : "src -= $channels";
-
-        print <<EOF;
-        $incr;
-        eps += srcsize;
-        if ((eps << 1) >= dstsize) {
-            $incr2;
-EOF
-    } else {  # downsample.
-        $incr = ($channels == 1) ? 'src++' : "src += $channels";
-        print <<EOF;
-        $incr;
-        eps += dstsize;
-        if ((eps << 1) >= srcsize) {
-EOF
-        for (my $i = 0; $i < $channels; $i++) {
-            my $val = getSwapFunc($fsize, $fsigned, $ffloat, $fendian, "sample${i}");
-            print <<EOF;
-            dst[$i] = $val;
-EOF
-        }
-
-        $incr = ($channels == 1) ? 'dst++' : "dst += $channels";
-        print <<EOF;
-            $incr;
-EOF
-    }
-
-    for (my $i = 0; $i < $channels; $i++) {
-        my $idx = ($upsample) ? (($channels - $i) - 1) : $i;
-        my $swapped = getSwapFunc($fsize, $fsigned, $ffloat, $fendian, "src[$idx]");
-        print <<EOF;
-            sample${idx} = ($fctype) (((($bigger) $swapped) + (($bigger) last_sample${idx})) $interp);
-EOF
-    }
-
-    for (my $i = 0; $i < $channels; $i++) {
-        my $idx = ($upsample) ? (($channels - $i) - 1) : $i;
-        print <<EOF;
-            last_sample${idx} = sample${idx};
-EOF
-    }
-
-    print <<EOF;
-            eps -= $eps_adjust;
+    for ($j = 0; $j < $tchans; $j++) {
+        for ($i = 0; $i < $fchans; $i++) {
+            my $idx = ($j * $fchans) + $i;
+            print("        const float c${j}_${i} = matrix->coeffs[$idx];\n");
         }
     }
-EOF
 
+    # grows the data in place, so work back from the end.
+    if (($tchans * $tsize) > ($fchans * $fsize)) {
         print <<EOF;
-    cvt->len_cvt = dstsize;
-    if (cvt->filters[++cvt->filter_index]) {
-        cvt->filters[cvt->filter_index] (cvt, format);
-    }
-}
-
-EOF
-
-}
-
-# These handle clean resamples...doubling and quadrupling the sample rate, etc.
-sub buildMultipleResampleFunc {
-    # !!! FIXME: we do a lot of unnecessary and ugly casting in here, due to getSwapFunc().
-    my ($from, $channels, $upsample, $multiple) = @_;
-    my ($fsigned, $ffloat, $fsize, $fendian, $fctype) = splittype($from);
-
-    my $bigger = getBiggerCtype($ffloat, $fsize);
-    my $interp = ($ffloat) ? '* 0.5' : '>> 1';
-    my $interp2 = ($ffloat) ? '* 0.25' : '>> 2';
-    my $mult3 = ($ffloat) ? '3.0' : '3';
-    my $lencvtop = ($upsample) ? '*' : '/';
-
-    my $resample = ($upsample) ? 'Upsample' : 'Downsample';
-    my $hashid = getResamplerHashId($from, $channels, $upsample, $multiple);
-    my $sym = "SDL_${resample}_${from}_${channels}c_x${multiple}";
-    $funcs{$hashid} = $sym;
-    $custom_converters++;
-
-    # !!! FIXME: DEBUG_CONVERT should report frequencies.
-    print <<EOF;
-static void SDLCALL
-${sym}(SDL_AudioCVT * cvt, SDL_AudioFormat format)
-{
-#if DEBUG_CONVERT
-    fprintf(stderr, "$resample (x${multiple}) AUDIO_${from}, ${channels} channels.\\n");
-#endif
-
-    const int dstsize = cvt->len_cvt $lencvtop $multiple;
-EOF
-
-    my $endcomparison = '!=';
-
-    # Upsampling (growing the buffer) needs to work backwards, since we
-    #  overwrite the buffer as we go.
-    if ($upsample) {
-        $endcomparison = '>=';  # dst > target
-        print <<EOF;
-    $fctype *dst = (($fctype *) (cvt->buf + dstsize)) - $channels * $multiple;
-    const $fctype *src = (($fctype *) (cvt->buf + cvt->len_cvt)) - $channels;
-    const $fctype *target = ((const $fctype *) cvt->buf);
+        src = ((const $srctype *) (cvt->buf + cvt->len_cvt)) - $fchans;
+        dst = (($tctype *) (cvt->buf + (frames * $tchans * sizeof ($tctype)))) - $tchans;
+        for (i = frames; i; --i, src -= $fchans, dst -= $tchans) {
 EOF
     } else {
-        $endcomparison = '<';  # dst < target
-        print <<EOF;
-    $fctype *dst = ($fctype *) cvt->buf;
-    const $fctype *src = ($fctype *) cvt->buf;
-    const $fctype *target = (const $fctype *) (cvt->buf + dstsize);
-EOF
-    }
-
-    for (my $i = 0; $i < $channels; $i++) {
-        my $idx = ($upsample) ? (($channels - $i) - 1) : $i;
-        my $val = getSwapFunc($fsize, $fsigned, $ffloat, $fendian, "src[$idx]");
         print <<EOF;
-    $bigger last_sample${idx} = ($bigger) $val;
+        src = (const $srctype *) cvt->buf;
+        dst = ($tctype *) cvt->buf;
+        for (i = frames; i; --i, src += $fchans, dst += $tchans) {
 EOF
     }
 
-    print <<EOF;
-    while (dst $endcomparison target) {
-EOF
-
-    for (my $i = 0; $i < $channels; $i++) {
-        my $idx = ($upsample) ? (($channels - $i) - 1) : $i;
-        my $val = getSwapFunc($fsize, $fsigned, $ffloat, $fendian, "src[$idx]");
-        print <<EOF;
-        const $bigger sample${idx} = ($bigger) $val;
-EOF
+    for ($i = 0; $i < $fchans; $i++) {
+        my $code = getToFloatCode($from, "src[$i]");
+        print("            const float in$i = SDL_RoundFloat($code);\n");
     }
-
-    my $incr = '';
-    if ($upsample) {
-        $incr = ($channels == 1) ? 'src--' : "src -= $channels";
-    } else {
-        my $amount = $channels * $multiple;
-        $incr = "src += $amount";  # can't ever be 1, so no "++" version.
+    for ($j = 0; $j < $tchans; $j++) {
+        print("            float out$j = 0.0f;\n");
     }
-
-
-    print <<EOF;
-        $incr;
-EOF
-
-    # !!! FIXME: This really begs for some Altivec or SSE, etc.
-    if ($upsample) {
-        if ($multiple == 2) {
-            for (my $i = $channels-1; $i >= 0; $i--) {
-                my $dsti = $i + $channels;
-                print <<EOF;
-        dst[$dsti] = ($fctype) ((sample${i} + last_sample${i}) $interp);
-EOF
-            }
-            for (my $i = $channels-1; $i >= 0; $i--) {
-                my $dsti = $i;
-                print <<EOF;
-        dst[$dsti] = ($fctype) sample${i};
-EOF
-            }
-        } elsif ($multiple == 4) {
-            for (my $i = $channels-1; $i >= 0; $i--) {
-                my $dsti = $i + ($channels * 3);
-                print <<EOF;
-        dst[$dsti] = ($fctype) ((sample${i} + ($mult3 * last_sample${i})) $interp2);
-EOF
-            }
-
-            for (my $i = $channels-1; $i >= 0; $i--) {
-                my $dsti = $i + ($channels * 2);
-                print <<EOF;
-        dst[$dsti] = ($fctype) ((sample${i} + last_sample${i}) $interp);
-EOF
-            }
-
-            for (my $i = $channels-1; $i >= 0; $i--) {
-                my $dsti = $i + ($channels * 1);
-                print <<EOF;
-        dst[$dsti] = ($fctype) ((($mult3 * sample${i}) + last_sample${i}) $interp2);
-EOF
-            }
-
-            for (my $i = $channels-1; $i >= 0; $i--) {
-                my $dsti = $i + ($channels * 0);
-                print <<EOF;
-        dst[$dsti] = ($fctype) sample${i};
-EOF
-            }
-        } else {
-            die('bug in program.');  # we only handle x2 and x4.
+    # summed in the same order as SDL_RemixChannels.
+    for ($j = 0; $j < $tchans; $j++) {
+        for ($i = 0; $i < $fchans; $i++) {
+            print("            out$j = SDL_RoundFloat(out$j + SDL_RoundFloat(in$i * c${j}_${i}));\n");
         }
-    } else {  # downsample.
-        if ($multiple == 2) {
-            for (my $i = 0; $i < $channels; $i++) {
-                print <<EOF;
-        dst[$i] = ($fctype) ((sample${i} + last_sample${i}) $interp);
-EOF
-            }
-        } elsif ($multiple == 4) {
-            # !!! FIXME: interpolate all 4 samples?
-            for (my $i = 0; $i < $channels; $i++) {
-                print <<EOF;
-        dst[$i] = ($fctype) ((sample${i} + last_sample${i}) $interp);
-EOF
-            }
-        } else {
-            die('bug in program.');  # we only handle x2 and x4.
-        }
-    }
-
-    for (my $i = 0; $i < $channels; $i++) {
-        my $idx = ($upsample) ? (($channels - $i) - 1) : $i;
-        print <<EOF;
-        last_sample${idx} = sample${idx};
-EOF
     }
-
-    if ($upsample) {
-        my $amount = $channels * $multiple;
-        $incr = "dst -= $amount";  # can't ever be 1, so no "--" version.
-    } else {
-        $incr = ($channels == 1) ? 'dst++' : "dst += $channels";
+    for ($j = 0; $j < $tchans; $j++) {
+        my $code = getFromFloatCode($to, "out$j");
+        my $swap = getSwapFunc($tsize, $tsigned, $tfloat, $tendian, $code);
+        print("            dst[$j] = $swap;\n");
     }
 
     print <<EOF;
-        $incr;
+        }
+        cvt->len_cvt = frames * $tchans * sizeof ($tctype);
     }
 
-    cvt->len_cvt = dstsize;
     if (cvt->filters[++cvt->filter_index]) {
-        cvt->filters[cvt->filter_index] (cvt, format);
+        cvt->filters[cvt->filter_index] (cvt, AUDIO_$to);
     }
 }
 
 EOF
-
 }
 
-sub buildResamplers {
-    print "#if !NO_RESAMPLERS\n\n";
-    foreach (@audiotypes) {
-        my $from = $_;
-        foreach (@channels) {
-            my $channel = $_;
-            buildArbitraryResampleFunc($from, $channel, 1);
-            buildArbitraryResampleFunc($from, $channel, 0);
-        }
-    }
-
-    print "\n#if !LESS_RESAMPLERS\n\n";
-    foreach (@audiotypes) {
-        my $from = $_;
-        foreach (@channels) {
-            my $channel = $_;
-            for (my $multiple = 2; $multiple <= 4; $multiple += 2) {
-                buildMultipleResampleFunc($from, $channel, 1, $multiple);
-                buildMultipleResampleFunc($from, $channel, 0, $multiple);
-            }
-        }
-    }
-
-    print "#endif  /* !LESS_RESAMPLERS */\n";
-    print "#endif  /* !NO_RESAMPLERS */\n\n\n";
-
-    print "const SDL_AudioRateFilters sdl_audio_rate_filters[] =\n{\n";
-    print "#if !NO_RESAMPLERS\n";
-    foreach (@audiotypes) {
-        my $from = $_;
-        foreach (@channels) {
-            my $channel = $_;
-            for (my $upsample = 0; $upsample <= 1; $upsample++) {
-                my $hashid = getResamplerHashId($from, $channel, $upsample, 0);
-                my $sym = $funcs{$hashid};
-                print("    { AUDIO_$from, $channel, $upsample, 0, $sym },\n");
-            }
-        }
+sub buildFusedConverters {
+    print "#if !NO_CONVERTERS\n\n";
+    foreach (@fusedconverters) {
+        buildFusedCvtFunc(@$_);
     }
+    print "#endif  /* !NO_CONVERTERS */\n\n\n";
 
-    print "#if !LESS_RESAMPLERS\n";
-    foreach (@audiotypes) {
-        my $from = $_;
-        foreach (@channels) {
-            my $channel = $_;
-            for (my $multiple = 2; $multiple <= 4; $multiple += 2) {
-                for (my $upsample = 0; $upsample <= 1; $upsample++) {
-                    my $hashid = getResamplerHashId($from, $channel, $upsample, $multiple);
-                    my $sym = $funcs{$hashid};
-                    print("    { AUDIO_$from, $channel, $upsample, $multiple, $sym },\n");
-                }
-            }
-        }
+    print "const SDL_AudioFusedFilters sdl_audio_fused_filters[] =\n{\n";
+    print "#if !NO_CONVERTERS\n";
+    foreach (@fusedconverters) {
+        my ($from, $fchans, $to, $tchans) = @$_;
+        my $sym = $funcs{"FUSED $from/$fchans/$to/$tchans"};
+        print("    { AUDIO_$from, $fchans, AUDIO_$to, $tchans, $sym },\n");
     }
+    print "#endif  /* !NO_CONVERTERS */\n";
 
-    print "#endif  /* !LESS_RESAMPLERS */\n";
-    print "#endif  /* !NO_RESAMPLERS */\n";
     print("    { 0, 0, 0, 0, NULL }\n");
-    print "};\n\n";
+    print "};\n\n\n";
 }
 
-
 # mainline ...
 
 outputHeader();
 buildTypeConverters();
-buildResamplers();
+buildFusedConverters();
 outputFooter();
 
 exit 0;
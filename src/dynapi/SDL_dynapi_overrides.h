@@ -605,3 +605,35 @@
 #define SDL_SetWindowModalFor SDL_SetWindowModalFor_REAL
 #define SDL_RenderSetIntegerScale SDL_RenderSetIntegerScale_REAL
 #define SDL_RenderGetIntegerScale SDL_RenderGetIntegerScale_REAL
+#define SDL_NewAudioStream SDL_NewAudioStream_REAL
+#define SDL_AudioStreamPut SDL_AudioStreamPut_REAL
+#define SDL_AudioStreamGet SDL_AudioStreamGet_REAL
+#define SDL_AudioStreamAvailable SDL_AudioStreamAvailable_REAL
+#define SDL_AudioStreamFlush SDL_AudioStreamFlush_REAL
+#define SDL_AudioStreamClear SDL_AudioStreamClear_REAL
+#define SDL_FreeAudioStream SDL_FreeAudioStream_REAL
+#define SDL_DequeueAudio SDL_DequeueAudio_REAL
+#define SDL_QueueAudioFormat SDL_QueueAudioFormat_REAL
+#define SDL_CreateAudioVoice SDL_CreateAudioVoice_REAL
+#define SDL_PlayAudioVoice SDL_PlayAudioVoice_REAL
+#define SDL_StopAudioVoice SDL_StopAudioVoice_REAL
+#define SDL_SetAudioVoiceParams SDL_SetAudioVoiceParams_REAL
+#define SDL_IsAudioVoicePlaying SDL_IsAudioVoicePlaying_REAL
+#define SDL_DestroyAudioVoice SDL_DestroyAudioVoice_REAL
+#define SDL_GetAudioDeviceStats SDL_GetAudioDeviceStats_REAL
+#define SDL_ResetAudioDeviceStats SDL_ResetAudioDeviceStats_REAL
+#define SDL_OpenWAVStream_RW SDL_OpenWAVStream_RW_REAL
+#define SDL_WAVStreamLength SDL_WAVStreamLength_REAL
+#define SDL_WAVStreamTell SDL_WAVStreamTell_REAL
+#define SDL_WAVStreamSeek SDL_WAVStreamSeek_REAL
+#define SDL_WAVStreamRead SDL_WAVStreamRead_REAL
+#define SDL_CloseWAVStream SDL_CloseWAVStream_REAL
+#define SDL_AudioStreamSetChannelMatrix SDL_AudioStreamSetChannelMatrix_REAL
+#define SDL_GetAudioDeviceLatency SDL_GetAudioDeviceLatency_REAL
+#define SDL_GetAudioDevicePosition SDL_GetAudioDevicePosition_REAL
+#define SDL_PlayAudioVoiceAt SDL_PlayAudioVoiceAt_REAL
+#define SDL_AddAudioEffect SDL_AddAudioEffect_REAL
+#define SDL_SetAudioEffectParams SDL_SetAudioEffectParams_REAL
+#define SDL_RemoveAudioEffect SDL_RemoveAudioEffect_REAL
+#define SDL_SetAudioDeviceMetering SDL_SetAudioDeviceMetering_REAL
+#define SDL_GetAudioDeviceMeter SDL_GetAudioDeviceMeter_REAL
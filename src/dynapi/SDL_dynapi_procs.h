@@ -639,3 +639,35 @@ SDL_DYNAPI_PROC(int,SDL_SetWindowInputFocus,(SDL_Window *a),(a),return)
 SDL_DYNAPI_PROC(int,SDL_SetWindowModalFor,(SDL_Window *a, SDL_Window *b),(a,b),return)
 SDL_DYNAPI_PROC(int,SDL_RenderSetIntegerScale,(SDL_Renderer *a, SDL_bool b),(a,b),return)
 SDL_DYNAPI_PROC(SDL_bool,SDL_RenderGetIntegerScale,(SDL_Renderer *a),(a),return)
+SDL_DYNAPI_PROC(SDL_AudioStream*,SDL_NewAudioStream,(const SDL_AudioFormat a, const Uint8 b, const int c, const SDL_AudioFormat d, const Uint8 e, const int f),(a,b,c,d,e,f),return)
+SDL_DYNAPI_PROC(int,SDL_AudioStreamPut,(SDL_AudioStream *a, const void *b, int c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_AudioStreamGet,(SDL_AudioStream *a, void *b, int c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_AudioStreamAvailable,(SDL_AudioStream *a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_AudioStreamFlush,(SDL_AudioStream *a),(a),return)
+SDL_DYNAPI_PROC(void,SDL_AudioStreamClear,(SDL_AudioStream *a),(a),)
+SDL_DYNAPI_PROC(void,SDL_FreeAudioStream,(SDL_AudioStream *a),(a),)
+SDL_DYNAPI_PROC(Uint32,SDL_DequeueAudio,(SDL_AudioDeviceID a, void *b, Uint32 c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_QueueAudioFormat,(SDL_AudioDeviceID a, const void *b, Uint32 c, SDL_AudioFormat d, Uint8 e, int f),(a,b,c,d,e,f),return)
+SDL_DYNAPI_PROC(SDL_AudioVoiceID,SDL_CreateAudioVoice,(SDL_AudioDeviceID a, const void *b, Uint32 c, SDL_AudioFormat d, Uint8 e, int f),(a,b,c,d,e,f),return)
+SDL_DYNAPI_PROC(int,SDL_PlayAudioVoice,(SDL_AudioDeviceID a, SDL_AudioVoiceID b, SDL_bool c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_StopAudioVoice,(SDL_AudioDeviceID a, SDL_AudioVoiceID b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_SetAudioVoiceParams,(SDL_AudioDeviceID a, SDL_AudioVoiceID b, float c, float d, float e),(a,b,c,d,e),return)
+SDL_DYNAPI_PROC(SDL_bool,SDL_IsAudioVoicePlaying,(SDL_AudioDeviceID a, SDL_AudioVoiceID b),(a,b),return)
+SDL_DYNAPI_PROC(void,SDL_DestroyAudioVoice,(SDL_AudioDeviceID a, SDL_AudioVoiceID b),(a,b),)
+SDL_DYNAPI_PROC(int,SDL_GetAudioDeviceStats,(SDL_AudioDeviceID a, SDL_AudioDeviceStats *b),(a,b),return)
+SDL_DYNAPI_PROC(void,SDL_ResetAudioDeviceStats,(SDL_AudioDeviceID a),(a),)
+SDL_DYNAPI_PROC(SDL_WAVStream*,SDL_OpenWAVStream_RW,(SDL_RWops *a, int b, SDL_AudioSpec *c),(a,b,c),return)
+SDL_DYNAPI_PROC(Sint64,SDL_WAVStreamLength,(SDL_WAVStream *a),(a),return)
+SDL_DYNAPI_PROC(Sint64,SDL_WAVStreamTell,(SDL_WAVStream *a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_WAVStreamSeek,(SDL_WAVStream *a, Sint64 b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_WAVStreamRead,(SDL_WAVStream *a, void *b, int c),(a,b,c),return)
+SDL_DYNAPI_PROC(void,SDL_CloseWAVStream,(SDL_WAVStream *a),(a),)
+SDL_DYNAPI_PROC(int,SDL_AudioStreamSetChannelMatrix,(SDL_AudioStream *a, const float *b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_GetAudioDeviceLatency,(SDL_AudioDeviceID a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_GetAudioDevicePosition,(SDL_AudioDeviceID a, Uint64 *b, Uint64 *c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_PlayAudioVoiceAt,(SDL_AudioDeviceID a, SDL_AudioVoiceID b, Uint64 c, SDL_bool d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(SDL_AudioEffectID,SDL_AddAudioEffect,(SDL_AudioDeviceID a, SDL_AudioEffectType b, SDL_bool c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_SetAudioEffectParams,(SDL_AudioDeviceID a, SDL_AudioEffectID b, const float *c, int d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(void,SDL_RemoveAudioEffect,(SDL_AudioDeviceID a, SDL_AudioEffectID b),(a,b),)
+SDL_DYNAPI_PROC(int,SDL_SetAudioDeviceMetering,(SDL_AudioDeviceID a, SDL_bool b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_GetAudioDeviceMeter,(SDL_AudioDeviceID a, SDL_AudioMeter *b, SDL_bool c),(a,b,c),return)
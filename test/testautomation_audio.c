@@ -968,6 +968,2569 @@ int audio_openCloseAudioDeviceConnected()
 }
 
 
+/**
+ * \brief Converts a buffer through an audio stream in one piece and in
+ *        random chunks, and checks both give identical results.
+ *
+ * \sa https://wiki.libsdl.org/SDL_NewAudioStream
+ * \sa https://wiki.libsdl.org/SDL_AudioStreamPut
+ * \sa https://wiki.libsdl.org/SDL_AudioStreamGet
+ */
+int audio_convertAudioStream()
+{
+   const int src_rate = 44100;
+   const int dst_rate = 48000;
+   const int frames = src_rate;
+   const int src_len = frames * 2 * sizeof (Sint16);
+   const int dst_len = (dst_rate + 16) * 2 * sizeof (float);
+   SDL_AudioStream *stream;
+   Sint16 *src;
+   Uint8 *whole, *chunked;
+   int whole_len, chunked_len;
+   int i, pos, result;
+
+   src = (Sint16 *)SDL_malloc(src_len);
+   whole = (Uint8 *)SDL_malloc(dst_len);
+   chunked = (Uint8 *)SDL_malloc(dst_len);
+   SDLTest_AssertCheck(src && whole && chunked, "Check buffers are not NULL");
+   if (!src || !whole || !chunked) {
+     SDL_free(src);
+     SDL_free(whole);
+     SDL_free(chunked);
+     return TEST_ABORTED;
+   }
+
+   for (i = 0; i < frames; i++) {
+     src[i * 2] = src[i * 2 + 1] = (Sint16) (SDL_sin(i * 440.0 * 2.0 * M_PI / src_rate) * 16000.0);
+   }
+
+   stream = SDL_NewAudioStream(AUDIO_S16SYS, 2, src_rate, AUDIO_F32SYS, 2, dst_rate);
+   SDLTest_AssertPass("Call to SDL_NewAudioStream()");
+   SDLTest_AssertCheck(stream != NULL, "Verify stream is not NULL");
+   if (stream == NULL) {
+     SDL_free(src);
+     SDL_free(whole);
+     SDL_free(chunked);
+     return TEST_ABORTED;
+   }
+
+   /* Partial sample frames are rejected */
+   result = SDL_AudioStreamPut(stream, src, 3);
+   SDLTest_AssertCheck(result == -1, "Verify partial frame is rejected; expected: -1, got: %i", result);
+
+   /* Whole buffer at once */
+   result = SDL_AudioStreamPut(stream, src, src_len);
+   SDLTest_AssertPass("Call to SDL_AudioStreamPut()");
+   SDLTest_AssertCheck(result == 0, "Verify result value; expected: 0, got: %i", result);
+   result = SDL_AudioStreamFlush(stream);
+   SDLTest_AssertCheck(result == 0, "Verify result value; expected: 0, got: %i", result);
+   whole_len = SDL_AudioStreamGet(stream, whole, dst_len);
+   SDLTest_AssertPass("Call to SDL_AudioStreamGet()");
+   SDLTest_AssertCheck(whole_len == dst_rate * 2 * sizeof (float), "Verify converted length; expected: %i, got: %i", (int) (dst_rate * 2 * sizeof (float)), whole_len);
+   result = SDL_AudioStreamAvailable(stream);
+   SDLTest_AssertCheck(result == 0, "Verify stream is drained; expected: 0, got: %i", result);
+
+   /* Same data in random sized chunks, reading as we go */
+   chunked_len = 0;
+   for (pos = 0; pos < frames; ) {
+     int chunk = SDLTest_RandomIntegerInRange(1, 2000);
+     if (chunk > frames - pos) {
+       chunk = frames - pos;
+     }
+     result = SDL_AudioStreamPut(stream, src + pos * 2, chunk * 2 * sizeof (Sint16));
+     SDLTest_AssertCheck(result == 0, "Verify chunk of %i frames was accepted", chunk);
+     if (result != 0) {
+       break;
+     }
+     pos += chunk;
+     chunked_len += SDL_AudioStreamGet(stream, chunked + chunked_len, SDLTest_RandomIntegerInRange(0, dst_len - chunked_len));
+   }
+   SDL_AudioStreamFlush(stream);
+   chunked_len += SDL_AudioStreamGet(stream, chunked + chunked_len, dst_len - chunked_len);
+   SDLTest_AssertCheck(chunked_len == whole_len, "Verify chunked length; expected: %i, got: %i", whole_len, chunked_len);
+   SDLTest_AssertCheck(SDL_memcmp(whole, chunked, whole_len) == 0, "Verify chunked conversion matches whole conversion");
+
+   /* Clearing drops everything */
+   SDL_AudioStreamPut(stream, src, src_len);
+   SDL_AudioStreamClear(stream);
+   SDLTest_AssertPass("Call to SDL_AudioStreamClear()");
+   result = SDL_AudioStreamAvailable(stream);
+   SDLTest_AssertCheck(result == 0, "Verify stream is empty; expected: 0, got: %i", result);
+
+   SDL_FreeAudioStream(stream);
+   SDLTest_AssertPass("Call to SDL_FreeAudioStream()");
+
+   SDL_free(src);
+   SDL_free(whole);
+   SDL_free(chunked);
+
+   return TEST_COMPLETED;
+}
+
+
+/**
+ * \brief Checks the common integer/float conversions give exactly the same
+ *        bits as the reference scalar arithmetic, whichever version is used.
+ *
+ * \sa http://wiki.libsdl.org/moin.cgi/SDL_ConvertAudio
+ */
+int audio_convertAudioTypesExact()
+{
+   const int samples = 65536 + 7;  /* every Sint16, plus an odd tail */
+   SDL_AudioCVT cvt;
+   Sint16 *s16;
+   Sint32 *s32;
+   float *f32;
+   Uint8 *buf;
+   int i, result, mismatches;
+
+   s16 = (Sint16 *)SDL_malloc(samples * sizeof (Sint16));
+   s32 = (Sint32 *)SDL_malloc(samples * sizeof (Sint32));
+   f32 = (float *)SDL_malloc(samples * sizeof (float));
+   buf = (Uint8 *)SDL_malloc(samples * sizeof (Sint32) * 2);
+   SDLTest_AssertCheck(s16 && s32 && f32 && buf, "Check buffers are not NULL");
+   if (!s16 || !s32 || !f32 || !buf) {
+     SDL_free(s16);
+     SDL_free(s32);
+     SDL_free(f32);
+     SDL_free(buf);
+     return TEST_ABORTED;
+   }
+
+   for (i = 0; i < samples; i++) {
+     s16[i] = (Sint16) (i - 32768);
+     s32[i] = (i < 2) ? ((i == 0) ? (-2147483647 - 1) : 2147483647) : SDLTest_RandomSint32();
+     f32[i] = (float) SDLTest_RandomIntegerInRange(-1000000, 1000000) / 1000000.0f;
+   }
+
+   /* S16 -> F32 */
+   result = SDL_BuildAudioCVT(&cvt, AUDIO_S16SYS, 1, 48000, AUDIO_F32SYS, 1, 48000);
+   SDLTest_AssertCheck(result == 1, "Verify result value; expected: 1, got: %i", result);
+   cvt.buf = buf;
+   cvt.len = samples * sizeof (Sint16);
+   SDL_memcpy(cvt.buf, s16, cvt.len);
+   result = SDL_ConvertAudio(&cvt);
+   SDLTest_AssertCheck(result == 0, "Verify result value; expected: 0, got: %i", result);
+   mismatches = 0;
+   for (i = 0; i < samples; i++) {
+     const float expected = ((float) s16[i]) * 3.05185094759972e-05f;
+     if (SDL_memcmp(&expected, ((float *) buf) + i, sizeof (float)) != 0) {
+       mismatches++;
+     }
+   }
+   SDLTest_AssertCheck(mismatches == 0, "Verify S16 to F32 is bit exact; mismatches: %i", mismatches);
+
+   /* F32 -> S16 */
+   result = SDL_BuildAudioCVT(&cvt, AUDIO_F32SYS, 1, 48000, AUDIO_S16SYS, 1, 48000);
+   SDLTest_AssertCheck(result == 1, "Verify result value; expected: 1, got: %i", result);
+   cvt.buf = buf;
+   cvt.len = samples * sizeof (float);
+   SDL_memcpy(cvt.buf, f32, cvt.len);
+   result = SDL_ConvertAudio(&cvt);
+   SDLTest_AssertCheck(result == 0, "Verify result value; expected: 0, got: %i", result);
+   mismatches = 0;
+   for (i = 0; i < samples; i++) {
+     if (((Sint16 *) buf)[i] != (Sint16) (f32[i] * 32767.0f)) {
+       mismatches++;
+     }
+   }
+   SDLTest_AssertCheck(mismatches == 0, "Verify F32 to S16 is bit exact; mismatches: %i", mismatches);
+
+   /* S32 -> F32 */
+   result = SDL_BuildAudioCVT(&cvt, AUDIO_S32SYS, 1, 48000, AUDIO_F32SYS, 1, 48000);
+   SDLTest_AssertCheck(result == 1, "Verify result value; expected: 1, got: %i", result);
+   cvt.buf = buf;
+   cvt.len = samples * sizeof (Sint32);
+   SDL_memcpy(cvt.buf, s32, cvt.len);
+   result = SDL_ConvertAudio(&cvt);
+   SDLTest_AssertCheck(result == 0, "Verify result value; expected: 0, got: %i", result);
+   mismatches = 0;
+   for (i = 0; i < samples; i++) {
+     const float expected = ((float) s32[i]) * 4.6566128752458e-10f;
+     if (SDL_memcmp(&expected, ((float *) buf) + i, sizeof (float)) != 0) {
+       mismatches++;
+     }
+   }
+   SDLTest_AssertCheck(mismatches == 0, "Verify S32 to F32 is bit exact; mismatches: %i", mismatches);
+
+   /* F32 -> S32 */
+   result = SDL_BuildAudioCVT(&cvt, AUDIO_F32SYS, 1, 48000, AUDIO_S32SYS, 1, 48000);
+   SDLTest_AssertCheck(result == 1, "Verify result value; expected: 1, got: %i", result);
+   cvt.buf = buf;
+   cvt.len = samples * sizeof (float);
+   SDL_memcpy(cvt.buf, f32, cvt.len);
+   result = SDL_ConvertAudio(&cvt);
+   SDLTest_AssertCheck(result == 0, "Verify result value; expected: 0, got: %i", result);
+   mismatches = 0;
+   for (i = 0; i < samples; i++) {
+     if (((Sint32 *) buf)[i] != (Sint32) (f32[i] * 2147483647.0)) {
+       mismatches++;
+     }
+   }
+   SDLTest_AssertCheck(mismatches == 0, "Verify F32 to S32 is bit exact; mismatches: %i", mismatches);
+
+   SDL_free(s16);
+   SDL_free(s32);
+   SDL_free(f32);
+   SDL_free(buf);
+
+   return TEST_COMPLETED;
+}
+
+
+/**
+ * \brief Capture a known file through the disk driver and dequeue it.
+ *
+ * \sa https://wiki.libsdl.org/SDL_DequeueAudio
+ */
+int audio_diskCaptureDequeue()
+{
+    const char *filename = "sdlaudio-capture-test.raw";
+    const int frames = 22050;  /* half a second at 44.1kHz */
+    const Uint32 len = frames * 2 * sizeof (Sint16);
+    SDL_AudioSpec desired;
+    SDL_AudioSpec obtained;
+    SDL_AudioDeviceID id;
+    SDL_RWops *rw;
+    Sint16 *written;
+    Uint8 *captured;
+    Uint32 total = 0;
+    Uint32 startticks;
+    int result;
+    int i;
+
+    /* Make up a file with a pattern that doesn't repeat */
+    written = (Sint16 *) SDL_malloc(len);
+    captured = (Uint8 *) SDL_malloc(len);
+    SDLTest_AssertCheck(written != NULL && captured != NULL, "Validate buffers were allocated");
+    if (written == NULL || captured == NULL) {
+        SDL_free(written);
+        SDL_free(captured);
+        return TEST_ABORTED;
+    }
+    for (i = 0; i < frames * 2; i++) {
+        written[i] = (Sint16) ((i * 7919) & 0x7FFF);
+    }
+    rw = SDL_RWFromFile(filename, "wb");
+    SDLTest_AssertPass("Call to SDL_RWFromFile('%s', \"wb\")", filename);
+    SDLTest_AssertCheck(rw != NULL, "Verify creation of capture file");
+    if (rw == NULL) {
+        SDL_free(written);
+        SDL_free(captured);
+        return TEST_ABORTED;
+    }
+    SDL_RWwrite(rw, written, 1, len);
+    SDL_RWclose(rw);
+
+    /* Switch to the disk driver, reading as fast as possible */
+    SDL_setenv("SDL_DISKAUDIODELAY", "0", 1);
+    SDL_AudioQuit();
+    result = SDL_AudioInit("disk");
+    SDLTest_AssertPass("Call to SDL_AudioInit('disk')");
+    if (result != 0) {
+        SDLTest_Log("Disk audio driver not available, skipping.");
+        remove(filename);
+        SDL_free(written);
+        SDL_free(captured);
+        _audioSetUp(NULL);
+        return TEST_SKIPPED;
+    }
+
+    SDL_zero(desired);
+    desired.freq = 44100;
+    desired.format = AUDIO_S16SYS;
+    desired.channels = 2;
+    desired.samples = 1024;
+    desired.callback = NULL;  /* use SDL_DequeueAudio() */
+    id = SDL_OpenAudioDevice(filename, 1, &desired, &obtained, 0);
+    SDLTest_AssertPass("Call to SDL_OpenAudioDevice('%s', 1, ...)", filename);
+    SDLTest_AssertCheck(id > 1, "Validate device ID; expected: >1 got: %d", (int) id);
+    if (id > 1) {
+        result = SDL_QueueAudio(id, written, len);
+        SDLTest_AssertCheck(result == -1, "Validate SDL_QueueAudio fails on a capture device; got: %d", result);
+
+        SDL_PauseAudioDevice(id, 0);
+        startticks = SDL_GetTicks();
+        while ((total < len) && !SDL_TICKS_PASSED(SDL_GetTicks(), startticks + 5000)) {
+            const Uint32 got = SDL_DequeueAudio(id, captured + total, len - total);
+            total += got;
+            if (got == 0) {
+                SDL_Delay(1);
+            }
+        }
+        SDLTest_AssertPass("Call to SDL_DequeueAudio until %u bytes", (unsigned int) len);
+        SDLTest_AssertCheck(total == len, "Validate dequeued size; expected: %u got: %u", (unsigned int) len, (unsigned int) total);
+        SDLTest_AssertCheck(SDL_memcmp(written, captured, total) == 0, "Validate dequeued data matches the file");
+
+        SDL_ClearQueuedAudio(id);
+        SDL_PauseAudioDevice(id, 1);
+        SDL_ClearQueuedAudio(id);
+        SDLTest_AssertCheck(SDL_GetQueuedAudioSize(id) == 0, "Validate queue is empty after SDL_ClearQueuedAudio");
+
+        SDL_CloseAudioDevice(id);
+        SDLTest_AssertPass("Call to SDL_CloseAudioDevice()");
+    }
+
+    SDL_AudioQuit();
+    remove(filename);
+    SDL_free(written);
+    SDL_free(captured);
+
+    /* Restart audio again */
+    _audioSetUp(NULL);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * \brief Queue audio on a paused device, with and without queue growth.
+ *
+ * \sa https://wiki.libsdl.org/SDL_QueueAudio
+ * \sa https://wiki.libsdl.org/SDL_GetQueuedAudioSize
+ * \sa https://wiki.libsdl.org/SDL_ClearQueuedAudio
+ */
+int audio_queueAudioCapacity()
+{
+    const char *filename = "sdlaudio-queue-test.raw";
+    const Uint32 len = 256 * 1024;
+    SDL_AudioSpec desired;
+    SDL_AudioDeviceID id;
+    Uint8 *data;
+    Uint32 queued;
+    int result;
+    int growth;
+
+    data = (Uint8 *) SDL_calloc(1, len);
+    SDLTest_AssertCheck(data != NULL, "Validate buffer was allocated");
+    if (data == NULL) {
+        return TEST_ABORTED;
+    }
+
+    SDL_AudioQuit();
+    result = SDL_AudioInit("disk");
+    SDLTest_AssertPass("Call to SDL_AudioInit('disk')");
+    if (result != 0) {
+        SDLTest_Log("Disk audio driver not available, skipping.");
+        SDL_free(data);
+        _audioSetUp(NULL);
+        return TEST_SKIPPED;
+    }
+
+    SDL_zero(desired);
+    desired.freq = 44100;
+    desired.format = AUDIO_S16SYS;
+    desired.channels = 2;
+    desired.samples = 1024;
+    desired.callback = NULL;  /* use SDL_QueueAudio() */
+
+    SDL_SetHint(SDL_HINT_AUDIO_QUEUE_CAPACITY, "65536");
+    for (growth = 0; growth <= 1; growth++) {
+        SDL_SetHint(SDL_HINT_AUDIO_QUEUE_GROWTH, growth ? "1" : "0");
+
+        /* the device stays paused, so nothing drains while we look. */
+        id = SDL_OpenAudioDevice(filename, 0, &desired, NULL, 0);
+        SDLTest_AssertPass("Call to SDL_OpenAudioDevice('%s', 0, ...) with growth %d", filename, growth);
+        SDLTest_AssertCheck(id > 1, "Validate device ID; expected: >1 got: %d", (int) id);
+        if (id <= 1) {
+            continue;
+        }
+
+        result = SDL_QueueAudio(id, data, 4096);
+        SDLTest_AssertCheck(result == 0, "Validate small SDL_QueueAudio result; expected: 0 got: %d", result);
+        result = SDL_QueueAudio(id, data, len);
+        if (growth) {
+            SDLTest_AssertCheck(result == 0, "Validate large SDL_QueueAudio grows the queue; got: %d", result);
+        } else {
+            SDLTest_AssertCheck(result == -1, "Validate large SDL_QueueAudio fails on a full queue; got: %d", result);
+        }
+        queued = SDL_GetQueuedAudioSize(id);
+        SDLTest_AssertCheck(queued == (growth ? len + 4096 : 4096), "Validate SDL_GetQueuedAudioSize; got: %u", (unsigned int) queued);
+
+        SDL_ClearQueuedAudio(id);
+        queued = SDL_GetQueuedAudioSize(id);
+        SDLTest_AssertCheck(queued == 0, "Validate SDL_GetQueuedAudioSize after clearing; expected: 0 got: %u", (unsigned int) queued);
+
+        /* the queue still works after being cleared. */
+        result = SDL_QueueAudio(id, data, 4096);
+        queued = SDL_GetQueuedAudioSize(id);
+        SDLTest_AssertCheck((result == 0) && (queued == 4096), "Validate queueing after clearing; got: %d, %u", result, (unsigned int) queued);
+
+        SDL_CloseAudioDevice(id);
+        SDLTest_AssertPass("Call to SDL_CloseAudioDevice()");
+    }
+    SDL_SetHint(SDL_HINT_AUDIO_QUEUE_CAPACITY, NULL);
+    SDL_SetHint(SDL_HINT_AUDIO_QUEUE_GROWTH, NULL);
+
+    SDL_AudioQuit();
+    remove(filename);
+    SDL_free(data);
+
+    /* Restart audio again */
+    _audioSetUp(NULL);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * \brief Queue audio in several formats and check what the device plays.
+ *
+ * \sa https://wiki.libsdl.org/SDL_QueueAudioFormat
+ */
+int audio_queueAudioFormat()
+{
+    const char *filename = "sdlaudio-queueformat-test.raw";
+    const int frames = 11025;
+    const Uint32 nativelen = frames * 2 * sizeof (Sint16);
+    SDL_AudioSpec desired;
+    SDL_AudioDeviceID id;
+    SDL_AudioStream *stream;
+    SDL_RWops *rw;
+    Sint16 *native = NULL;
+    Sint8 *mono = NULL;
+    Uint8 *expected = NULL;
+    Uint8 *played = NULL;
+    Uint32 expectedlen;
+    Uint32 queued;
+    Uint32 startticks;
+    Sint64 playedlen = 0;
+    Sint64 offset;
+    int result;
+    int i;
+
+    /* the device's own format, then mono 8-bit at half the rate, which
+       plays twice as long. */
+    native = (Sint16 *) SDL_malloc(nativelen);
+    mono = (Sint8 *) SDL_malloc(frames);
+    expected = (Uint8 *) SDL_malloc(nativelen * 4);
+    SDLTest_AssertCheck(native != NULL && mono != NULL && expected != NULL, "Validate buffers were allocated");
+    if (native == NULL || mono == NULL || expected == NULL) {
+        SDL_free(native);
+        SDL_free(mono);
+        SDL_free(expected);
+        return TEST_ABORTED;
+    }
+    for (i = 0; i < frames * 2; i++) {
+        native[i] = (Sint16) (((i * 7919) & 0x3FFF) + 1);
+    }
+    for (i = 0; i < frames; i++) {
+        mono[i] = (Sint8) ((i * 31) & 0x3F);
+    }
+
+    /* what should come out: the first as is, the second converted. */
+    SDL_memcpy(expected, native, nativelen);
+    expectedlen = nativelen;
+    stream = SDL_NewAudioStream(AUDIO_S8, 1, 22050, AUDIO_S16SYS, 2, 44100);
+    SDLTest_AssertCheck(stream != NULL, "Validate SDL_NewAudioStream result");
+    if (stream != NULL) {
+        SDL_AudioStreamPut(stream, mono, frames);
+        SDL_AudioStreamFlush(stream);
+        expectedlen += SDL_AudioStreamGet(stream, expected + expectedlen, nativelen * 3);
+        SDL_FreeAudioStream(stream);
+    }
+
+    SDL_setenv("SDL_DISKAUDIODELAY", "0", 1);
+    SDL_AudioQuit();
+    result = SDL_AudioInit("disk");
+    SDLTest_AssertPass("Call to SDL_AudioInit('disk')");
+    if (result != 0) {
+        SDLTest_Log("Disk audio driver not available, skipping.");
+        SDL_free(native);
+        SDL_free(mono);
+        SDL_free(expected);
+        _audioSetUp(NULL);
+        return TEST_SKIPPED;
+    }
+
+    SDL_zero(desired);
+    desired.freq = 44100;
+    desired.format = AUDIO_S16SYS;
+    desired.channels = 2;
+    desired.samples = 1024;
+    desired.callback = NULL;  /* use SDL_QueueAudio() */
+    id = SDL_OpenAudioDevice(filename, 0, &desired, NULL, 0);
+    SDLTest_AssertPass("Call to SDL_OpenAudioDevice('%s', 0, ...)", filename);
+    SDLTest_AssertCheck(id > 1, "Validate device ID; expected: >1 got: %d", (int) id);
+    if (id > 1) {
+        result = SDL_QueueAudioFormat(id, native, 3, AUDIO_S16SYS, 1, 22050);
+        SDLTest_AssertCheck(result == -1, "Validate partial sample frames are rejected; got: %d", result);
+        result = SDL_QueueAudioFormat(id, native, 4, AUDIO_S16SYS, 2, 0);
+        SDLTest_AssertCheck(result == -1, "Validate a zero sample rate is rejected; got: %d", result);
+
+        result = SDL_QueueAudioFormat(id, native, nativelen, AUDIO_S16SYS, 2, 44100);
+        SDLTest_AssertCheck(result == 0, "Validate SDL_QueueAudioFormat in the device's format; got: %d", result);
+        /* in two calls, which share a converter and resample as one. */
+        result = SDL_QueueAudioFormat(id, mono, frames / 2, AUDIO_S8, 1, 22050);
+        SDLTest_AssertCheck(result == 0, "Validate SDL_QueueAudioFormat with conversion; got: %d", result);
+        result = SDL_QueueAudioFormat(id, mono + (frames / 2), frames - (frames / 2), AUDIO_S8, 1, 22050);
+        SDLTest_AssertCheck(result == 0, "Validate SDL_QueueAudioFormat continuing a conversion; got: %d", result);
+        queued = SDL_GetQueuedAudioSize(id);
+        SDLTest_AssertCheck(queued == nativelen * 3, "Validate SDL_GetQueuedAudioSize counts converted bytes; expected: %u got: %u",
+                            (unsigned int) (nativelen * 3), (unsigned int) queued);
+
+        /* play it all, as fast as the disk driver goes. */
+        SDL_PauseAudioDevice(id, 0);
+        startticks = SDL_GetTicks();
+        while ((SDL_GetQueuedAudioSize(id) > 0) && !SDL_TICKS_PASSED(SDL_GetTicks(), startticks + 5000)) {
+            SDL_Delay(10);
+        }
+        SDL_Delay(100);  /* let the resampler's tail out, too. */
+        SDLTest_AssertCheck(SDL_GetQueuedAudioSize(id) == 0, "Validate the queue drained");
+        SDL_CloseAudioDevice(id);
+        SDLTest_AssertPass("Call to SDL_CloseAudioDevice()");
+
+        rw = SDL_RWFromFile(filename, "rb");
+        SDLTest_AssertCheck(rw != NULL, "Verify the device's output file exists");
+        if (rw != NULL) {
+            playedlen = SDL_RWsize(rw);
+            played = (Uint8 *) SDL_malloc((size_t) playedlen);
+            if (played != NULL) {
+                playedlen = (Sint64) SDL_RWread(rw, played, 1, (size_t) playedlen);
+            }
+            SDL_RWclose(rw);
+        }
+
+        /* skip the silence it played before being unpaused. */
+        if (played != NULL) {
+            for (offset = 0; (offset < playedlen) && (played[offset] == 0); offset++) {
+                /* spin */
+            }
+            offset &= ~3;
+            SDLTest_AssertCheck(playedlen - offset >= expectedlen, "Validate played length; expected: >=%u got: %d",
+                                (unsigned int) expectedlen, (int) (playedlen - offset));
+            if (playedlen - offset >= expectedlen) {
+                SDLTest_AssertCheck(SDL_memcmp(played + offset, expected, expectedlen) == 0,
+                                    "Validate played audio matches SDL_AudioStream's conversion");
+            }
+        }
+    }
+
+    /* frames bigger than the chunk headers end up straddling the end of
+       the ring, and have to be put back together. */
+    id = SDL_OpenAudioDevice(filename, 0, &desired, NULL, 0);
+    SDLTest_AssertCheck(id > 1, "Validate device ID; expected: >1 got: %d", (int) id);
+    if (id > 1) {
+        const int wide = 32;
+        const int wideframes = 37;
+        float *widebuf = (float *) SDL_calloc(wideframes * wide, sizeof (float));
+        SDLTest_AssertCheck(widebuf != NULL, "Validate buffer was allocated");
+        /* while it plays, so the ring wraps around. */
+        SDL_PauseAudioDevice(id, 0);
+        for (i = 0; (widebuf != NULL) && (i < 200); i++) {
+            result = SDL_QueueAudioFormat(id, widebuf, wideframes * wide * sizeof (float), AUDIO_F32SYS, wide, 44100);
+            if (result != 0) {
+                break;
+            }
+            if ((i % 8) == 0) {
+                SDL_Delay(1);
+            }
+        }
+        SDLTest_AssertCheck(result == 0, "Validate SDL_QueueAudioFormat with %d channels; got: %d", wide, result);
+        startticks = SDL_GetTicks();
+        while ((SDL_GetQueuedAudioSize(id) > 0) && !SDL_TICKS_PASSED(SDL_GetTicks(), startticks + 5000)) {
+            SDL_Delay(10);
+        }
+        SDLTest_AssertCheck(SDL_GetQueuedAudioSize(id) == 0, "Validate the %d channel queue drained", wide);
+        SDL_CloseAudioDevice(id);
+        SDL_free(widebuf);
+    }
+
+    SDL_AudioQuit();
+    remove(filename);
+    SDL_free(native);
+    SDL_free(mono);
+    SDL_free(expected);
+    SDL_free(played);
+
+    /* Restart audio again */
+    _audioSetUp(NULL);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * \brief Play voices through the built-in mixer and check what the device plays.
+ *
+ * \sa https://wiki.libsdl.org/SDL_CreateAudioVoice
+ * \sa https://wiki.libsdl.org/SDL_SetAudioVoiceParams
+ */
+int audio_mixerVoices()
+{
+    const char *filename = "sdlaudio-voices-test.raw";
+    const int frames = 4410;
+    SDL_AudioSpec desired;
+    SDL_AudioDeviceID id;
+    SDL_AudioVoiceID voice, voice2, voice3;
+    SDL_RWops *rw;
+    Sint16 *sound;
+    Sint16 *played = NULL;
+    Sint64 playedlen = 0;
+    Uint32 startticks;
+    int offset;
+    int result;
+    int errors = 0;
+    int i;
+
+    sound = (Sint16 *) SDL_malloc(frames * sizeof (Sint16));
+    SDLTest_AssertCheck(sound != NULL, "Validate buffer was allocated");
+    if (sound == NULL) {
+        return TEST_ABORTED;
+    }
+    for (i = 0; i < frames; i++) {
+        sound[i] = (Sint16) (((i * 7919) & 0x3FFF) + 2);
+    }
+
+    SDL_setenv("SDL_DISKAUDIODELAY", "0", 1);
+    SDL_AudioQuit();
+    result = SDL_AudioInit("disk");
+    SDLTest_AssertPass("Call to SDL_AudioInit('disk')");
+    if (result != 0) {
+        SDLTest_Log("Disk audio driver not available, skipping.");
+        SDL_free(sound);
+        _audioSetUp(NULL);
+        return TEST_SKIPPED;
+    }
+
+    SDL_zero(desired);
+    desired.freq = 44100;
+    desired.format = AUDIO_S16SYS;
+    desired.channels = 2;
+    desired.samples = 1024;
+    desired.callback = NULL;  /* the queue stays empty; only the voice plays. */
+    SDL_SetHint(SDL_HINT_AUDIO_MIXER_VOICES, "2");
+    id = SDL_OpenAudioDevice(filename, 0, &desired, NULL, 0);
+    SDLTest_AssertPass("Call to SDL_OpenAudioDevice('%s', 0, ...)", filename);
+    SDLTest_AssertCheck(id > 1, "Validate device ID; expected: >1 got: %d", (int) id);
+    if (id > 1) {
+        voice = SDL_CreateAudioVoice(id, sound, frames * sizeof (Sint16), AUDIO_S16SYS, 1, 44100);
+        SDLTest_AssertCheck(voice != 0, "Validate SDL_CreateAudioVoice result; got: %u", (unsigned int) voice);
+        voice2 = SDL_CreateAudioVoice(id, sound, 3, AUDIO_S16SYS, 1, 44100);
+        SDLTest_AssertCheck(voice2 == 0, "Validate partial sample frames are rejected");
+        voice2 = SDL_CreateAudioVoice(id, sound, 64, AUDIO_S16SYS, 1, 44100);
+        voice3 = SDL_CreateAudioVoice(id, sound, 64, AUDIO_S16SYS, 1, 44100);
+        SDLTest_AssertCheck((voice2 != 0) && (voice3 == 0), "Validate SDL_HINT_AUDIO_MIXER_VOICES limits voices; got: %u, %u",
+                            (unsigned int) voice2, (unsigned int) voice3);
+        SDL_DestroyAudioVoice(id, voice2);
+        result = SDL_PlayAudioVoice(id, voice2, SDL_FALSE);
+        SDLTest_AssertCheck(result == -1, "Validate a destroyed voice can't be played; got: %d", result);
+
+        result = SDL_SetAudioVoiceParams(id, voice, 0.5f, 0.0f, 0.0f);
+        SDLTest_AssertCheck(result == -1, "Validate a zero ratio is rejected; got: %d", result);
+        result = SDL_SetAudioVoiceParams(id, voice, 0.5f, -1.0f, 1.0f);
+        SDLTest_AssertCheck(result == 0, "Validate SDL_SetAudioVoiceParams result; got: %d", result);
+        result = SDL_PlayAudioVoice(id, voice, SDL_FALSE);
+        SDLTest_AssertCheck(result == 0, "Validate SDL_PlayAudioVoice result; got: %d", result);
+        SDLTest_AssertCheck(SDL_IsAudioVoicePlaying(id, voice), "Validate the voice is playing");
+
+        SDL_PauseAudioDevice(id, 0);
+        startticks = SDL_GetTicks();
+        while (SDL_IsAudioVoicePlaying(id, voice) && !SDL_TICKS_PASSED(SDL_GetTicks(), startticks + 5000)) {
+            SDL_Delay(10);
+        }
+        SDLTest_AssertCheck(!SDL_IsAudioVoicePlaying(id, voice), "Validate the voice stopped at the end of the sound");
+        SDL_CloseAudioDevice(id);
+        SDLTest_AssertPass("Call to SDL_CloseAudioDevice()");
+
+        rw = SDL_RWFromFile(filename, "rb");
+        SDLTest_AssertCheck(rw != NULL, "Verify the device's output file exists");
+        if (rw != NULL) {
+            playedlen = SDL_RWsize(rw);
+            played = (Sint16 *) SDL_malloc((size_t) playedlen);
+            if (played != NULL) {
+                playedlen = (Sint64) SDL_RWread(rw, played, 1, (size_t) playedlen);
+            }
+            SDL_RWclose(rw);
+        }
+
+        /* skip the silence it played before being unpaused; then the
+           sound should be on the left only, at half volume. */
+        if (played != NULL) {
+            const int samples = (int) (playedlen / sizeof (Sint16));
+            for (offset = 0; (offset < samples) && (played[offset] == 0); offset++) {
+                /* spin */
+            }
+            offset &= ~1;
+            SDLTest_AssertCheck(samples - offset >= frames * 2, "Validate played length; expected: >=%d got: %d",
+                                frames * 2, samples - offset);
+            if (samples - offset >= frames * 2) {
+                for (i = 0; i < frames; i++) {
+                    const int left = played[offset + (i * 2)];
+                    const int right = played[offset + (i * 2) + 1];
+                    if ((SDL_abs(left - (sound[i] / 2)) > 1) || (right != 0)) {
+                        errors++;
+                    }
+                }
+                SDLTest_AssertCheck(errors == 0, "Validate the voice was mixed at its gain and pan; %d frames differ", errors);
+            }
+        }
+    }
+    SDL_SetHint(SDL_HINT_AUDIO_MIXER_VOICES, NULL);
+
+    SDL_AudioQuit();
+    remove(filename);
+    SDL_free(sound);
+    SDL_free(played);
+
+    /* Restart audio again */
+    _audioSetUp(NULL);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * \brief Check the performance counters the device thread keeps.
+ *
+ * \sa https://wiki.libsdl.org/SDL_GetAudioDeviceStats
+ * \sa https://wiki.libsdl.org/SDL_ResetAudioDeviceStats
+ */
+int audio_getAudioDeviceStats()
+{
+    const char *filename = "sdlaudio-stats-test.raw";
+    SDL_AudioSpec desired;
+    SDL_AudioDeviceStats stats;
+    SDL_AudioDeviceID id;
+    Uint8 data[4096];
+    Uint32 startticks;
+    Uint32 total;
+    int result;
+    int i;
+
+    SDL_setenv("SDL_DISKAUDIODELAY", "0", 1);
+    SDL_AudioQuit();
+    result = SDL_AudioInit("disk");
+    SDLTest_AssertPass("Call to SDL_AudioInit('disk')");
+    if (result != 0) {
+        SDLTest_Log("Disk audio driver not available, skipping.");
+        _audioSetUp(NULL);
+        return TEST_SKIPPED;
+    }
+
+    SDL_zero(desired);
+    desired.freq = 44100;
+    desired.format = AUDIO_S16SYS;
+    desired.channels = 2;
+    desired.samples = 512;
+    desired.callback = NULL;  /* use SDL_QueueAudio() */
+    id = SDL_OpenAudioDevice(filename, 0, &desired, NULL, 0);
+    SDLTest_AssertPass("Call to SDL_OpenAudioDevice('%s', 0, ...)", filename);
+    SDLTest_AssertCheck(id > 1, "Validate device ID; expected: >1 got: %d", (int) id);
+    if (id > 1) {
+        result = SDL_GetAudioDeviceStats(id, NULL);
+        SDLTest_AssertCheck(result == -1, "Validate SDL_GetAudioDeviceStats(id, NULL) fails; got: %d", result);
+
+        /* the disk driver can't tell, so it reports one buffer. */
+        result = SDL_GetAudioDeviceLatency(id);
+        SDLTest_AssertCheck(result == (512 * 1000000) / 44100, "Validate SDL_GetAudioDeviceLatency result; expected: %d got: %d",
+                            (512 * 1000000) / 44100, result);
+        result = SDL_GetAudioDeviceLatency(0);
+        SDLTest_AssertCheck(result == -1, "Validate SDL_GetAudioDeviceLatency(0) fails; got: %d", result);
+
+        /* play a little, then run the queue dry. */
+        SDL_memset(data, 0x11, sizeof (data));
+        SDL_QueueAudio(id, data, sizeof (data));
+        SDL_PauseAudioDevice(id, 0);
+        startticks = SDL_GetTicks();
+        do {
+            SDL_Delay(10);
+            result = SDL_GetAudioDeviceStats(id, &stats);
+        } while ((result == 0) && (stats.buffers < 16) && !SDL_TICKS_PASSED(SDL_GetTicks(), startticks + 5000));
+        SDLTest_AssertCheck(result == 0, "Validate SDL_GetAudioDeviceStats result; got: %d", result);
+        SDLTest_AssertCheck(stats.buffers >= 16, "Validate buffers were counted; got: %u", (unsigned int) stats.buffers);
+        SDLTest_AssertCheck(stats.queue_underruns == 1, "Validate the queue ran dry once; got: %u", (unsigned int) stats.queue_underruns);
+        SDLTest_AssertCheck(stats.callback.count == stats.buffers, "Validate every buffer's callback was timed; got: %u of %u",
+                            (unsigned int) stats.callback.count, (unsigned int) stats.buffers);
+        SDLTest_AssertCheck(stats.jitter.count == stats.buffers - 1, "Validate the time between buffers was measured; got: %u",
+                            (unsigned int) stats.jitter.count);
+        SDLTest_AssertCheck(stats.callback.min_us <= stats.callback.max_us, "Validate callback min <= max; got: %u, %u",
+                            (unsigned int) stats.callback.min_us, (unsigned int) stats.callback.max_us);
+        total = 0;
+        for (i = 0; i < SDL_AUDIO_TIMING_BUCKETS; i++) {
+            total += stats.callback.histogram[i];
+        }
+        SDLTest_AssertCheck(total == stats.callback.count, "Validate the histogram adds up; got: %u", (unsigned int) total);
+
+        SDL_ResetAudioDeviceStats(id);
+        SDL_GetAudioDeviceStats(id, &stats);
+        SDLTest_AssertCheck(stats.queue_underruns == 0, "Validate SDL_ResetAudioDeviceStats clears underruns; got: %u",
+                            (unsigned int) stats.queue_underruns);
+        SDL_PauseAudioDevice(id, 1);
+        SDL_Delay(50);
+        SDL_PauseAudioDevice(id, 0);
+        SDL_Delay(50);
+        SDL_PauseAudioDevice(id, 1);
+        SDL_GetAudioDeviceStats(id, &stats);
+        SDLTest_AssertCheck(stats.callback.count == stats.buffers, "Validate counters start over consistently; got: %u of %u",
+                            (unsigned int) stats.callback.count, (unsigned int) stats.buffers);
+
+        SDL_CloseAudioDevice(id);
+        SDLTest_AssertPass("Call to SDL_CloseAudioDevice()");
+    }
+
+    SDL_AudioQuit();
+    remove(filename);
+
+    /* Restart audio again */
+    _audioSetUp(NULL);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * \brief Render to a .wav file through the disk driver and load it back.
+ *
+ * \sa https://wiki.libsdl.org/SDL_LoadWAV
+ */
+int audio_diskRenderWav()
+{
+    const char *filename = "sdlaudio-render-test.wav";
+    const int frames = 48000;
+    SDL_AudioSpec desired;
+    SDL_AudioSpec wavspec;
+    SDL_AudioDeviceID id;
+    SDL_RWops *rw;
+    float *sound;
+    Uint8 *wav = NULL;
+    Uint32 wavlen = 0;
+    Sint64 filelen = 0;
+    Uint32 startticks;
+    Uint32 offset;
+    int result;
+    int i;
+
+    sound = (float *) SDL_malloc(frames * 2 * sizeof (float));
+    SDLTest_AssertCheck(sound != NULL, "Validate buffer was allocated");
+    if (sound == NULL) {
+        return TEST_ABORTED;
+    }
+    for (i = 0; i < frames * 2; i++) {
+        sound[i] = ((float) ((i % 199) + 1)) / 256.0f;
+    }
+
+    SDL_setenv("SDL_DISKAUDIODELAY", "0", 1);
+    SDL_AudioQuit();
+    result = SDL_AudioInit("disk");
+    SDLTest_AssertPass("Call to SDL_AudioInit('disk')");
+    if (result != 0) {
+        SDLTest_Log("Disk audio driver not available, skipping.");
+        SDL_free(sound);
+        _audioSetUp(NULL);
+        return TEST_SKIPPED;
+    }
+
+    SDL_zero(desired);
+    desired.freq = 48000;
+    desired.format = AUDIO_F32SYS;
+    desired.channels = 2;
+    desired.samples = 1024;
+    desired.callback = NULL;  /* use SDL_QueueAudio() */
+    id = SDL_OpenAudioDevice(filename, 0, &desired, NULL, 0);
+    SDLTest_AssertPass("Call to SDL_OpenAudioDevice('%s', 0, ...)", filename);
+    SDLTest_AssertCheck(id > 1, "Validate device ID; expected: >1 got: %d", (int) id);
+    if (id > 1) {
+        /* a second of audio, which should take much less than that. */
+        SDL_QueueAudio(id, sound, frames * 2 * sizeof (float));
+        SDL_PauseAudioDevice(id, 0);
+        startticks = SDL_GetTicks();
+        while ((SDL_GetQueuedAudioSize(id) > 0) && !SDL_TICKS_PASSED(SDL_GetTicks(), startticks + 5000)) {
+            SDL_Delay(1);
+        }
+        SDLTest_AssertCheck(SDL_GetQueuedAudioSize(id) == 0, "Validate the queue drained");
+        SDLTest_AssertCheck(!SDL_TICKS_PASSED(SDL_GetTicks(), startticks + 900), "Validate it rendered faster than realtime; took %u ms",
+                            (unsigned int) (SDL_GetTicks() - startticks));
+        SDL_CloseAudioDevice(id);
+        SDLTest_AssertPass("Call to SDL_CloseAudioDevice()");
+
+        rw = SDL_RWFromFile(filename, "rb");
+        SDLTest_AssertCheck(rw != NULL, "Verify the device's output file exists");
+        if (rw != NULL) {
+            filelen = SDL_RWsize(rw);
+            if (SDL_LoadWAV_RW(rw, 0, &wavspec, &wav, &wavlen) == NULL) {
+                SDLTest_AssertCheck(SDL_FALSE, "Validate SDL_LoadWAV_RW loads the output; got error: %s", SDL_GetError());
+            }
+            SDL_RWclose(rw);
+        }
+    }
+
+    if (wav != NULL) {
+        SDLTest_AssertCheck(wavspec.format == AUDIO_F32LSB && wavspec.channels == 2 && wavspec.freq == 48000,
+                            "Validate the WAV's format; got: 0x%X, %d channels, %d Hz",
+                            (unsigned int) wavspec.format, (int) wavspec.channels, wavspec.freq);
+        SDLTest_AssertCheck(((Sint64) wavlen) + 44 == filelen, "Validate the header's data size; expected: %d got: %u",
+                            (int) (filelen - 44), (unsigned int) wavlen);
+
+        /* skip the silence it played before being unpaused. */
+        for (offset = 0; (offset < wavlen) && (wav[offset] == 0); offset++) {
+            /* spin */
+        }
+        offset &= ~7;
+        SDLTest_AssertCheck(wavlen - offset >= frames * 2 * sizeof (float), "Validate played length; got: %u",
+                            (unsigned int) (wavlen - offset));
+        if (wavlen - offset >= frames * 2 * sizeof (float)) {
+            SDLTest_AssertCheck(SDL_memcmp(wav + offset, sound, frames * 2 * sizeof (float)) == 0,
+                                "Validate the WAV holds what was queued");
+        }
+        SDL_FreeWAV(wav);
+    }
+
+    SDL_AudioQuit();
+    remove(filename);
+    SDL_free(sound);
+
+    /* Restart audio again */
+    _audioSetUp(NULL);
+
+    return TEST_COMPLETED;
+}
+
+/* Builds a WAVE file in memory: a LIST chunk, the format, then the data. */
+static int
+_buildWav(Uint8 *wav, Uint16 encoding, Uint16 channels, Uint16 bits, Uint16 blockalign,
+          Uint16 samplesperblock, const Uint8 *data, Uint32 datalen)
+{
+    static const Sint16 coeffs[7][2] = {
+        { 256, 0 }, { 512, -256 }, { 0, 0 }, { 192, 64 },
+        { 240, 0 }, { 460, -208 }, { 392, -232 }
+    };
+    const int fmtlen = (encoding == 0x0002) ? 50 : (encoding == 0x0011) ? 20 : 16;
+    SDL_RWops *rw = SDL_RWFromMem(wav, 128 + datalen);
+    int i;
+
+    SDL_RWwrite(rw, "RIFF", 4, 1);
+    SDL_WriteLE32(rw, 4 + 14 + (8 + fmtlen) + (8 + datalen));
+    SDL_RWwrite(rw, "WAVE", 4, 1);
+    SDL_RWwrite(rw, "LIST", 4, 1);
+    SDL_WriteLE32(rw, 6);
+    SDL_RWwrite(rw, "INFOxx", 6, 1);
+    SDL_RWwrite(rw, "fmt ", 4, 1);
+    SDL_WriteLE32(rw, fmtlen);
+    SDL_WriteLE16(rw, encoding);
+    SDL_WriteLE16(rw, channels);
+    SDL_WriteLE32(rw, 22050);
+    SDL_WriteLE32(rw, 22050 * blockalign / samplesperblock);
+    SDL_WriteLE16(rw, blockalign);
+    SDL_WriteLE16(rw, bits);
+    if (fmtlen > 16) {
+        SDL_WriteLE16(rw, fmtlen - 18);
+        SDL_WriteLE16(rw, samplesperblock);
+    }
+    if (fmtlen > 20) {
+        SDL_WriteLE16(rw, 7);
+        for (i = 0; i < 7; i++) {
+            SDL_WriteLE16(rw, (Uint16) coeffs[i][0]);
+            SDL_WriteLE16(rw, (Uint16) coeffs[i][1]);
+        }
+    }
+    SDL_RWwrite(rw, "data", 4, 1);
+    SDL_WriteLE32(rw, datalen);
+    SDL_RWwrite(rw, data, datalen, 1);
+    i = (int) SDL_RWtell(rw);
+    SDL_RWclose(rw);
+    return i;
+}
+
+/* Wraps another RWops and, once hidden.unknown.data2 is set, reads at most
+   that many bytes a call; like fread() on a pipe, a read that stops partway
+   into an object still consumes the bytes it got. */
+static size_t SDLCALL
+_shortRead(SDL_RWops *context, void *ptr, size_t size, size_t maxnum)
+{
+    SDL_RWops *rw = (SDL_RWops *) context->hidden.unknown.data1;
+    size_t cap = (size_t) (uintptr_t) context->hidden.unknown.data2;
+    size_t len = size * maxnum;
+    if ((cap != 0) && (len > cap)) {
+        len = cap;
+    }
+    return SDL_RWread(rw, ptr, 1, len) / size;
+}
+
+static Sint64 SDLCALL
+_shortReadSize(SDL_RWops *context)
+{
+    return SDL_RWsize((SDL_RWops *) context->hidden.unknown.data1);
+}
+
+static Sint64 SDLCALL
+_shortReadSeek(SDL_RWops *context, Sint64 offset, int whence)
+{
+    return SDL_RWseek((SDL_RWops *) context->hidden.unknown.data1, offset, whence);
+}
+
+static int SDLCALL
+_shortReadClose(SDL_RWops *context)
+{
+    int result = SDL_RWclose((SDL_RWops *) context->hidden.unknown.data1);
+    SDL_FreeRW(context);
+    return result;
+}
+
+static SDL_RWops *
+_shortReadRW(SDL_RWops *rw)
+{
+    SDL_RWops *context = SDL_AllocRW();
+    if (context == NULL) {
+        SDL_RWclose(rw);
+        return NULL;
+    }
+    context->size = _shortReadSize;
+    context->seek = _shortReadSeek;
+    context->read = _shortRead;
+    context->close = _shortReadClose;
+    context->hidden.unknown.data1 = rw;
+    context->hidden.unknown.data2 = NULL;
+    return context;
+}
+
+/**
+ * \brief Stream PCM and ADPCM WAVE files and compare them with SDL_LoadWAV_RW.
+ *
+ * \sa https://wiki.libsdl.org/SDL_OpenWAVStream_RW
+ * \sa https://wiki.libsdl.org/SDL_WAVStreamRead
+ * \sa https://wiki.libsdl.org/SDL_WAVStreamSeek
+ */
+int audio_streamWAV()
+{
+    static const struct
+    {
+        const char *name;
+        Uint16 encoding;
+        Uint16 channels;
+        Uint16 bits;
+        Uint16 blockalign;
+        Uint16 samplesperblock;
+        int headerlen;
+    } cases[] = {
+        { "PCM", 0x0001, 2, 16, 4, 1, 0 },
+        { "MS ADPCM mono", 0x0002, 1, 4, 256, 500, 7 },
+        { "MS ADPCM stereo", 0x0002, 2, 4, 512, 500, 14 },
+        { "IMA ADPCM stereo", 0x0011, 2, 4, 512, 505, 8 }
+    };
+    const Uint32 datalen = 9 * 512;
+    Uint8 *data = (Uint8 *) SDL_malloc(datalen);
+    Uint8 *wav = (Uint8 *) SDL_malloc(datalen + 128);
+    Uint8 *out = (Uint8 *) SDL_malloc(datalen * 8);
+    SDL_WAVStream *stream;
+    SDL_AudioSpec spec, streamspec;
+    Uint8 *loaded;
+    Uint32 loadedlen;
+    Uint32 framesize, got, block;
+    Sint64 frames, seekto;
+    int wavlen, result, c, i;
+
+    SDLTest_AssertCheck(data != NULL && wav != NULL && out != NULL, "Validate buffers were allocated");
+    if (data == NULL || wav == NULL || out == NULL) {
+        SDL_free(data);
+        SDL_free(wav);
+        SDL_free(out);
+        return TEST_ABORTED;
+    }
+
+    stream = SDL_OpenWAVStream_RW(NULL, 0, &streamspec);
+    SDLTest_AssertCheck(stream == NULL, "Validate SDL_OpenWAVStream_RW(NULL, ...) fails");
+
+    for (c = 0; c < SDL_arraysize(cases); c++) {
+        /* random blocks, with believable headers for the ADPCM ones. */
+        for (i = 0; i < datalen; i++) {
+            data[i] = (Uint8) SDLTest_RandomUint8();
+        }
+        for (block = 0; (cases[c].headerlen > 0) && (block < datalen); block += cases[c].blockalign) {
+            Uint8 *header = data + block;
+            for (i = 0; i < cases[c].channels; i++) {
+                if (cases[c].encoding == 0x0002) {
+                    header[i] = (Uint8) (header[i] % 7);
+                    header[cases[c].channels + (i * 2) + 1] &= 0x07;
+                } else {
+                    header[(i * 4) + 2] = (Uint8) (header[(i * 4) + 2] % 89);
+                    header[(i * 4) + 3] = 0;
+                }
+            }
+        }
+        wavlen = _buildWav(wav, cases[c].encoding, cases[c].channels, cases[c].bits,
+                           cases[c].blockalign, cases[c].samplesperblock, data, datalen);
+
+        loaded = NULL;
+        if (SDL_LoadWAV_RW(SDL_RWFromConstMem(wav, wavlen), 1, &spec, &loaded, &loadedlen) == NULL) {
+            SDLTest_AssertCheck(SDL_FALSE, "%s: validate SDL_LoadWAV_RW result; got error: %s", cases[c].name, SDL_GetError());
+            continue;
+        }
+
+        stream = SDL_OpenWAVStream_RW(SDL_RWFromConstMem(wav, wavlen), 1, &streamspec);
+        SDLTest_AssertCheck(stream != NULL, "%s: validate SDL_OpenWAVStream_RW result", cases[c].name);
+        if (stream == NULL) {
+            SDL_FreeWAV(loaded);
+            continue;
+        }
+        SDLTest_AssertCheck(streamspec.format == spec.format && streamspec.channels == spec.channels && streamspec.freq == spec.freq,
+                            "%s: validate the stream's spec matches SDL_LoadWAV_RW's", cases[c].name);
+        framesize = (SDL_AUDIO_BITSIZE(spec.format) / 8) * spec.channels;
+        frames = SDL_WAVStreamLength(stream);
+        SDLTest_AssertCheck(frames * framesize == loadedlen, "%s: validate SDL_WAVStreamLength; expected: %u got: %d",
+                            cases[c].name, (unsigned int) (loadedlen / framesize), (int) frames);
+
+        /* odd sized reads, which have to round down to whole frames. */
+        got = 0;
+        while ((result = SDL_WAVStreamRead(stream, out + got, 1001)) > 0) {
+            got += result;
+        }
+        SDLTest_AssertCheck(result == 0, "%s: validate reading ends with 0; got: %d", cases[c].name, result);
+        SDLTest_AssertCheck(got == loadedlen, "%s: validate bytes read; expected: %u got: %u",
+                            cases[c].name, (unsigned int) loadedlen, (unsigned int) got);
+        SDLTest_AssertCheck((got == loadedlen) && (SDL_memcmp(out, loaded, got) == 0),
+                            "%s: validate the stream decodes what SDL_LoadWAV_RW does", cases[c].name);
+        SDLTest_AssertCheck(SDL_WAVStreamTell(stream) == frames, "%s: validate SDL_WAVStreamTell at the end", cases[c].name);
+
+        /* into the middle of a block, onto a boundary, back to the start. */
+        for (i = 0; i < 3; i++) {
+            seekto = (i == 0) ? ((frames * 2) / 3 + 1) : (i == 1) ? (Sint64) cases[c].samplesperblock * 2 : 0;
+            result = SDL_WAVStreamSeek(stream, seekto);
+            SDLTest_AssertCheck(result == 0, "%s: validate SDL_WAVStreamSeek(%d); got: %d", cases[c].name, (int) seekto, result);
+            SDLTest_AssertCheck(SDL_WAVStreamTell(stream) == seekto, "%s: validate SDL_WAVStreamTell after seeking", cases[c].name);
+            result = SDL_WAVStreamRead(stream, out, 4096);
+            SDLTest_AssertCheck((result > 0) && (SDL_memcmp(out, loaded + (seekto * framesize), result) == 0),
+                                "%s: validate reading after SDL_WAVStreamSeek(%d)", cases[c].name, (int) seekto);
+        }
+        result = SDL_WAVStreamSeek(stream, frames + 1);
+        SDLTest_AssertCheck(result == -1, "%s: validate seeking past the end fails; got: %d", cases[c].name, result);
+
+        SDL_CloseWAVStream(stream);
+
+        /* a source that stops partway into a frame mustn't lose the piece. */
+        if (cases[c].encoding == 0x0001) {
+            SDL_RWops *rw = _shortReadRW(SDL_RWFromConstMem(wav, wavlen));
+            stream = SDL_OpenWAVStream_RW(rw, 1, &streamspec);
+            SDLTest_AssertCheck(stream != NULL, "%s: validate SDL_OpenWAVStream_RW on a short-reading source", cases[c].name);
+            if (stream != NULL) {
+                rw->hidden.unknown.data2 = (void *) (uintptr_t) 7;
+                got = 0;
+                while ((result = SDL_WAVStreamRead(stream, out + got, 1001)) > 0) {
+                    SDLTest_AssertCheck((result % framesize) == 0, "%s: validate short reads return whole frames; got: %d", cases[c].name, result);
+                    got += result;
+                }
+                SDLTest_AssertCheck((got == loadedlen) && (SDL_memcmp(out, loaded, got) == 0),
+                                    "%s: validate short reads decode what SDL_LoadWAV_RW does; got %u bytes", cases[c].name, (unsigned int) got);
+                SDL_CloseWAVStream(stream);
+            }
+        }
+        SDL_FreeWAV(loaded);
+    }
+
+    SDL_free(data);
+    SDL_free(wav);
+    SDL_free(out);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * \brief Decode multichannel ADPCM, across several threads, and compare each
+ *        channel with the same data decoded as mono.
+ *
+ * \sa https://wiki.libsdl.org/SDL_LoadWAV_RW
+ */
+int audio_loadWAVMultichannel()
+{
+    const int channels = 6;
+    const int blocks = 3000;
+    /* mono block sizes; a multichannel block holds one of each per channel. */
+    const Uint16 monoalign[2] = { 64, 36 };
+    const Uint16 samplesperblock[2] = { 116, 65 };
+    const Uint16 encodings[2] = { 0x0002, 0x0011 };
+    const Uint32 monolen = blocks * channels * 64;
+    Uint8 *mono = (Uint8 *) SDL_malloc(monolen);
+    Uint8 *multi = (Uint8 *) SDL_malloc(monolen);
+    Uint8 *wav = (Uint8 *) SDL_malloc(monolen + 128);
+    SDL_AudioSpec spec;
+    Sint16 *monopcm, *multipcm;
+    Uint32 monopcmlen, multipcmlen;
+    int e, b, c, k, wavlen, mismatches;
+
+    SDLTest_AssertCheck(mono != NULL && multi != NULL && wav != NULL, "Validate buffers were allocated");
+    if (mono == NULL || multi == NULL || wav == NULL) {
+        SDL_free(mono);
+        SDL_free(multi);
+        SDL_free(wav);
+        return TEST_ABORTED;
+    }
+
+    for (e = 0; e < 2; e++) {
+        const Uint32 align = monoalign[e];
+        const Uint32 spb = samplesperblock[e];
+
+        /* random mono blocks with believable headers... */
+        for (k = 0; k < blocks * channels * align; k++) {
+            mono[k] = (Uint8) SDLTest_RandomUint8();
+        }
+        for (b = 0; b < blocks * channels; b++) {
+            Uint8 *header = mono + (b * align);
+            if (encodings[e] == 0x0002) {
+                header[0] = (Uint8) (header[0] % 7);
+                header[2] &= 0x07;
+            } else {
+                header[2] = (Uint8) (header[2] % 89);
+                header[3] = 0;
+            }
+        }
+
+        /* ...and the same blocks interleaved, (channels) at a time. */
+        for (b = 0; b < blocks; b++) {
+            Uint8 *dst = multi + (b * channels * align);
+            for (c = 0; c < channels; c++) {
+                const Uint8 *src = mono + (((b * channels) + c) * align);
+                if (encodings[e] == 0x0002) {
+                    dst[c] = src[0];
+                    for (k = 0; k < 2; k++) {
+                        dst[channels + (c * 2) + k] = src[1 + k];
+                        dst[(channels * 3) + (c * 2) + k] = src[3 + k];
+                        dst[(channels * 5) + (c * 2) + k] = src[5 + k];
+                    }
+                    for (k = 0; k < (spb - 2); k++) {
+                        const Uint8 nybble = (k & 1) ? (src[7 + (k / 2)] & 0x0F) : (src[7 + (k / 2)] >> 4);
+                        const int s = (k * channels) + c;
+                        Uint8 *byte = &dst[(channels * 7) + (s / 2)];
+                        *byte = (s & 1) ? ((*byte & 0xF0) | nybble) : ((*byte & 0x0F) | (nybble << 4));
+                    }
+                } else {
+                    SDL_memcpy(dst + (c * 4), src, 4);
+                    for (k = 0; k < (spb - 1) / 8; k++) {
+                        SDL_memcpy(dst + (channels * 4) + (((k * channels) + c) * 4), src + 4 + (k * 4), 4);
+                    }
+                }
+            }
+        }
+
+        SDL_SetHint(SDL_HINT_WAVE_DECODE_THREADS, "1");
+        wavlen = _buildWav(wav, encodings[e], 1, 4, align, spb, mono, blocks * channels * align);
+        monopcm = NULL;
+        SDL_LoadWAV_RW(SDL_RWFromConstMem(wav, wavlen), 1, &spec, (Uint8 **) &monopcm, &monopcmlen);
+        SDLTest_AssertCheck(monopcm != NULL, "Validate mono SDL_LoadWAV_RW result (encoding 0x%.4x)", encodings[e]);
+
+        SDL_SetHint(SDL_HINT_WAVE_DECODE_THREADS, "4");
+        wavlen = _buildWav(wav, encodings[e], channels, 4, align * channels, spb, multi, blocks * channels * align);
+        multipcm = NULL;
+        SDL_LoadWAV_RW(SDL_RWFromConstMem(wav, wavlen), 1, &spec, (Uint8 **) &multipcm, &multipcmlen);
+        SDLTest_AssertCheck(multipcm != NULL, "Validate %d channel SDL_LoadWAV_RW result (encoding 0x%.4x)", channels, encodings[e]);
+
+        if (monopcm != NULL && multipcm != NULL) {
+            SDLTest_AssertCheck(spec.channels == channels, "Validate channels; expected: %d got: %d", channels, (int) spec.channels);
+            SDLTest_AssertCheck(monopcmlen == multipcmlen, "Validate decoded lengths match; expected: %u got: %u",
+                                (unsigned int) monopcmlen, (unsigned int) multipcmlen);
+            mismatches = 0;
+            for (b = 0; (monopcmlen == multipcmlen) && (b < blocks); b++) {
+                for (c = 0; c < channels; c++) {
+                    for (k = 0; k < spb; k++) {
+                        if (monopcm[(((b * channels) + c) * spb) + k] != multipcm[(((b * spb) + k) * channels) + c]) {
+                            mismatches++;
+                        }
+                    }
+                }
+            }
+            SDLTest_AssertCheck(mismatches == 0, "Validate every channel decodes like mono; got %d mismatches", mismatches);
+        }
+        SDL_FreeWAV((Uint8 *) monopcm);
+        SDL_FreeWAV((Uint8 *) multipcm);
+    }
+    SDL_SetHint(SDL_HINT_WAVE_DECODE_THREADS, NULL);
+
+    SDL_free(mono);
+    SDL_free(multi);
+    SDL_free(wav);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * \brief Decode ADPCM on a number of threads that doesn't divide the number
+ *        of blocks, and compare it with decoding on one thread.
+ *
+ * \sa https://wiki.libsdl.org/SDL_LoadWAV_RW
+ */
+int audio_loadWAVDecodeSplit()
+{
+    /* 33 big stereo IMA blocks, enough for eight threads to take some. */
+    const int blocks = 33;
+    const Uint16 spb = 65521;
+    const Uint16 align = 8 + ((65521 - 1) / 2) * 2;
+    const char *threads[3] = { "8", "5", "0" };
+    Uint8 *data = (Uint8 *) SDL_malloc(blocks * align);
+    Uint8 *wav = (Uint8 *) SDL_malloc(blocks * align + 128);
+    SDL_AudioSpec spec;
+    Uint8 *one, *many;
+    Uint32 onelen, manylen;
+    int b, c, k, wavlen;
+
+    SDLTest_AssertCheck(data != NULL && wav != NULL, "Validate buffers were allocated");
+    if (data == NULL || wav == NULL) {
+        SDL_free(data);
+        SDL_free(wav);
+        return TEST_ABORTED;
+    }
+
+    for (k = 0; k < blocks * align; k++) {
+        data[k] = (Uint8) SDLTest_RandomUint8();
+    }
+    for (b = 0; b < blocks; b++) {
+        for (c = 0; c < 2; c++) {
+            Uint8 *header = data + (b * align) + (c * 4);
+            header[2] = (Uint8) (header[2] % 89);
+            header[3] = 0;
+        }
+    }
+    wavlen = _buildWav(wav, 0x0011, 2, 4, align, spb, data, blocks * align);
+
+    SDL_SetHint(SDL_HINT_WAVE_DECODE_THREADS, "1");
+    one = NULL;
+    SDL_LoadWAV_RW(SDL_RWFromConstMem(wav, wavlen), 1, &spec, &one, &onelen);
+    SDLTest_AssertCheck(one != NULL, "Validate SDL_LoadWAV_RW result on one thread");
+    SDLTest_AssertCheck(onelen == (Uint32) (blocks * spb * 2 * sizeof (Sint16)), "Validate decoded length; expected: %u got: %u",
+                        (unsigned int) (blocks * spb * 2 * sizeof (Sint16)), (unsigned int) onelen);
+
+    for (k = 0; k < (int) SDL_arraysize(threads); k++) {
+        SDL_SetHint(SDL_HINT_WAVE_DECODE_THREADS, threads[k]);
+        many = NULL;
+        SDL_LoadWAV_RW(SDL_RWFromConstMem(wav, wavlen), 1, &spec, &many, &manylen);
+        SDLTest_AssertCheck(many != NULL, "Validate SDL_LoadWAV_RW result with SDL_WAVE_DECODE_THREADS=%s", threads[k]);
+        if (one != NULL && many != NULL) {
+            SDLTest_AssertCheck(manylen == onelen && SDL_memcmp(one, many, onelen) == 0,
+                                "Validate the samples match one thread's with SDL_WAVE_DECODE_THREADS=%s", threads[k]);
+        }
+        SDL_FreeWAV(many);
+    }
+    SDL_SetHint(SDL_HINT_WAVE_DECODE_THREADS, NULL);
+
+    SDL_FreeWAV(one);
+    SDL_free(data);
+    SDL_free(wav);
+
+    return TEST_COMPLETED;
+}
+
+/* Converts (frames) F32 frames with SDL_BuildAudioCVT(); returns the number of output frames. */
+static int _remixFrames(Uint8 src_channels, Uint8 dst_channels, const float *in, int frames, float *out)
+{
+    SDL_AudioCVT cvt;
+    int result;
+
+    result = SDL_BuildAudioCVT(&cvt, AUDIO_F32SYS, src_channels, 48000, AUDIO_F32SYS, dst_channels, 48000);
+    SDLTest_AssertCheck(result == 1, "Validate SDL_BuildAudioCVT(%d -> %d channels) result; expected: 1 got: %d", src_channels, dst_channels, result);
+    if (result != 1) {
+        return 0;
+    }
+    cvt.len = frames * src_channels * sizeof (float);
+    cvt.buf = (Uint8 *) SDL_malloc(cvt.len * cvt.len_mult);
+    if (cvt.buf == NULL) {
+        return 0;
+    }
+    SDL_memcpy(cvt.buf, in, cvt.len);
+    result = SDL_ConvertAudio(&cvt);
+    SDLTest_AssertCheck(result == 0, "Validate SDL_ConvertAudio result; expected: 0 got: %d", result);
+    SDLTest_AssertCheck(cvt.len_cvt == (int) (cvt.len * cvt.len_ratio), "Validate len_cvt; expected: %d got: %d", (int) (cvt.len * cvt.len_ratio), cvt.len_cvt);
+    SDL_memcpy(out, cvt.buf, cvt.len_cvt);
+    SDL_free(cvt.buf);
+    return cvt.len_cvt / (dst_channels * sizeof (float));
+}
+
+/**
+ * \brief Checks the standard channel layout conversions and a custom remix matrix.
+ *
+ * \sa https://wiki.libsdl.org/SDL_BuildAudioCVT
+ * \sa https://wiki.libsdl.org/SDL_AudioStreamSetChannelMatrix
+ */
+int audio_remixChannels()
+{
+    /* FL FR FC LFE BL BR SL SR */
+    const float speakers[8] = { 0.1f, 0.2f, 0.3f, 0.9f, 0.4f, 0.5f, -0.6f, 0.7f };
+    const float swap[4] = { 0.0f, 1.0f, 1.0f, 0.0f };
+    const int frames = 37;
+    float in[37 * 8], out[37 * 8], expected[8];
+    Sint16 pcm[4], converted[4];
+    SDL_AudioStream *stream;
+    int i, c, result, errors;
+
+    /* 5.1 to stereo */
+    for (i = 0; i < frames; i++) {
+        SDL_memcpy(&in[i * 6], speakers, 6 * sizeof (float));
+    }
+    expected[0] = (0.4142136f * 0.1f) + (0.2928932f * 0.3f) + (0.2928932f * 0.4f);
+    expected[1] = (0.4142136f * 0.2f) + (0.2928932f * 0.3f) + (0.2928932f * 0.5f);
+    result = _remixFrames(6, 2, in, frames, out);
+    SDLTest_AssertCheck(result == frames, "Validate 5.1 to stereo frames; expected: %d got: %d", frames, result);
+    for (i = 0, errors = 0; i < result * 2; i++) {
+        errors += (SDL_fabs(out[i] - expected[i % 2]) > 0.00001) ? 1 : 0;
+    }
+    SDLTest_AssertCheck(errors == 0, "Validate 5.1 to stereo mix; got %d errors", errors);
+
+    /* 7.1 to 5.1 folds the sides into the back */
+    for (i = 0; i < frames; i++) {
+        SDL_memcpy(&in[i * 8], speakers, 8 * sizeof (float));
+    }
+    SDL_memcpy(expected, speakers, 4 * sizeof (float));
+    expected[4] = (0.5857864f * 0.4f) + (0.4142136f * -0.6f);
+    expected[5] = (0.5857864f * 0.5f) + (0.4142136f * 0.7f);
+    result = _remixFrames(8, 6, in, frames, out);
+    SDLTest_AssertCheck(result == frames, "Validate 7.1 to 5.1 frames; expected: %d got: %d", frames, result);
+    for (i = 0, errors = 0; i < result * 6; i++) {
+        errors += (SDL_fabs(out[i] - expected[i % 6]) > 0.00001) ? 1 : 0;
+    }
+    SDLTest_AssertCheck(errors == 0, "Validate 7.1 to 5.1 mix; got %d errors", errors);
+
+    /* downmixes of full scale input don't clip */
+    for (i = 0; i < frames * 8; i++) {
+        in[i] = 1.0f;
+    }
+    for (c = 1; c <= 6; c++) {
+        if ((c == 3) || (c == 5)) {
+            continue;
+        }
+        result = _remixFrames(8, (Uint8) c, in, frames, out);
+        for (i = 0, errors = 0; i < result * c; i++) {
+            errors += ((out[i] > 1.0f) || ((c != 6 || (i % c) != 3) && (out[i] < 0.99999f))) ? 1 : 0;
+        }
+        SDLTest_AssertCheck(errors == 0, "Validate 7.1 to %d channels is full scale without clipping; got %d errors", c, errors);
+    }
+
+    /* stereo to 7.1 only uses the front pair */
+    for (i = 0; i < frames; i++) {
+        in[i * 2] = 0.25f;
+        in[(i * 2) + 1] = -0.5f;
+    }
+    result = _remixFrames(2, 8, in, frames, out);
+    SDLTest_AssertCheck(result == frames, "Validate stereo to 7.1 frames; expected: %d got: %d", frames, result);
+    for (i = 0, errors = 0; i < result * 8; i++) {
+        const float want = ((i % 8) == 0) ? 0.25f : (((i % 8) == 1) ? -0.5f : 0.0f);
+        errors += (out[i] != want) ? 1 : 0;
+    }
+    SDLTest_AssertCheck(errors == 0, "Validate stereo to 7.1 mix; got %d errors", errors);
+
+    /* mono to stereo, through a stream in another format */
+    stream = SDL_NewAudioStream(AUDIO_S16SYS, 1, 22050, AUDIO_S16SYS, 2, 22050);
+    SDLTest_AssertCheck(stream != NULL, "Validate SDL_NewAudioStream result");
+    if (stream == NULL) {
+        return TEST_ABORTED;
+    }
+    pcm[0] = 1000;
+    pcm[1] = -32768;
+    SDL_AudioStreamPut(stream, pcm, 2 * sizeof (Sint16));
+    result = SDL_AudioStreamGet(stream, converted, sizeof (converted));
+    SDLTest_AssertCheck(result == sizeof (converted), "Validate SDL_AudioStreamGet result; expected: %d got: %d", (int) sizeof (converted), result);
+    SDLTest_AssertCheck(converted[0] == 1000 && converted[1] == 1000 && converted[2] == -32768 && converted[3] == -32768,
+                        "Validate mono to stereo; got: %d %d %d %d", converted[0], converted[1], converted[2], converted[3]);
+    SDL_FreeAudioStream(stream);
+
+    /* a custom matrix applies even when the channel counts match */
+    result = SDL_AudioStreamSetChannelMatrix(NULL, swap);
+    SDLTest_AssertCheck(result == -1, "Validate SDL_AudioStreamSetChannelMatrix(NULL) result; expected: -1 got: %d", result);
+    stream = SDL_NewAudioStream(AUDIO_S16SYS, 2, 22050, AUDIO_S16SYS, 2, 22050);
+    SDLTest_AssertCheck(stream != NULL, "Validate SDL_NewAudioStream result");
+    if (stream == NULL) {
+        return TEST_ABORTED;
+    }
+    result = SDL_AudioStreamSetChannelMatrix(stream, swap);
+    SDLTest_AssertCheck(result == 0, "Validate SDL_AudioStreamSetChannelMatrix result; expected: 0 got: %d", result);
+    pcm[0] = 1000;
+    pcm[1] = -2000;
+    pcm[2] = 3000;
+    pcm[3] = -4000;
+    SDL_AudioStreamPut(stream, pcm, sizeof (pcm));
+    result = SDL_AudioStreamGet(stream, converted, sizeof (converted));
+    SDLTest_AssertCheck(result == sizeof (converted), "Validate SDL_AudioStreamGet result; expected: %d got: %d", (int) sizeof (converted), result);
+    SDLTest_AssertCheck(converted[0] == -2000 && converted[1] == 1000 && converted[2] == -4000 && converted[3] == 3000,
+                        "Validate left and right were swapped; got: %d %d %d %d", converted[0], converted[1], converted[2], converted[3]);
+
+    result = SDL_AudioStreamSetChannelMatrix(stream, NULL);
+    SDLTest_AssertCheck(result == 0, "Validate SDL_AudioStreamSetChannelMatrix(stream, NULL) result; expected: 0 got: %d", result);
+    SDL_AudioStreamPut(stream, pcm, sizeof (pcm));
+    result = SDL_AudioStreamGet(stream, converted, sizeof (converted));
+    SDLTest_AssertCheck(result == sizeof (converted) && SDL_memcmp(pcm, converted, sizeof (pcm)) == 0, "Validate data passes through unchanged again");
+    SDL_FreeAudioStream(stream);
+
+    return TEST_COMPLETED;
+}
+
+/* Collects the audio category's debug log while a conversion is planned. */
+static char _audio_testLog[2048];
+
+static void SDLCALL _audio_testLogOutput(void *userdata, int category, SDL_LogPriority priority, const char *message)
+{
+    if (category == SDL_LOG_CATEGORY_AUDIO) {
+        SDL_strlcat(_audio_testLog, message, sizeof (_audio_testLog));
+        SDL_strlcat(_audio_testLog, "\n", sizeof (_audio_testLog));
+    }
+}
+
+/**
+ * \brief Checks conversions are planned with the fewest channels resampled.
+ *
+ * \sa https://wiki.libsdl.org/SDL_BuildAudioCVT
+ * \sa https://wiki.libsdl.org/SDL_NewAudioStream
+ */
+int audio_convertAudioPlan()
+{
+    const int frames = 2205;
+    SDL_LogOutputFunction output;
+    void *userdata;
+    SDL_LogPriority priority;
+    SDL_AudioCVT cvt;
+    SDL_AudioStream *mono, *stereo;
+    Sint16 *src;
+    float *mono_out, *stereo_out;
+    char *resample, *remix;
+    int mono_len, stereo_len;
+    int result;
+    int errors;
+    int i;
+
+    SDL_LogGetOutputFunction(&output, &userdata);
+    priority = SDL_LogGetPriority(SDL_LOG_CATEGORY_AUDIO);
+    SDL_LogSetOutputFunction(_audio_testLogOutput, NULL);
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_AUDIO, SDL_LOG_PRIORITY_DEBUG);
+
+    /* upmixes resample first, at the source channel count */
+    _audio_testLog[0] = '\0';
+    result = SDL_BuildAudioCVT(&cvt, AUDIO_U8, 2, 22050, AUDIO_S16LSB, 6, 48000);
+    SDLTest_AssertCheck(result == 1, "Validate SDL_BuildAudioCVT result; expected: 1 got: %d", result);
+    resample = SDL_strstr(_audio_testLog, "resample 22050Hz -> 48000Hz, 2 channels");
+    remix = SDL_strstr(_audio_testLog, "remix 2 -> 6 channels");
+    SDLTest_AssertCheck(resample && remix && (resample < remix), "Validate stereo is resampled before it's upmixed to 5.1");
+    SDLTest_AssertCheck(cvt.filter_index <= 3, "Validate the chain is at most three passes; got %d", cvt.filter_index);
+    SDLTest_AssertCheck(SDL_strstr(_audio_testLog, "resample 22050Hz -> 48000Hz, 2 channels, quality 1, AUDIO_U8 -> ") != NULL,
+                        "Validate the conversion from U8 is fused with the resampler");
+
+    /* downmixes resample last, at the destination channel count */
+    _audio_testLog[0] = '\0';
+    result = SDL_BuildAudioCVT(&cvt, AUDIO_S16LSB, 6, 48000, AUDIO_U8, 2, 22050);
+    SDLTest_AssertCheck(result == 1, "Validate SDL_BuildAudioCVT result; expected: 1 got: %d", result);
+    resample = SDL_strstr(_audio_testLog, "resample 48000Hz -> 22050Hz, 2 channels");
+    remix = SDL_strstr(_audio_testLog, "remix 6 -> 2 channels");
+    SDLTest_AssertCheck(resample && remix && (remix < resample), "Validate 5.1 is downmixed before it's resampled");
+
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_AUDIO, priority);
+    SDL_LogSetOutputFunction(output, userdata);
+    SDLTest_Log("%s", _audio_testLog);
+
+    /* an upmixing stream resamples mono and copies it to both sides */
+    src = (Sint16 *) SDL_malloc(frames * sizeof (Sint16));
+    mono_out = (float *) SDL_malloc((frames * 2 + 16) * sizeof (float));
+    stereo_out = (float *) SDL_malloc((frames * 2 + 16) * 2 * sizeof (float));
+    mono = SDL_NewAudioStream(AUDIO_S16SYS, 1, 22050, AUDIO_F32SYS, 1, 44100);
+    stereo = SDL_NewAudioStream(AUDIO_S16SYS, 1, 22050, AUDIO_F32SYS, 2, 44100);
+    SDLTest_AssertCheck(src && mono_out && stereo_out && mono && stereo, "Validate buffers and streams were created");
+    if (!src || !mono_out || !stereo_out || !mono || !stereo) {
+        SDL_free(src);
+        SDL_free(mono_out);
+        SDL_free(stereo_out);
+        SDL_FreeAudioStream(mono);
+        SDL_FreeAudioStream(stereo);
+        return TEST_ABORTED;
+    }
+    for (i = 0; i < frames; i++) {
+        src[i] = (Sint16) (SDL_sin(i * 440.0 * 2.0 * M_PI / 22050) * 16000.0);
+    }
+    SDL_AudioStreamPut(mono, src, frames * sizeof (Sint16));
+    SDL_AudioStreamFlush(mono);
+    mono_len = SDL_AudioStreamGet(mono, mono_out, (frames * 2 + 16) * sizeof (float));
+    for (i = 0; i < frames; i += 100) {
+        SDL_AudioStreamPut(stereo, src + i, SDL_min(100, frames - i) * sizeof (Sint16));
+    }
+    SDL_AudioStreamFlush(stereo);
+    stereo_len = SDL_AudioStreamGet(stereo, stereo_out, (frames * 2 + 16) * 2 * sizeof (float));
+    SDLTest_AssertCheck(mono_len == frames * 2 * sizeof (float), "Validate mono length; expected: %d got: %d", (int) (frames * 2 * sizeof (float)), mono_len);
+    SDLTest_AssertCheck(stereo_len == mono_len * 2, "Validate stereo length; expected: %d got: %d", mono_len * 2, stereo_len);
+    for (i = 0, errors = 0; i < (stereo_len / (int) (2 * sizeof (float))); i++) {
+        errors += ((stereo_out[i * 2] != mono_out[i]) || (stereo_out[i * 2 + 1] != mono_out[i])) ? 1 : 0;
+    }
+    SDLTest_AssertCheck(errors == 0, "Validate both channels match the mono conversion; got %d errors", errors);
+
+    SDL_FreeAudioStream(mono);
+    SDL_FreeAudioStream(stereo);
+    SDL_free(src);
+    SDL_free(mono_out);
+    SDL_free(stereo_out);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * \brief Checks a conversion's filter list holds only its filters, and still converts once copied.
+ *
+ * \sa https://wiki.libsdl.org/SDL_BuildAudioCVT
+ * \sa https://wiki.libsdl.org/SDL_ConvertAudio
+ */
+int audio_convertCopiedCVT()
+{
+    const int frames = 4800;
+    SDL_AudioCVT cvt;
+    SDL_AudioCVT *copy;
+    Sint16 *src;
+    Uint8 *buf, *copybuf;
+    int result;
+    int loud;
+    int i;
+
+    result = SDL_BuildAudioCVT(&cvt, AUDIO_S16SYS, 6, 48000, AUDIO_U8, 2, 22050);
+    SDLTest_AssertCheck(result == 1, "Validate SDL_BuildAudioCVT result; expected: 1 got: %d", result);
+    for (i = cvt.filter_index; i < (int) SDL_arraysize(cvt.filters); i++) {
+        SDLTest_AssertCheck(cvt.filters[i] == NULL, "Validate filter slot %d past the end of the list is unused", i);
+    }
+
+    src = (Sint16 *) SDL_malloc(frames * 6 * sizeof (Sint16));
+    copy = (SDL_AudioCVT *) SDL_malloc(sizeof (SDL_AudioCVT));
+    buf = (Uint8 *) SDL_malloc(frames * 6 * sizeof (Sint16) * cvt.len_mult);
+    copybuf = (Uint8 *) SDL_malloc(frames * 6 * sizeof (Sint16) * cvt.len_mult);
+    SDLTest_AssertCheck(src && copy && buf && copybuf, "Validate buffers were allocated");
+    if (!src || !copy || !buf || !copybuf) {
+        SDL_free(src);
+        SDL_free(copy);
+        SDL_free(buf);
+        SDL_free(copybuf);
+        return TEST_ABORTED;
+    }
+    for (i = 0; i < frames * 6; i++) {
+        src[i] = (Sint16) (SDL_sin((i / 6) * 440.0 * 2.0 * M_PI / 48000) * 16000.0);
+    }
+
+    /* a copy made after building converts just like the original */
+    *copy = cvt;
+    SDL_memcpy(buf, src, frames * 6 * sizeof (Sint16));
+    SDL_memcpy(copybuf, src, frames * 6 * sizeof (Sint16));
+    cvt.buf = buf;
+    cvt.len = frames * 6 * sizeof (Sint16);
+    copy->buf = copybuf;
+    copy->len = cvt.len;
+    result = SDL_ConvertAudio(&cvt);
+    SDLTest_AssertCheck(result == 0, "Validate SDL_ConvertAudio result; expected: 0 got: %d", result);
+    result = SDL_ConvertAudio(copy);
+    SDLTest_AssertCheck(result == 0, "Validate SDL_ConvertAudio result on the copy; expected: 0 got: %d", result);
+    SDLTest_AssertCheck(copy->len_cvt == cvt.len_cvt, "Validate lengths match; expected: %d got: %d", cvt.len_cvt, copy->len_cvt);
+    SDLTest_AssertCheck(SDL_memcmp(buf, copybuf, SDL_min(cvt.len_cvt, copy->len_cvt)) == 0, "Validate the copy's output matches");
+    for (i = 0, loud = 0; i < cvt.len_cvt; i++) {
+        loud += (SDL_abs(((int) buf[i]) - 128) > 16) ? 1 : 0;
+    }
+    SDLTest_AssertCheck(loud > 0, "Validate the output isn't silent");
+
+    SDL_free(src);
+    SDL_free(copy);
+    SDL_free(buf);
+    SDL_free(copybuf);
+
+    return TEST_COMPLETED;
+}
+
+/* Converts in place; returns the converted length, or -1. */
+static int
+_convertInPlaceAt(SDL_AudioFormat src_fmt, Uint8 src_channels, int src_rate,
+                  SDL_AudioFormat dst_fmt, Uint8 dst_channels, int dst_rate, Uint8 *buf, int len)
+{
+    SDL_AudioCVT cvt;
+    if (SDL_BuildAudioCVT(&cvt, src_fmt, src_channels, src_rate, dst_fmt, dst_channels, dst_rate) < 0) {
+        return -1;
+    }
+    cvt.buf = buf;
+    cvt.len = len;
+    if (!cvt.needed) {
+        return len;
+    }
+    return (SDL_ConvertAudio(&cvt) < 0) ? -1 : cvt.len_cvt;
+}
+
+static int
+_convertInPlace(SDL_AudioFormat src_fmt, Uint8 src_channels, SDL_AudioFormat dst_fmt, Uint8 dst_channels, Uint8 *buf, int len)
+{
+    return _convertInPlaceAt(src_fmt, src_channels, 48000, dst_fmt, dst_channels, 48000, buf, len);
+}
+
+/* Fills (len) bytes of (format) with noise; float goes a little past full scale, so clipping is covered too. */
+static void
+_fillNoise(SDL_AudioFormat format, Uint8 *buf, int len)
+{
+    int i;
+    if (SDL_AUDIO_ISFLOAT(format)) {
+        for (i = 0; i < (len / (int) sizeof (float)); i++) {
+            ((float *) buf)[i] = SDL_SwapFloatLE(SDLTest_RandomUnitFloat() * 2.2f - 1.1f);
+        }
+    } else {
+        for (i = 0; i < len; i++) {
+            buf[i] = SDLTest_RandomUint8();
+        }
+    }
+}
+
+/**
+ * \brief Checks fused converters match converting to float, remixing or resampling, and converting back.
+ *
+ * \sa https://wiki.libsdl.org/SDL_BuildAudioCVT
+ * \sa https://wiki.libsdl.org/SDL_ConvertAudio
+ */
+int audio_convertFusedExact()
+{
+    static const struct {
+        SDL_AudioFormat src_fmt;
+        Uint8 src_channels;
+        SDL_AudioFormat dst_fmt;
+        Uint8 dst_channels;
+    } fused[] = {
+        { AUDIO_U8, 1, AUDIO_S16LSB, 2 }, { AUDIO_U8, 1, AUDIO_F32LSB, 2 },
+        { AUDIO_S16LSB, 1, AUDIO_S16LSB, 2 }, { AUDIO_S16LSB, 1, AUDIO_F32LSB, 2 },
+        { AUDIO_S16LSB, 2, AUDIO_S16LSB, 1 }, { AUDIO_S16LSB, 2, AUDIO_F32LSB, 1 },
+        { AUDIO_S16LSB, 2, AUDIO_S16LSB, 6 }, { AUDIO_F32LSB, 1, AUDIO_S16LSB, 2 },
+        { AUDIO_F32LSB, 2, AUDIO_S16LSB, 1 }, { AUDIO_F32LSB, 2, AUDIO_S16LSB, 6 },
+        { AUDIO_S32LSB, 1, AUDIO_F32LSB, 2 }, { AUDIO_S32LSB, 2, AUDIO_F32LSB, 1 },
+        { AUDIO_F32LSB, 1, AUDIO_S32LSB, 2 }
+    };
+    static const struct {
+        SDL_AudioFormat src_fmt;
+        int src_rate;
+        SDL_AudioFormat dst_fmt;
+        int dst_rate;
+        Uint8 channels;
+    } resampled[] = {
+        { AUDIO_S16LSB, 44100, AUDIO_F32LSB, 48000, 2 }, { AUDIO_S16LSB, 44100, AUDIO_S16LSB, 48000, 2 },
+        { AUDIO_F32LSB, 48000, AUDIO_S16LSB, 44100, 2 }, { AUDIO_U8, 22050, AUDIO_S16MSB, 48000, 1 },
+        { AUDIO_S32LSB, 96000, AUDIO_F32LSB, 44100, 6 }
+    };
+    const int frames = 4096;
+    const int buflen = frames * 6 * sizeof (float) * 4;
+    SDL_LogOutputFunction output;
+    void *userdata;
+    SDL_LogPriority priority;
+    Uint8 *src, *converted, *expected;
+    int src_len, converted_len, expected_len;
+    int used;
+    int errors;
+    int i, j;
+
+    src = (Uint8 *) SDL_malloc(buflen);
+    converted = (Uint8 *) SDL_malloc(buflen);
+    expected = (Uint8 *) SDL_malloc(buflen);
+    SDLTest_AssertCheck(src && converted && expected, "Validate buffers were allocated");
+    if (!src || !converted || !expected) {
+        SDL_free(src);
+        SDL_free(converted);
+        SDL_free(expected);
+        return TEST_ABORTED;
+    }
+
+    SDL_LogGetOutputFunction(&output, &userdata);
+    priority = SDL_LogGetPriority(SDL_LOG_CATEGORY_AUDIO);
+    SDL_LogSetOutputFunction(_audio_testLogOutput, NULL);
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_AUDIO, SDL_LOG_PRIORITY_DEBUG);
+
+    /* type conversion and remixing: only used where SSE2 isn't, so just count them */
+    for (i = 0, used = 0; i < (int) SDL_arraysize(fused); i++) {
+        src_len = frames * fused[i].src_channels * (SDL_AUDIO_BITSIZE(fused[i].src_fmt) / 8);
+        _fillNoise(fused[i].src_fmt, src, src_len);
+
+        _audio_testLog[0] = '\0';
+        SDL_memcpy(converted, src, src_len);
+        converted_len = _convertInPlace(fused[i].src_fmt, fused[i].src_channels, fused[i].dst_fmt, fused[i].dst_channels, converted, src_len);
+        used += (SDL_strstr(_audio_testLog, "(fused)") != NULL) ? 1 : 0;
+
+        SDL_memcpy(expected, src, src_len);
+        expected_len = _convertInPlace(fused[i].src_fmt, fused[i].src_channels, AUDIO_F32SYS, fused[i].src_channels, expected, src_len);
+        expected_len = _convertInPlace(AUDIO_F32SYS, fused[i].src_channels, AUDIO_F32SYS, fused[i].dst_channels, expected, expected_len);
+        expected_len = _convertInPlace(AUDIO_F32SYS, fused[i].dst_channels, fused[i].dst_fmt, fused[i].dst_channels, expected, expected_len);
+
+        SDLTest_AssertCheck(converted_len == expected_len, "Validate length; expected: %d got: %d", expected_len, converted_len);
+        for (j = 0, errors = 0; (j < converted_len) && (j < expected_len); j++) {
+            errors += (converted[j] != expected[j]) ? 1 : 0;
+        }
+        SDLTest_AssertCheck(errors == 0, "Validate 0x%04x %d channels -> 0x%04x %d channels matches the unfused conversion; got %d bytes different",
+                            fused[i].src_fmt, fused[i].src_channels, fused[i].dst_fmt, fused[i].dst_channels, errors);
+    }
+
+    /* type conversion and resampling */
+    for (i = 0; i < (int) SDL_arraysize(resampled); i++) {
+        const Uint8 chans = resampled[i].channels;
+        src_len = frames * chans * (SDL_AUDIO_BITSIZE(resampled[i].src_fmt) / 8);
+        _fillNoise(resampled[i].src_fmt, src, src_len);
+
+        _audio_testLog[0] = '\0';
+        SDL_memcpy(converted, src, src_len);
+        converted_len = _convertInPlaceAt(resampled[i].src_fmt, chans, resampled[i].src_rate,
+                                          resampled[i].dst_fmt, chans, resampled[i].dst_rate, converted, src_len);
+        SDLTest_AssertCheck(SDL_strstr(_audio_testLog, "(fused)") != NULL, "Validate 0x%04x %dHz -> 0x%04x %dHz is fused",
+                            resampled[i].src_fmt, resampled[i].src_rate, resampled[i].dst_fmt, resampled[i].dst_rate);
+
+        SDL_memcpy(expected, src, src_len);
+        expected_len = _convertInPlaceAt(resampled[i].src_fmt, chans, resampled[i].src_rate, AUDIO_F32SYS, chans, resampled[i].src_rate, expected, src_len);
+        expected_len = _convertInPlaceAt(AUDIO_F32SYS, chans, resampled[i].src_rate, AUDIO_F32SYS, chans, resampled[i].dst_rate, expected, expected_len);
+        expected_len = _convertInPlaceAt(AUDIO_F32SYS, chans, resampled[i].dst_rate, resampled[i].dst_fmt, chans, resampled[i].dst_rate, expected, expected_len);
+
+        SDLTest_AssertCheck(converted_len == expected_len, "Validate length; expected: %d got: %d", expected_len, converted_len);
+        for (j = 0, errors = 0; (j < converted_len) && (j < expected_len); j++) {
+            errors += (converted[j] != expected[j]) ? 1 : 0;
+        }
+        SDLTest_AssertCheck(errors == 0, "Validate 0x%04x %dHz -> 0x%04x %dHz matches the unfused conversion; got %d bytes different",
+                            resampled[i].src_fmt, resampled[i].src_rate, resampled[i].dst_fmt, resampled[i].dst_rate, errors);
+    }
+
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_AUDIO, priority);
+    SDL_LogSetOutputFunction(output, userdata);
+    SDLTest_Log("%d of %d type conversions and remixes were fused", used, (int) SDL_arraysize(fused));
+
+    SDL_free(src);
+    SDL_free(converted);
+    SDL_free(expected);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * \brief Checks the callback cadence of a driver with no device to block on.
+ *
+ * \sa https://wiki.libsdl.org/SDL_OpenAudioDevice
+ * \sa https://wiki.libsdl.org/SDL_PauseAudioDevice
+ */
+int audio_fakeStreamPacing()
+{
+    SDL_AudioSpec desired;
+    SDL_AudioDeviceID id;
+    Uint32 start;
+    Uint32 elapsed;
+    int expected;
+    int result;
+
+    SDL_AudioQuit();
+    result = SDL_AudioInit("dummy");
+    SDLTest_AssertPass("Call to SDL_AudioInit('dummy')");
+    if (result != 0) {
+        SDLTest_Log("Dummy audio driver not available, skipping.");
+        _audioSetUp(NULL);
+        return TEST_SKIPPED;
+    }
+
+    /* 128 frames at 48000Hz is 2.67ms; whole millisecond sleeps ran a third fast. */
+    SDL_zero(desired);
+    desired.freq = 48000;
+    desired.format = AUDIO_S16SYS;
+    desired.channels = 2;
+    desired.samples = 128;
+    desired.callback = _audio_testCallback;
+    id = SDL_OpenAudioDevice(NULL, 0, &desired, NULL, 0);
+    SDLTest_AssertCheck(id > 1, "Validate device ID; expected: >1, got: %i", id);
+    if (id > 1) {
+        SDL_LockAudioDevice(id);
+        _audio_testCallbackCounter = 0;
+        SDL_UnlockAudioDevice(id);
+        start = SDL_GetTicks();
+        SDL_PauseAudioDevice(id, 0);
+        SDL_Delay(800);
+        SDL_LockAudioDevice(id);
+        elapsed = SDL_GetTicks() - start;
+        result = _audio_testCallbackCounter;
+        SDL_UnlockAudioDevice(id);
+        expected = (int) ((elapsed * 48000) / (128 * 1000)) + 1;
+        /* a busy machine can only hold the audio thread back, so the count
+           has a lot of room below; it may never run a tenth ahead. */
+        SDLTest_AssertCheck((result >= expected / 2) && (result <= expected + (expected / 10) + 1),
+                            "Validate callback count after %u ms; expected: %d got: %d", (unsigned int) elapsed, expected, result);
+        SDL_CloseAudioDevice(id);
+        SDLTest_AssertPass("Call to SDL_CloseAudioDevice()");
+    }
+
+    /* a two second buffer: unpausing and closing don't wait it out. */
+    desired.freq = 8000;
+    desired.samples = 16384;
+    id = SDL_OpenAudioDevice(NULL, 0, &desired, NULL, 0);
+    SDLTest_AssertCheck(id > 1, "Validate device ID; expected: >1, got: %i", id);
+    if (id > 1) {
+        SDL_Delay(50);
+        SDL_LockAudioDevice(id);
+        _audio_testCallbackCounter = 0;
+        SDL_UnlockAudioDevice(id);
+        SDL_PauseAudioDevice(id, 0);
+        SDL_Delay(200);
+        SDL_LockAudioDevice(id);
+        result = _audio_testCallbackCounter;
+        SDL_UnlockAudioDevice(id);
+        SDLTest_AssertCheck(result == 1, "Validate callback fired on unpause; expected: 1 got: %d", result);
+
+        start = SDL_GetTicks();
+        SDL_CloseAudioDevice(id);
+        elapsed = SDL_GetTicks() - start;
+        SDLTest_AssertCheck(elapsed < 500, "Validate SDL_CloseAudioDevice didn't wait for the buffer; took %u ms", (unsigned int) elapsed);
+    }
+
+    SDL_AudioQuit();
+    _audioSetUp(NULL);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * \brief Check the playback position against the time it took to play.
+ *
+ * \sa https://wiki.libsdl.org/SDL_GetAudioDevicePosition
+ */
+int audio_getAudioDevicePosition()
+{
+    const Uint64 freq = SDL_GetPerformanceFrequency();
+    SDL_AudioSpec desired;
+    SDL_AudioSpec obtained;
+    SDL_AudioDeviceID id;
+    Uint64 frames, frames2;
+    Uint64 timestamp, timestamp2;
+    Uint64 start;
+    Sint64 expected;
+    int result;
+
+    SDL_AudioQuit();
+    result = SDL_AudioInit("dummy");
+    SDLTest_AssertPass("Call to SDL_AudioInit('dummy')");
+    if (result != 0) {
+        SDLTest_Log("Dummy audio driver not available, skipping.");
+        _audioSetUp(NULL);
+        return TEST_SKIPPED;
+    }
+
+    result = SDL_GetAudioDevicePosition(0, &frames, NULL);
+    SDLTest_AssertCheck(result == -1, "Validate SDL_GetAudioDevicePosition(0, ...) fails; got: %d", result);
+
+    SDL_zero(desired);
+    desired.freq = 48000;
+    desired.format = AUDIO_S16SYS;
+    desired.channels = 2;
+    desired.samples = 1024;
+    desired.callback = _audio_testCallback;
+    id = SDL_OpenAudioDevice(NULL, 0, &desired, &obtained, 0);
+    SDLTest_AssertCheck(id > 1, "Validate device ID; expected: >1, got: %i", id);
+    if (id > 1) {
+        result = SDL_GetAudioDevicePosition(id, NULL, &timestamp);
+        SDLTest_AssertCheck(result == -1, "Validate SDL_GetAudioDevicePosition(id, NULL, ...) fails; got: %d", result);
+        result = SDL_GetAudioDevicePosition(id, &frames, &timestamp);
+        SDLTest_AssertCheck(result == 0, "Validate SDL_GetAudioDevicePosition result; got: %d", result);
+
+        /* the fake stream plays in lockstep with its pacing. */
+        SDL_PauseAudioDevice(id, 0);
+        SDL_Delay(100);
+        SDL_GetAudioDevicePosition(id, &frames, &timestamp);
+        start = timestamp;
+        SDL_Delay(500);
+        result = SDL_GetAudioDevicePosition(id, &frames2, &timestamp2);
+        SDLTest_AssertCheck(result == 0, "Validate SDL_GetAudioDevicePosition result; got: %d", result);
+        SDLTest_AssertCheck(timestamp2 > start, "Validate the timestamp moved on");
+        SDLTest_AssertCheck(timestamp2 <= SDL_GetPerformanceCounter(), "Validate the timestamp isn't in the future");
+        SDLTest_AssertCheck((frames2 % 1024) == 0, "Validate a whole number of buffers played; got: %d frames", (int) frames2);
+        expected = (Sint64) (frames + (((timestamp2 - start) * 48000) / freq));
+        SDLTest_AssertCheck((((Sint64) frames2) >= expected - (expected / 10) - 1024) && (((Sint64) frames2) <= expected + (expected / 10) + 1024),
+                            "Validate frames played match the time taken; expected: %d got: %d", (int) expected, (int) frames2);
+
+        SDL_CloseAudioDevice(id);
+        SDLTest_AssertPass("Call to SDL_CloseAudioDevice()");
+    }
+
+    /* the same at a lower rate, where each buffer lasts longer. */
+    desired.freq = 22050;
+    id = SDL_OpenAudioDevice(NULL, 0, &desired, &obtained, 0);
+    SDLTest_AssertCheck(id > 1, "Validate device ID; expected: >1, got: %i", id);
+    if (id > 1) {
+        SDL_PauseAudioDevice(id, 0);
+        SDL_Delay(300);
+        SDL_GetAudioDevicePosition(id, &frames, &timestamp);
+        SDL_Delay(300);
+        SDL_GetAudioDevicePosition(id, &frames2, &timestamp2);
+        expected = (Sint64) (frames + (((timestamp2 - timestamp) * 22050) / freq));
+        SDLTest_AssertCheck((((Sint64) frames2) >= expected - (expected / 10) - 1024) && (((Sint64) frames2) <= expected + (expected / 10) + 1024),
+                            "Validate frames played at 22050Hz; expected: %d got: %d", (int) expected, (int) frames2);
+        SDL_CloseAudioDevice(id);
+        SDLTest_AssertPass("Call to SDL_CloseAudioDevice()");
+    }
+
+    SDL_AudioQuit();
+    _audioSetUp(NULL);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * \brief Schedule voices at exact frames and check where the device plays them.
+ *
+ * \sa https://wiki.libsdl.org/SDL_PlayAudioVoiceAt
+ */
+int audio_playAudioVoiceAt()
+{
+    const char *filename = "sdlaudio-schedule-test.raw";
+    const int frames = 1000;
+    SDL_AudioSpec desired;
+    SDL_AudioDeviceID id;
+    SDL_AudioVoiceID voice, late;
+    SDL_RWops *rw;
+    Sint16 *sound;
+    Sint16 *played = NULL;
+    Sint64 playedlen = 0;
+    Uint64 position = 0;
+    Uint64 start = 0;
+    Uint32 startticks;
+    int offset;
+    int result;
+    int errors = 0;
+    int i;
+
+    sound = (Sint16 *) SDL_malloc(frames * sizeof (Sint16));
+    SDLTest_AssertCheck(sound != NULL, "Validate buffer was allocated");
+    if (sound == NULL) {
+        return TEST_ABORTED;
+    }
+    for (i = 0; i < frames; i++) {
+        sound[i] = (Sint16) (((i * 7919) & 0x3FFF) + 2);
+    }
+
+    SDL_setenv("SDL_DISKAUDIODELAY", "0", 1);
+    SDL_AudioQuit();
+    result = SDL_AudioInit("disk");
+    SDLTest_AssertPass("Call to SDL_AudioInit('disk')");
+    if (result != 0) {
+        SDLTest_Log("Disk audio driver not available, skipping.");
+        SDL_free(sound);
+        _audioSetUp(NULL);
+        return TEST_SKIPPED;
+    }
+
+    SDL_zero(desired);
+    desired.freq = 44100;
+    desired.format = AUDIO_S16SYS;
+    desired.channels = 2;
+    desired.samples = 1024;
+    desired.callback = NULL;  /* the queue stays empty; only the voices play. */
+    id = SDL_OpenAudioDevice(filename, 0, &desired, NULL, 0);
+    SDLTest_AssertPass("Call to SDL_OpenAudioDevice('%s', 0, ...)", filename);
+    SDLTest_AssertCheck(id > 1, "Validate device ID; expected: >1 got: %d", (int) id);
+    if (id > 1) {
+        voice = SDL_CreateAudioVoice(id, sound, frames * sizeof (Sint16), AUDIO_S16SYS, 1, 44100);
+        late = SDL_CreateAudioVoice(id, sound, frames * sizeof (Sint16), AUDIO_S16SYS, 1, 44100);
+        SDLTest_AssertCheck((voice != 0) && (late != 0), "Validate SDL_CreateAudioVoice results");
+        result = SDL_PlayAudioVoiceAt(id, 0, 0, SDL_FALSE);
+        SDLTest_AssertCheck(result == -1, "Validate an invalid voice can't be scheduled; got: %d", result);
+
+        SDL_PauseAudioDevice(id, 0);
+        SDL_Delay(10);
+
+        /* With the device locked, the audio thread is at most a buffer
+           ahead of its position, so a couple of buffers later is still
+           to come. Start partway into a buffer. */
+        SDL_LockAudioDevice(id);
+        result = SDL_GetAudioDevicePosition(id, &position, NULL);
+        SDLTest_AssertCheck(result == 0, "Validate SDL_GetAudioDevicePosition result; got: %d", result);
+        start = position + (desired.samples * 4) + 37;
+        result = SDL_PlayAudioVoiceAt(id, voice, start, SDL_FALSE);
+        SDLTest_AssertCheck(result == 0, "Validate SDL_PlayAudioVoiceAt result; got: %d", result);
+        /* this one's whole sound is long past, so it never plays. */
+        result = SDL_PlayAudioVoiceAt(id, late, 0, SDL_FALSE);
+        SDLTest_AssertCheck(result == 0, "Validate SDL_PlayAudioVoiceAt result; got: %d", result);
+        SDLTest_AssertCheck(SDL_IsAudioVoicePlaying(id, voice), "Validate a scheduled voice counts as playing");
+        SDL_UnlockAudioDevice(id);
+
+        startticks = SDL_GetTicks();
+        while ((SDL_IsAudioVoicePlaying(id, voice) || SDL_IsAudioVoicePlaying(id, late)) &&
+               !SDL_TICKS_PASSED(SDL_GetTicks(), startticks + 5000)) {
+            SDL_Delay(10);
+        }
+        SDLTest_AssertCheck(!SDL_IsAudioVoicePlaying(id, voice) && !SDL_IsAudioVoicePlaying(id, late),
+                            "Validate the voices stopped");
+        SDL_CloseAudioDevice(id);
+        SDLTest_AssertPass("Call to SDL_CloseAudioDevice()");
+
+        rw = SDL_RWFromFile(filename, "rb");
+        SDLTest_AssertCheck(rw != NULL, "Verify the device's output file exists");
+        if (rw != NULL) {
+            playedlen = SDL_RWsize(rw);
+            played = (Sint16 *) SDL_malloc((size_t) playedlen);
+            if (played != NULL) {
+                playedlen = (Sint64) SDL_RWread(rw, played, 1, (size_t) playedlen);
+            }
+            SDL_RWclose(rw);
+        }
+
+        /* the file starts at frame 0, so the sound should start exactly
+           at (start), on both sides, and nothing else should play. */
+        if (played != NULL) {
+            const int samples = (int) (playedlen / sizeof (Sint16));
+            for (offset = 0; (offset < samples) && (played[offset] == 0); offset++) {
+                /* spin */
+            }
+            SDLTest_AssertCheck(offset == (int) (start * 2), "Validate the voice started at frame %d; got: %d",
+                                (int) start, offset / 2);
+            SDLTest_AssertCheck(samples - offset >= frames * 2, "Validate played length; expected: >=%d got: %d",
+                                frames * 2, samples - offset);
+            if ((offset == (int) (start * 2)) && (samples - offset >= frames * 2)) {
+                for (i = 0; i < frames; i++) {
+                    if ((SDL_abs(played[offset + (i * 2)] - sound[i]) > 1) || (SDL_abs(played[offset + (i * 2) + 1] - sound[i]) > 1)) {
+                        errors++;
+                    }
+                }
+                for (i = offset + (frames * 2); i < samples; i++) {
+                    if (played[i] != 0) {
+                        errors++;
+                    }
+                }
+                SDLTest_AssertCheck(errors == 0, "Validate only the scheduled voice played; %d samples differ", errors);
+            }
+        }
+    }
+
+    SDL_AudioQuit();
+    remove(filename);
+    SDL_free(sound);
+    SDL_free(played);
+
+    /* Restart audio again */
+    _audioSetUp(NULL);
+
+    return TEST_COMPLETED;
+}
+
+/* Stalls once, when the test asks, as if the app had a hiccup. */
+static SDL_atomic_t _audio_stall;
+
+static void SDLCALL _audio_stallCallback(void *userdata, Uint8 *stream, int len)
+{
+    SDL_memset(stream, 0, len);
+    if (SDL_AtomicCAS(&_audio_stall, 1, 0)) {
+        SDL_Delay(100);
+    }
+}
+
+/**
+ * \brief Check that an adaptive device grows its buffering after running dry.
+ *
+ * \sa https://wiki.libsdl.org/SDL_GetAudioDeviceLatency
+ */
+int audio_adaptiveLatency()
+{
+    SDL_AudioSpec desired;
+    SDL_AudioSpec obtained;
+    SDL_AudioDeviceStats stats;
+    SDL_AudioDeviceID id;
+    Uint32 startticks;
+    int initial = 0;
+    int latency = 0;
+    int result;
+
+    SDL_AudioQuit();
+    result = SDL_AudioInit("dummy");
+    SDLTest_AssertPass("Call to SDL_AudioInit('dummy')");
+    if (result != 0) {
+        SDLTest_Log("Dummy audio driver not available, skipping.");
+        _audioSetUp(NULL);
+        return TEST_SKIPPED;
+    }
+
+    SDL_zero(desired);
+    desired.freq = 48000;
+    desired.format = AUDIO_S16SYS;
+    desired.channels = 2;
+    desired.samples = 512;
+    desired.callback = _audio_stallCallback;
+    SDL_AtomicSet(&_audio_stall, 0);
+
+    SDL_SetHint(SDL_HINT_AUDIO_ADAPTIVE_LATENCY, "1");
+    id = SDL_OpenAudioDevice(NULL, 0, &desired, &obtained, 0);
+    SDLTest_AssertCheck(id > 1, "Validate device ID; expected: >1, got: %i", id);
+    if (id > 1) {
+        /* it starts out double buffered. */
+        initial = SDL_GetAudioDeviceLatency(id);
+        SDLTest_AssertCheck(initial == (obtained.samples * 2 * 1000000) / obtained.freq,
+                            "Validate the starting latency; expected: %d got: %d",
+                            (obtained.samples * 2 * 1000000) / obtained.freq, initial);
+
+        /* a stall much longer than what's queued has to grow it. */
+        SDL_PauseAudioDevice(id, 0);
+        SDL_Delay(100);
+        SDL_AtomicSet(&_audio_stall, 1);
+        startticks = SDL_GetTicks();
+        do {
+            SDL_Delay(10);
+            latency = SDL_GetAudioDeviceLatency(id);
+        } while ((latency <= initial) && !SDL_TICKS_PASSED(SDL_GetTicks(), startticks + 2000));
+        SDLTest_AssertCheck(latency > initial, "Validate the latency grew after running dry; was: %d got: %d", initial, latency);
+        SDLTest_AssertCheck(latency <= (int) ((((Sint64) obtained.samples) * 8 * 1000000) / obtained.freq),
+                            "Validate the latency stays within the fake stream's buffers; got: %d", latency);
+        result = SDL_GetAudioDeviceStats(id, &stats);
+        SDLTest_AssertCheck((result == 0) && (stats.xruns > 0), "Validate the underrun was counted; got: %u", (unsigned int) stats.xruns);
+
+        SDL_CloseAudioDevice(id);
+        SDLTest_AssertPass("Call to SDL_CloseAudioDevice()");
+    }
+
+    /* without the hint, it's just the one buffer. */
+    SDL_SetHint(SDL_HINT_AUDIO_ADAPTIVE_LATENCY, "0");
+    id = SDL_OpenAudioDevice(NULL, 0, &desired, &obtained, 0);
+    SDLTest_AssertCheck(id > 1, "Validate device ID; expected: >1, got: %i", id);
+    if (id > 1) {
+        latency = SDL_GetAudioDeviceLatency(id);
+        SDLTest_AssertCheck(latency == (obtained.samples * 1000000) / obtained.freq,
+                            "Validate the latency without the hint; expected: %d got: %d",
+                            (obtained.samples * 1000000) / obtained.freq, latency);
+        SDL_CloseAudioDevice(id);
+        SDLTest_AssertPass("Call to SDL_CloseAudioDevice()");
+    }
+
+    SDL_AudioQuit();
+    _audioSetUp(NULL);
+
+    return TEST_COMPLETED;
+}
+
+/* Plays a constant 0.8 in the device's format. */
+static void SDLCALL _audio_constantCallback(void *userdata, Uint8 *stream, int len)
+{
+    const SDL_AudioFormat format = *((const SDL_AudioFormat *) userdata);
+    int i;
+
+    if (format == AUDIO_F32SYS) {
+        for (i = 0; i < len / (int) sizeof (float); i++) {
+            ((float *) stream)[i] = 0.8f;
+        }
+    } else {
+        for (i = 0; i < len / (int) sizeof (Sint16); i++) {
+            ((Sint16 *) stream)[i] = (Sint16) (0.8f * 32767.0f);
+        }
+    }
+}
+
+/* Runs the constant through one effect on the disk driver and reads back
+   the first (samples) the effect changed, as float. Every channel gets the
+   same constant. Returns how many it got. */
+static int _audio_runEffect(SDL_AudioFormat format, Uint8 channels, SDL_AudioEffectType type, SDL_bool after_conversion,
+                            const float *params, int count, float *output, int samples)
+{
+    const char *filename = "sdlaudio-effect-test.raw";
+    SDL_AudioFormat callbackformat = format;
+    SDL_AudioSpec desired;
+    SDL_AudioDeviceID id;
+    SDL_AudioEffectID effect;
+    SDL_RWops *rw;
+    Uint8 *played = NULL;
+    Sint64 playedlen = 0;
+    const int samplesize = SDL_AUDIO_BITSIZE(format) / 8;
+    int got = 0;
+    int offset;
+    int result;
+
+    SDL_zero(desired);
+    desired.freq = 44100;
+    desired.format = format;
+    desired.channels = channels;
+    desired.samples = 1024;
+    desired.callback = _audio_constantCallback;
+    desired.userdata = &callbackformat;
+    id = SDL_OpenAudioDevice(filename, 0, &desired, NULL, 0);
+    SDLTest_AssertCheck(id > 1, "Validate device ID; expected: >1 got: %d", (int) id);
+    if (id <= 1) {
+        return 0;
+    }
+
+    /* locked, so the first buffer after unpausing gets the new parameters. */
+    SDL_LockAudioDevice(id);
+    effect = SDL_AddAudioEffect(id, type, after_conversion);
+    SDLTest_AssertCheck(effect != 0, "Validate SDL_AddAudioEffect result; got: %u", (unsigned int) effect);
+    result = SDL_SetAudioEffectParams(id, effect, params, count);
+    SDLTest_AssertCheck(result == 0, "Validate SDL_SetAudioEffectParams result; got: %d", result);
+    SDL_UnlockAudioDevice(id);
+
+    SDL_PauseAudioDevice(id, 0);
+    SDL_Delay(100);
+    SDL_CloseAudioDevice(id);
+
+    rw = SDL_RWFromFile(filename, "rb");
+    SDLTest_AssertCheck(rw != NULL, "Verify the device's output file exists");
+    if (rw != NULL) {
+        playedlen = SDL_RWsize(rw);
+        played = (Uint8 *) SDL_malloc((size_t) playedlen);
+        if (played != NULL) {
+            playedlen = (Sint64) SDL_RWread(rw, played, 1, (size_t) playedlen);
+        }
+        SDL_RWclose(rw);
+    }
+    remove(filename);
+
+    /* the device was paused, so it starts with silence. */
+    if (played != NULL) {
+        const int playedsamples = (int) (playedlen / samplesize);
+        for (offset = 0; offset < playedsamples; offset++) {
+            const float x = (format == AUDIO_F32SYS) ? ((float *) played)[offset] : (((Sint16 *) played)[offset] / 32768.0f);
+            if ((x != 0.0f) || (got > 0)) {
+                output[got++] = x;
+                if (got == samples) {
+                    break;
+                }
+            }
+        }
+        SDL_free(played);
+    }
+    return got;
+}
+
+/**
+ * \brief Run each kind of effect over the output and check what it did.
+ *
+ * \sa https://wiki.libsdl.org/SDL_AddAudioEffect
+ */
+int audio_audioEffects()
+{
+    const float halve[] = { 0.5f, 0.0f, 0.0f, 0.0f, 0.0f };
+    const float limit[] = { 0.5f, 10.0f };
+    const float dcblock[] = { 0.99f };
+    const float average[] = { 0.25f, 0.25f };
+    const float bad[] = { 0.5f, -1.0f };
+    const int frames = 2048;
+    SDL_AudioSpec desired;
+    SDL_AudioDeviceID id;
+    SDL_AudioEffectID effects[SDL_AUDIO_MAX_EFFECTS + 1];
+    float *output;
+    float peak;
+    Uint8 channels;
+    int result;
+    int got;
+    int i;
+
+    output = (float *) SDL_malloc(frames * 4 * sizeof (float));
+    SDLTest_AssertCheck(output != NULL, "Validate buffer was allocated");
+    if (output == NULL) {
+        return TEST_ABORTED;
+    }
+
+    SDL_setenv("SDL_DISKAUDIODELAY", "0", 1);
+    SDL_AudioQuit();
+    result = SDL_AudioInit("disk");
+    SDLTest_AssertPass("Call to SDL_AudioInit('disk')");
+    if (result != 0) {
+        SDLTest_Log("Disk audio driver not available, skipping.");
+        SDL_free(output);
+        _audioSetUp(NULL);
+        return TEST_SKIPPED;
+    }
+
+    /* a biquad with only b0 is a plain gain. */
+    got = _audio_runEffect(AUDIO_F32SYS, 1, SDL_AUDIOEFFECT_BIQUAD, SDL_FALSE, halve, SDL_arraysize(halve), output, frames);
+    SDLTest_AssertCheck((got == frames) && (SDL_fabs(output[0] - 0.4) < 0.0001) && (SDL_fabs(output[frames - 1] - 0.4) < 0.0001),
+                        "Validate the biquad; expected: 0.4 got: %f", (got > 0) ? output[0] : 0.0f);
+
+    /* the same on S16, before and after conversion. */
+    got = _audio_runEffect(AUDIO_S16SYS, 1, SDL_AUDIOEFFECT_BIQUAD, SDL_FALSE, halve, SDL_arraysize(halve), output, frames);
+    SDLTest_AssertCheck((got == frames) && (SDL_fabs(output[frames - 1] - 0.4) < 0.001),
+                        "Validate the biquad on S16; expected: 0.4 got: %f", (got > 0) ? output[frames - 1] : 0.0f);
+    got = _audio_runEffect(AUDIO_S16SYS, 1, SDL_AUDIOEFFECT_BIQUAD, SDL_TRUE, halve, SDL_arraysize(halve), output, frames);
+    SDLTest_AssertCheck((got == frames) && (SDL_fabs(output[frames - 1] - 0.4) < 0.001),
+                        "Validate the biquad after conversion; expected: 0.4 got: %f", (got > 0) ? output[frames - 1] : 0.0f);
+
+    /* the limiter catches the very first peak. */
+    got = _audio_runEffect(AUDIO_F32SYS, 1, SDL_AUDIOEFFECT_LIMITER, SDL_FALSE, limit, SDL_arraysize(limit), output, frames);
+    peak = 0.0f;
+    for (i = 0; i < got; i++) {
+        peak = SDL_max(peak, output[i]);
+    }
+    SDLTest_AssertCheck((got == frames) && (peak <= 0.5001f) && (peak >= 0.4999f),
+                        "Validate the limiter; expected: 0.5 got: %f", peak);
+
+    /* the DC blocker passes the step, then decays to nothing. */
+    got = _audio_runEffect(AUDIO_F32SYS, 1, SDL_AUDIOEFFECT_DCBLOCKER, SDL_FALSE, dcblock, SDL_arraysize(dcblock), output, frames);
+    SDLTest_AssertCheck((got == frames) && (SDL_fabs(output[0] - 0.8) < 0.0001) && (SDL_fabs(output[frames - 1]) < 0.001),
+                        "Validate the DC blocker; expected: 0.8 to 0 got: %f to %f",
+                        (got > 0) ? output[0] : 0.0f, (got > 0) ? output[got - 1] : 0.0f);
+
+    /* stereo and quad take another path with SSE2; every channel should
+       come out the same as mono. */
+    for (channels = 2; channels <= 4; channels += 2) {
+        const int samples = frames * channels;
+        got = _audio_runEffect(AUDIO_F32SYS, channels, SDL_AUDIOEFFECT_BIQUAD, SDL_FALSE, halve, SDL_arraysize(halve), output, samples);
+        SDLTest_AssertCheck((got == samples) && (SDL_fabs(output[0] - 0.4) < 0.0001) && (SDL_fabs(output[samples - 1] - 0.4) < 0.0001),
+                            "Validate the biquad with %d channels; expected: 0.4 got: %f", channels, (got > 0) ? output[0] : 0.0f);
+        got = _audio_runEffect(AUDIO_F32SYS, channels, SDL_AUDIOEFFECT_LIMITER, SDL_FALSE, limit, SDL_arraysize(limit), output, samples);
+        peak = 0.0f;
+        for (i = 0; i < got; i++) {
+            peak = SDL_max(peak, output[i]);
+        }
+        SDLTest_AssertCheck((got == samples) && (peak <= 0.5001f) && (peak >= 0.4999f),
+                            "Validate the limiter with %d channels; expected: 0.5 got: %f", channels, peak);
+        got = _audio_runEffect(AUDIO_F32SYS, channels, SDL_AUDIOEFFECT_DCBLOCKER, SDL_FALSE, dcblock, SDL_arraysize(dcblock), output, samples);
+        SDLTest_AssertCheck((got == samples) && (SDL_fabs(output[channels - 1] - 0.8) < 0.0001) && (SDL_fabs(output[samples - 1]) < 0.001),
+                            "Validate the DC blocker with %d channels; expected: 0.8 to 0 got: %f to %f", channels,
+                            (got > 0) ? output[channels - 1] : 0.0f, (got > 0) ? output[got - 1] : 0.0f);
+    }
+
+    /* a two tap average ramps up over one frame. */
+    got = _audio_runEffect(AUDIO_F32SYS, 1, SDL_AUDIOEFFECT_CONVOLUTION, SDL_FALSE, average, SDL_arraysize(average), output, frames);
+    SDLTest_AssertCheck((got == frames) && (SDL_fabs(output[0] - 0.2) < 0.0001) && (SDL_fabs(output[1] - 0.4) < 0.0001) &&
+                        (SDL_fabs(output[frames - 1] - 0.4) < 0.0001),
+                        "Validate the convolution; expected: 0.2, 0.4 got: %f, %f",
+                        (got > 1) ? output[0] : 0.0f, (got > 1) ? output[1] : 0.0f);
+
+    /* bad parameters, a full chain, and removed effects. */
+    SDL_zero(desired);
+    desired.freq = 44100;
+    desired.format = AUDIO_F32SYS;
+    desired.channels = 2;
+    desired.samples = 1024;
+    desired.callback = _audio_testCallback;
+    id = SDL_OpenAudioDevice("sdlaudio-effect-test.raw", 0, &desired, NULL, 0);
+    SDLTest_AssertCheck(id > 1, "Validate device ID; expected: >1 got: %d", (int) id);
+    if (id > 1) {
+        effects[0] = SDL_AddAudioEffect(id, SDL_AUDIOEFFECT_LIMITER, SDL_FALSE);
+        result = SDL_SetAudioEffectParams(id, effects[0], halve, SDL_arraysize(halve));
+        SDLTest_AssertCheck(result == -1, "Validate the wrong count fails; got: %d", result);
+        result = SDL_SetAudioEffectParams(id, effects[0], bad, SDL_arraysize(bad));
+        SDLTest_AssertCheck(result == -1, "Validate a negative release fails; got: %d", result);
+        result = SDL_SetAudioEffectParams(id, effects[0], limit, SDL_arraysize(limit));
+        SDLTest_AssertCheck(result == 0, "Validate good parameters work; got: %d", result);
+
+        for (i = 1; i < SDL_arraysize(effects); i++) {
+            effects[i] = SDL_AddAudioEffect(id, SDL_AUDIOEFFECT_DCBLOCKER, SDL_TRUE);
+        }
+        SDLTest_AssertCheck((effects[SDL_AUDIO_MAX_EFFECTS - 1] != 0) && (effects[SDL_AUDIO_MAX_EFFECTS] == 0),
+                            "Validate the chain holds %d effects", SDL_AUDIO_MAX_EFFECTS);
+
+        SDL_PauseAudioDevice(id, 0);
+        SDL_Delay(50);
+        SDL_RemoveAudioEffect(id, effects[0]);
+        result = SDL_SetAudioEffectParams(id, effects[0], limit, SDL_arraysize(limit));
+        SDLTest_AssertCheck(result == -1, "Validate a removed effect is gone; got: %d", result);
+        result = SDL_SetAudioEffectParams(id, effects[1], dcblock, SDL_arraysize(dcblock));
+        SDLTest_AssertCheck(result == 0, "Validate the others are still there; got: %d", result);
+        effects[0] = SDL_AddAudioEffect(id, SDL_AUDIOEFFECT_BIQUAD, SDL_FALSE);
+        SDLTest_AssertCheck(effects[0] != 0, "Validate removing made room");
+        SDL_Delay(50);
+
+        SDL_CloseAudioDevice(id);
+        SDLTest_AssertPass("Call to SDL_CloseAudioDevice()");
+        remove("sdlaudio-effect-test.raw");
+    }
+
+    SDL_AudioQuit();
+    SDL_free(output);
+
+    /* Restart audio again */
+    _audioSetUp(NULL);
+
+    return TEST_COMPLETED;
+}
+
+/* Stereo: a steady half scale on the left, full scale square wave on the right. */
+static void SDLCALL _audio_meterCallback(void *userdata, Uint8 *stream, int len)
+{
+    const SDL_AudioFormat format = *((const SDL_AudioFormat *) userdata);
+    int i;
+
+    if (format == AUDIO_F32SYS) {
+        float *out = (float *) stream;
+        for (i = 0; i < len / (int) (sizeof (float) * 2); i++) {
+            out[i * 2] = 0.5f;
+            out[(i * 2) + 1] = (i & 1) ? -1.0f : 1.0f;
+        }
+    } else if (format == AUDIO_S16SYS) {
+        Sint16 *out = (Sint16 *) stream;
+        for (i = 0; i < len / (int) (sizeof (Sint16) * 2); i++) {
+            out[i * 2] = 16384;
+            out[(i * 2) + 1] = (i & 1) ? -32768 : 32767;
+        }
+    } else {
+        Sint32 *out = (Sint32 *) stream;
+        for (i = 0; i < len / (int) (sizeof (Sint32) * 2); i++) {
+            out[i * 2] = 0x40000000;
+            out[(i * 2) + 1] = (i & 1) ? (-2147483647 - 1) : 2147483647;
+        }
+    }
+}
+
+/**
+ * \brief Meter a device's output in the formats measured different ways.
+ *
+ * \sa https://wiki.libsdl.org/SDL_GetAudioDeviceMeter
+ */
+int audio_audioMeter()
+{
+    /* the last one is metered in the effect chain's float buffer. */
+    const SDL_AudioFormat formats[] = { AUDIO_F32SYS, AUDIO_S16SYS, AUDIO_S32SYS, AUDIO_S32SYS };
+    const float identity[] = { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+    const char *filename = "sdlaudio-meter-test.raw";
+    SDL_AudioFormat format;
+    SDL_AudioSpec desired;
+    SDL_AudioMeter meter;
+    SDL_AudioDeviceID id;
+    Uint32 frames;
+    int result;
+    int i;
+
+    SDL_setenv("SDL_DISKAUDIODELAY", "0", 1);
+    SDL_AudioQuit();
+    result = SDL_AudioInit("disk");
+    SDLTest_AssertPass("Call to SDL_AudioInit('disk')");
+    if (result != 0) {
+        SDLTest_Log("Disk audio driver not available, skipping.");
+        _audioSetUp(NULL);
+        return TEST_SKIPPED;
+    }
+
+    for (i = 0; i < SDL_arraysize(formats); i++) {
+        format = formats[i];
+        SDL_zero(desired);
+        desired.freq = 44100;
+        desired.format = format;
+        desired.channels = 2;
+        desired.samples = 1024;
+        desired.callback = _audio_meterCallback;
+        desired.userdata = &format;
+        id = SDL_OpenAudioDevice(filename, 0, &desired, NULL, 0);
+        SDLTest_AssertCheck(id > 1, "Validate device ID; expected: >1 got: %d", (int) id);
+        if (id <= 1) {
+            continue;
+        }
+
+        if (i == SDL_arraysize(formats) - 1) {
+            SDL_AudioEffectID effect;
+            SDL_LockAudioDevice(id);
+            effect = SDL_AddAudioEffect(id, SDL_AUDIOEFFECT_BIQUAD, SDL_FALSE);
+            result = SDL_SetAudioEffectParams(id, effect, identity, SDL_arraysize(identity));
+            SDL_UnlockAudioDevice(id);
+            SDLTest_AssertCheck((effect != 0) && (result == 0), "Validate adding an effect before metering; got: %u, %d",
+                                (unsigned int) effect, result);
+        }
+
+        /* off until asked for. */
+        SDL_PauseAudioDevice(id, 0);
+        SDL_Delay(20);
+        result = SDL_GetAudioDeviceMeter(id, &meter, SDL_FALSE);
+        SDLTest_AssertCheck((result == 0) && (meter.frames == 0), "Validate the meter starts off; got: %u frames", (unsigned int) meter.frames);
+
+        result = SDL_SetAudioDeviceMetering(id, SDL_TRUE);
+        SDLTest_AssertCheck(result == 0, "Validate SDL_SetAudioDeviceMetering result; got: %d", result);
+        SDL_Delay(50);
+        result = SDL_GetAudioDeviceMeter(id, &meter, SDL_TRUE);
+        SDLTest_AssertCheck(result == 0, "Validate SDL_GetAudioDeviceMeter result; got: %d", result);
+        SDLTest_AssertCheck((meter.channels == 2) && (meter.frames > 0),
+                            "Validate format 0x%X was measured; got: %d channels, %u frames",
+                            (unsigned int) format, meter.channels, (unsigned int) meter.frames);
+        SDLTest_AssertCheck((SDL_fabs(meter.peak[0] - 0.5) < 0.001) && (SDL_fabs(meter.rms[0] - 0.5) < 0.001) && (meter.clips[0] == 0),
+                            "Validate the left channel; expected: 0.5, 0.5, 0 got: %f, %f, %u",
+                            meter.peak[0], meter.rms[0], (unsigned int) meter.clips[0]);
+        SDLTest_AssertCheck((SDL_fabs(meter.peak[1] - 1.0) < 0.001) && (SDL_fabs(meter.rms[1] - 1.0) < 0.001) &&
+                            (meter.clips[1] == meter.frames),
+                            "Validate the right channel; expected: 1, 1, %u got: %f, %f, %u", (unsigned int) meter.frames,
+                            meter.peak[1], meter.rms[1], (unsigned int) meter.clips[1]);
+
+        /* stopped, it holds still. */
+        result = SDL_SetAudioDeviceMetering(id, SDL_FALSE);
+        SDLTest_AssertCheck(result == 0, "Validate SDL_SetAudioDeviceMetering result; got: %d", result);
+        SDL_Delay(20);
+        SDL_GetAudioDeviceMeter(id, &meter, SDL_FALSE);
+        frames = meter.frames;
+        SDL_Delay(20);
+        SDL_GetAudioDeviceMeter(id, &meter, SDL_FALSE);
+        SDLTest_AssertCheck(meter.frames == frames, "Validate the meter stopped; expected: %u got: %u",
+                            (unsigned int) frames, (unsigned int) meter.frames);
+
+        SDL_CloseAudioDevice(id);
+        SDLTest_AssertPass("Call to SDL_CloseAudioDevice()");
+    }
+
+    result = SDL_GetAudioDeviceMeter(0, &meter, SDL_FALSE);
+    SDLTest_AssertCheck(result == -1, "Validate an invalid device fails; got: %d", result);
+
+    SDL_AudioQuit();
+    remove(filename);
+
+    /* Restart audio again */
+    _audioSetUp(NULL);
+
+    return TEST_COMPLETED;
+}
 
 /* ================= Test Case References ================== */
 
@@ -1022,11 +3585,77 @@ static const SDLTest_TestCaseReference audioTest14 =
 static const SDLTest_TestCaseReference audioTest15 =
         { (SDLTest_TestCaseFp)audio_pauseUnpauseAudio, "audio_pauseUnpauseAudio", "Pause and Unpause audio for various audio specs while testing callback.", TEST_ENABLED };
 
+static const SDLTest_TestCaseReference audioTest16 =
+        { (SDLTest_TestCaseFp)audio_convertAudioStream, "audio_convertAudioStream", "Convert audio through an audio stream in one piece and in chunks.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest17 =
+        { (SDLTest_TestCaseFp)audio_convertAudioTypesExact, "audio_convertAudioTypesExact", "Checks integer/float conversions are bit exact.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest18 =
+        { (SDLTest_TestCaseFp)audio_diskCaptureDequeue, "audio_diskCaptureDequeue", "Captures a file through the disk driver and dequeues it.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest19 =
+        { (SDLTest_TestCaseFp)audio_queueAudioCapacity, "audio_queueAudioCapacity", "Queues audio with a fixed and a growing queue.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest20 =
+        { (SDLTest_TestCaseFp)audio_queueAudioFormat, "audio_queueAudioFormat", "Queues audio in different formats and checks the converted output.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest21 =
+        { (SDLTest_TestCaseFp)audio_mixerVoices, "audio_mixerVoices", "Plays voices through the built-in mixer and checks the output.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest22 =
+        { (SDLTest_TestCaseFp)audio_getAudioDeviceStats, "audio_getAudioDeviceStats", "Checks the performance counters of an open device.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest23 =
+        { (SDLTest_TestCaseFp)audio_diskRenderWav, "audio_diskRenderWav", "Renders a .wav file through the disk driver faster than realtime.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest24 =
+        { (SDLTest_TestCaseFp)audio_streamWAV, "audio_streamWAV", "Streams PCM and ADPCM WAVE files and seeks in them.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest25 =
+        { (SDLTest_TestCaseFp)audio_loadWAVMultichannel, "audio_loadWAVMultichannel", "Decodes multichannel ADPCM on several threads.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest26 =
+        { (SDLTest_TestCaseFp)audio_remixChannels, "audio_remixChannels", "Checks standard and custom channel remixing.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest28 =
+        { (SDLTest_TestCaseFp)audio_convertAudioPlan, "audio_convertAudioPlan", "Checks the order of remixing and resampling in a conversion.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest27 =
+        { (SDLTest_TestCaseFp)audio_fakeStreamPacing, "audio_fakeStreamPacing", "Checks callback timing and wakeups without a device to block on.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest29 =
+        { (SDLTest_TestCaseFp)audio_getAudioDevicePosition, "audio_getAudioDevicePosition", "Checks the playback position of an open device.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest30 =
+        { (SDLTest_TestCaseFp)audio_playAudioVoiceAt, "audio_playAudioVoiceAt", "Schedules voices at exact frames and checks the output.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest31 =
+        { (SDLTest_TestCaseFp)audio_adaptiveLatency, "audio_adaptiveLatency", "Checks an adaptive device grows its buffering after running dry.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest32 =
+        { (SDLTest_TestCaseFp)audio_audioEffects, "audio_audioEffects", "Runs each kind of effect over a device's output and checks it.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest33 =
+        { (SDLTest_TestCaseFp)audio_audioMeter, "audio_audioMeter", "Meters a device's output in several formats.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest34 =
+        { (SDLTest_TestCaseFp)audio_convertFusedExact, "audio_convertFusedExact", "Checks fused converters match the separate conversion, remix and resampling.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest35 =
+        { (SDLTest_TestCaseFp)audio_loadWAVDecodeSplit, "audio_loadWAVDecodeSplit", "Decodes ADPCM on thread counts that don't divide the blocks.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest36 =
+        { (SDLTest_TestCaseFp)audio_convertCopiedCVT, "audio_convertCopiedCVT", "Checks a conversion keeps its state out of the filter list and works when copied.", TEST_ENABLED };
+
 /* Sequence of Audio test cases */
 static const SDLTest_TestCaseReference *audioTests[] =  {
     &audioTest1, &audioTest2, &audioTest3, &audioTest4, &audioTest5, &audioTest6,
     &audioTest7, &audioTest8, &audioTest9, &audioTest10, &audioTest11,
-    &audioTest12, &audioTest13, &audioTest14, &audioTest15, NULL
+    &audioTest12, &audioTest13, &audioTest14, &audioTest15, &audioTest16, &audioTest17,
+    &audioTest18, &audioTest19, &audioTest20, &audioTest21,
+    &audioTest22, &audioTest23, &audioTest24, &audioTest25, &audioTest26,
+    &audioTest27, &audioTest28, &audioTest29, &audioTest30, &audioTest31, &audioTest32, &audioTest33, &audioTest34, &audioTest35, &audioTest36, NULL
 };
 
 /* Audio test suite (global) */
@@ -0,0 +1,258 @@
+/*
+  Copyright (C) 1997-2016 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Times SDL_ConvertAudio() on large buffers of noise for every pair of
+   sample formats, across a set of channel count and sample rate pairs
+   that covers each kind of filter chain SDL_BuildAudioCVT() can build.
+   Prints throughput in megabytes of input per second and nanoseconds per
+   input frame, best of several runs, as a table or as CSV (--csv).
+
+   --features MASK sets SDL_AUDIO_CPU_FEATURES before the first conversion,
+   so "--features 0" times the scalar code. The CSV has a column for the
+   mask, so runs with and without it can be concatenated and compared. */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "SDL.h"
+
+static const struct
+{
+    SDL_AudioFormat format;
+    const char *name;
+} formats[] = {
+    { AUDIO_U8, "U8" },
+    { AUDIO_S8, "S8" },
+    { AUDIO_U16LSB, "U16LSB" },
+    { AUDIO_U16MSB, "U16MSB" },
+    { AUDIO_S16LSB, "S16LSB" },
+    { AUDIO_S16MSB, "S16MSB" },
+    { AUDIO_S32LSB, "S32LSB" },
+    { AUDIO_S32MSB, "S32MSB" },
+    { AUDIO_F32LSB, "F32LSB" },
+    { AUDIO_F32MSB, "F32MSB" }
+};
+
+/* same channels, down- and upmixing, and the surround layouts. */
+static const struct
+{
+    int src_channels;
+    int dst_channels;
+} channels[] = {
+    { 1, 1 },
+    { 2, 2 },
+    { 6, 6 },
+    { 1, 2 },
+    { 2, 1 },
+    { 2, 6 },
+    { 6, 2 },
+    { 8, 2 }
+};
+
+/* no resampling, the common 44.1k <-> 48k pair, and an integer ratio. */
+static const struct
+{
+    int src_rate;
+    int dst_rate;
+} rates[] = {
+    { 48000, 48000 },
+    { 44100, 48000 },
+    { 48000, 44100 },
+    { 22050, 44100 }
+};
+
+static SDL_bool csv = SDL_FALSE;
+static const char *features = NULL;  /* the --features mask, if any. */
+
+/* (noise) is (frames) of 8 channel float audio; this converts the first
+   (src_channels) worth of it to (src_fmt) in (input). */
+static int
+make_input(Uint8 **input, SDL_AudioFormat src_fmt, const int src_channels,
+           const float *noise, const int frames)
+{
+    SDL_AudioCVT cvt;
+    float *dst;
+    int i, j;
+
+    if (SDL_BuildAudioCVT(&cvt, AUDIO_F32SYS, src_channels, 48000, src_fmt, src_channels, 48000) < 0) {
+        return -1;
+    }
+    cvt.len = frames * src_channels * sizeof (float);
+    dst = (float *) SDL_realloc(*input, cvt.len * cvt.len_mult);
+    if (!dst) {
+        return SDL_OutOfMemory();
+    }
+    *input = (Uint8 *) dst;
+
+    for (i = 0; i < frames; i++) {
+        for (j = 0; j < src_channels; j++) {
+            dst[(i * src_channels) + j] = noise[(i * 8) + j];
+        }
+    }
+
+    cvt.buf = *input;
+    return SDL_ConvertAudio(&cvt);
+}
+
+static int
+bench(const int src_index, const int dst_index, const int src_channels, const int dst_channels,
+      const int src_rate, const int dst_rate, const Uint8 *input, const int frames,
+      Uint8 **work, int *worklen, const int iterations)
+{
+    const SDL_AudioFormat src_fmt = formats[src_index].format;
+    const SDL_AudioFormat dst_fmt = formats[dst_index].format;
+    const int len = frames * src_channels * (SDL_AUDIO_BITSIZE(src_fmt) / 8);
+    const double freq = (double) SDL_GetPerformanceFrequency();
+    Uint64 best = 0;
+    SDL_AudioCVT cvt;
+    double seconds;
+    int i;
+
+    if (SDL_BuildAudioCVT(&cvt, src_fmt, src_channels, src_rate, dst_fmt, dst_channels, dst_rate) < 0) {
+        return -1;
+    }
+
+    cvt.len = len;
+    if (*worklen < (len * cvt.len_mult)) {
+        Uint8 *ptr = (Uint8 *) SDL_realloc(*work, len * cvt.len_mult);
+        if (!ptr) {
+            return SDL_OutOfMemory();
+        }
+        *work = ptr;
+        *worklen = len * cvt.len_mult;
+    }
+    cvt.buf = *work;
+
+    /* conversion happens in place, so restore the input before each run. */
+    for (i = 0; i < iterations; i++) {
+        Uint64 start, elapsed;
+
+        SDL_memcpy(cvt.buf, input, len);
+        start = SDL_GetPerformanceCounter();
+        if (SDL_ConvertAudio(&cvt) < 0) {
+            return -1;
+        }
+        elapsed = SDL_GetPerformanceCounter() - start;
+        if ((i == 0) || (elapsed < best)) {
+            best = elapsed;
+        }
+    }
+
+    seconds = SDL_max(best, 1) / freq;
+    if (csv) {
+        /* plain stdout, without SDL_Log's prefix, so it can be piped. */
+        printf("%s,%s,%d,%d,%d,%d,%s,%d,%.1f,%.3f\n",
+               formats[src_index].name, formats[dst_index].name,
+               src_channels, dst_channels, src_rate, dst_rate,
+               features ? features : "auto", cvt.filter_index,
+               (len / seconds) / (1024.0 * 1024.0),
+               (seconds * 1000000000.0) / frames);
+    } else {
+        SDL_Log("%-6s %d ch %5d Hz -> %-6s %d ch %5d Hz  %d passes  %9.1f MB/s  %8.3f ns/frame\n",
+                formats[src_index].name, src_channels, src_rate,
+                formats[dst_index].name, dst_channels, dst_rate, cvt.filter_index,
+                (len / seconds) / (1024.0 * 1024.0),
+                (seconds * 1000000000.0) / frames);
+    }
+    return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+    int frames = 256 * 1024;
+    int iterations = 5;
+    float *noise = NULL;
+    Uint8 *input = NULL;
+    Uint8 *work = NULL;
+    int worklen = 0;
+    int retval = 0;
+    int i, s, d, c, r;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    for (i = 1; i < argc; i++) {
+        if (SDL_strcmp(argv[i], "--csv") == 0) {
+            csv = SDL_TRUE;
+        } else if ((SDL_strcmp(argv[i], "--frames") == 0) && (i + 1 < argc)) {
+            frames = SDL_atoi(argv[++i]);
+        } else if ((SDL_strcmp(argv[i], "--iterations") == 0) && (i + 1 < argc)) {
+            iterations = SDL_atoi(argv[++i]);
+        } else if ((SDL_strcmp(argv[i], "--features") == 0) && (i + 1 < argc)) {
+            /* SDL reads this once, the first time it converts anything. */
+            features = argv[++i];
+            SDL_setenv("SDL_AUDIO_CPU_FEATURES", features, 1);
+        } else {
+            frames = 0;
+            break;
+        }
+    }
+    if ((frames <= 0) || (iterations <= 0)) {
+        SDL_Log("USAGE: %s [--csv] [--frames N] [--iterations N] [--features MASK]\n", argv[0]);
+        return 1;
+    }
+
+    if (SDL_Init(0) == -1) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_Init() failed: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    /* white noise at half scale, so nothing clips or converts trivially. */
+    noise = (float *) SDL_malloc(frames * 8 * sizeof (float));
+    if (!noise) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory!\n");
+        SDL_Quit();
+        return 1;
+    }
+    srand(0);
+    for (i = 0; i < frames * 8; i++) {
+        noise[i] = (((float) rand()) / ((float) RAND_MAX)) - 0.5f;
+    }
+
+    if (csv) {
+        printf("src_format,dst_format,src_channels,dst_channels,src_rate,dst_rate,cpu_features,passes,mb_per_sec,ns_per_frame\n");
+    } else {
+        SDL_Log("Converting %d frames, best of %d runs, SSE2 %s%s\n", frames, iterations,
+                SDL_HasSSE2() ? "available" : "not available",
+                features ? " (overridden by --features)" : "");
+    }
+
+    for (s = 0; (s < SDL_arraysize(formats)) && !retval; s++) {
+        for (c = 0; (c < SDL_arraysize(channels)) && !retval; c++) {
+            if (make_input(&input, formats[s].format, channels[c].src_channels, noise, frames) < 0) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't make input: %s\n", SDL_GetError());
+                retval = 1;
+                break;
+            }
+            for (d = 0; (d < SDL_arraysize(formats)) && !retval; d++) {
+                for (r = 0; r < SDL_arraysize(rates); r++) {
+                    if (bench(s, d, channels[c].src_channels, channels[c].dst_channels,
+                              rates[r].src_rate, rates[r].dst_rate, input, frames,
+                              &work, &worklen, iterations) < 0) {
+                        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Conversion failed: %s\n", SDL_GetError());
+                        retval = 1;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    SDL_free(noise);
+    SDL_free(input);
+    SDL_free(work);
+    SDL_Quit();
+    return retval;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,203 @@
+/*
+  Copyright (C) 1997-2016 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Times SDL_MixAudioFormat() on large buffers against a plain C mixer that
+   does the same arithmetic one sample at a time (like SDL's portable
+   code), and checks that both produce the same output. Setting the
+   environment variable SDL_AUDIO_CPU_FEATURES=0 makes SDL itself use its
+   scalar code, too. Float output is allowed to differ in the last bit,
+   since builds using x87 math (-mfpmath=387) round the scalar code's
+   intermediate results differently. */
+
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#define SAMPLES (4 * 1024 * 1024)
+#define ITERATIONS 8
+
+static void
+mix_reference(Uint8 *dst, const Uint8 *src, SDL_AudioFormat format, Uint32 len, int volume)
+{
+    Uint32 i;
+
+    switch (format) {
+    case AUDIO_S8:
+        for (i = 0; i < len; i++) {
+            const int sample = ((Sint8 *) dst)[i] + ((((Sint8 *) src)[i] * volume) / SDL_MIX_MAXVOLUME);
+            ((Sint8 *) dst)[i] = (Sint8) SDL_max(-128, SDL_min(127, sample));
+        }
+        break;
+
+    case AUDIO_S16SYS:
+        for (i = 0; i < len / 2; i++) {
+            const int sample = ((Sint16 *) dst)[i] + ((((Sint16 *) src)[i] * volume) / SDL_MIX_MAXVOLUME);
+            ((Sint16 *) dst)[i] = (Sint16) SDL_max(-32768, SDL_min(32767, sample));
+        }
+        break;
+
+    case AUDIO_S32SYS:
+        for (i = 0; i < len / 4; i++) {
+            Sint64 sample = ((Sint32 *) dst)[i] + ((((Sint64) ((Sint32 *) src)[i]) * volume) / SDL_MIX_MAXVOLUME);
+            if (sample > 2147483647) {
+                sample = 2147483647;
+            } else if (sample < (-2147483647 - 1)) {
+                sample = (-2147483647 - 1);
+            }
+            ((Sint32 *) dst)[i] = (Sint32) sample;
+        }
+        break;
+
+    case AUDIO_F32SYS:
+        for (i = 0; i < len / 4; i++) {
+            const float s = (((float *) src)[i] * ((float) volume)) * (1.0f / ((float) SDL_MIX_MAXVOLUME));
+            double sample = ((double) s) + ((double) ((float *) dst)[i]);
+            if (sample > 3.402823466e+38F) {
+                sample = 3.402823466e+38F;
+            } else if (sample < -3.402823466e+38F) {
+                sample = -3.402823466e+38F;
+            }
+            ((float *) dst)[i] = (float) sample;
+        }
+        break;
+    }
+}
+
+static void
+fill_random(Uint8 *buf, SDL_AudioFormat format, const int samples)
+{
+    int i;
+
+    if (format == AUDIO_F32SYS) {
+        for (i = 0; i < samples; i++) {
+            ((float *) buf)[i] = ((((float) rand()) / ((float) RAND_MAX)) * 2.0f) - 1.0f;
+        }
+    } else {
+        const int bytes = samples * (SDL_AUDIO_BITSIZE(format) / 8);
+        for (i = 0; i < bytes; i++) {
+            buf[i] = (Uint8) rand();
+        }
+    }
+}
+
+static SDL_bool
+outputs_match(const Uint8 *a, const Uint8 *b, SDL_AudioFormat format, Uint32 len)
+{
+    Uint32 i;
+
+    if (format != AUDIO_F32SYS) {
+        return (SDL_memcmp(a, b, len) == 0) ? SDL_TRUE : SDL_FALSE;
+    }
+
+    for (i = 0; i < len / 4; i++) {
+        const float fa = ((const float *) a)[i];
+        const float fb = ((const float *) b)[i];
+        if (SDL_fabs(fa - fb) > ((SDL_fabs(fb) + 1.0) * 1.0e-6)) {
+            return SDL_FALSE;
+        }
+    }
+    return SDL_TRUE;
+}
+
+static int
+bench(SDL_AudioFormat format, const char *name, int volume,
+      Uint8 *src, Uint8 *dst, Uint8 *refdst, Uint8 *orig)
+{
+    const Uint32 len = SAMPLES * (SDL_AUDIO_BITSIZE(format) / 8);
+    const double freq = (double) SDL_GetPerformanceFrequency();
+    Uint64 start, sdl_time = 0, ref_time = 0;
+    SDL_bool match;
+    int i;
+
+    fill_random(src, format, SAMPLES);
+    fill_random(orig, format, SAMPLES);
+    SDL_memcpy(dst, orig, len);
+    SDL_memcpy(refdst, orig, len);
+
+    /* mixing the same source repeatedly saturates, which exercises clamping. */
+    for (i = 0; i < ITERATIONS; i++) {
+        start = SDL_GetPerformanceCounter();
+        SDL_MixAudioFormat(dst, src, format, len, volume);
+        sdl_time += SDL_GetPerformanceCounter() - start;
+
+        start = SDL_GetPerformanceCounter();
+        mix_reference(refdst, src, format, len, volume);
+        ref_time += SDL_GetPerformanceCounter() - start;
+    }
+
+    match = outputs_match(dst, refdst, format, len);
+    SDL_Log("%-4s volume %3d:  SDL %8.1f Msamples/sec,  scalar %8.1f Msamples/sec,  %5.2fx  %s\n",
+            name, volume,
+            (((double) SAMPLES) * ITERATIONS) / (sdl_time / freq) / 1000000.0,
+            (((double) SAMPLES) * ITERATIONS) / (ref_time / freq) / 1000000.0,
+            ((double) ref_time) / ((double) sdl_time),
+            match ? "(output matches)" : "(OUTPUT DIFFERS!)");
+
+    return match ? 0 : -1;
+}
+
+int
+main(int argc, char **argv)
+{
+    static const struct
+    {
+        SDL_AudioFormat format;
+        const char *name;
+    } formats[] = {
+        { AUDIO_S8, "S8" },
+        { AUDIO_S16SYS, "S16" },
+        { AUDIO_S32SYS, "S32" },
+        { AUDIO_F32SYS, "F32" }
+    };
+    static const int volumes[] = { SDL_MIX_MAXVOLUME, 127, 77, 1 };
+    const size_t buflen = SAMPLES * sizeof (Sint32);
+    Uint8 *src, *dst, *refdst, *orig;
+    int retval = 0;
+    int i, j;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (SDL_Init(0) == -1) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_Init() failed: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    src = (Uint8 *) SDL_malloc(buflen);
+    dst = (Uint8 *) SDL_malloc(buflen);
+    refdst = (Uint8 *) SDL_malloc(buflen);
+    orig = (Uint8 *) SDL_malloc(buflen);
+    if (!src || !dst || !refdst || !orig) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory!\n");
+        retval = 1;
+    } else {
+        SDL_Log("Mixing %d samples, %d times per test, SSE2 %s\n", SAMPLES, ITERATIONS,
+                SDL_HasSSE2() ? "available" : "not available");
+        srand(0);
+        for (i = 0; i < SDL_arraysize(formats); i++) {
+            for (j = 0; j < SDL_arraysize(volumes); j++) {
+                if (bench(formats[i].format, formats[i].name, volumes[j], src, dst, refdst, orig) < 0) {
+                    retval = 1;
+                }
+            }
+        }
+    }
+
+    SDL_free(src);
+    SDL_free(dst);
+    SDL_free(refdst);
+    SDL_free(orig);
+    SDL_Quit();
+    return retval;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,145 @@
+/*
+  Copyright (C) 1997-2016 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Measures resampler throughput, in sample frames per second, at each
+   quality level of SDL_HINT_AUDIO_RESAMPLING_MODE. Set the environment
+   variable SDL_AUDIO_CPU_FEATURES=0 to time the scalar code instead of
+   the SIMD paths. */
+
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#define CHUNK_FRAMES 1024
+
+static const char *qualities[] = { "low", "medium", "high" };
+
+static const struct
+{
+    int src_rate;
+    int dst_rate;
+} rates[] = {
+    { 44100, 48000 },
+    { 48000, 44100 },
+    { 22050, 48000 },
+    { 96000, 44100 },
+    { 44100, 48001 }
+};
+
+static int
+bench(const char *quality, const int src_rate, const int dst_rate,
+      const int channels, const float *input, const int frames, void *output)
+{
+    const int framelen = channels * sizeof (float);
+    SDL_AudioStream *stream;
+    Uint64 start, elapsed;
+    int i;
+
+    SDL_SetHint(SDL_HINT_AUDIO_RESAMPLING_MODE, quality);
+    stream = SDL_NewAudioStream(AUDIO_F32SYS, channels, src_rate, AUDIO_F32SYS, channels, dst_rate);
+    if (stream == NULL) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_NewAudioStream failed: %s\n", SDL_GetError());
+        return -1;
+    }
+
+    /* feed it the way an app would, a chunk at a time, draining as we go. */
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < frames; i += CHUNK_FRAMES) {
+        const int len = ((frames - i) < CHUNK_FRAMES) ? (frames - i) : CHUNK_FRAMES;
+        SDL_AudioStreamPut(stream, input + (i * channels), len * framelen);
+        SDL_AudioStreamGet(stream, output, SDL_AudioStreamAvailable(stream));
+    }
+    SDL_AudioStreamFlush(stream);
+    SDL_AudioStreamGet(stream, output, SDL_AudioStreamAvailable(stream));
+    elapsed = SDL_GetPerformanceCounter() - start;
+
+    SDL_FreeAudioStream(stream);
+
+    SDL_Log("%-6s  %6d -> %6d Hz  %d ch  %12.0f frames/sec  (%6.1fx realtime)\n",
+            quality, src_rate, dst_rate, channels,
+            ((double) frames) * SDL_GetPerformanceFrequency() / elapsed,
+            (((double) frames) / src_rate) * SDL_GetPerformanceFrequency() / elapsed);
+    return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+    int seconds = 10;
+    int channels = 2;
+    int maxrate = 0;
+    int frames;
+    float *input;
+    void *output;
+    int i, q;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 1) {
+        seconds = SDL_atoi(argv[1]);
+    }
+    if (argc > 2) {
+        channels = SDL_atoi(argv[2]);
+    }
+    if ((argc > 3) || (seconds <= 0) || (channels <= 0) || (channels > 8)) {
+        SDL_Log("USAGE: %s [seconds] [channels]\n", argv[0]);
+        return 1;
+    }
+
+    if (SDL_Init(0) == -1) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_Init() failed: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    for (i = 0; i < SDL_arraysize(rates); i++) {
+        maxrate = SDL_max(maxrate, rates[i].src_rate);
+    }
+
+    /* white noise, so nothing is conveniently cheap to filter. */
+    frames = seconds * maxrate;
+    input = (float *) SDL_malloc(frames * channels * sizeof (float));
+    output = SDL_malloc(CHUNK_FRAMES * 16 * channels * sizeof (float));
+    if (!input || !output) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory!\n");
+        SDL_free(input);
+        SDL_free(output);
+        SDL_Quit();
+        return 1;
+    }
+    srand(0);
+    for (i = 0; i < frames * channels; i++) {
+        input[i] = (((float) rand()) / ((float) RAND_MAX)) - 0.5f;
+    }
+
+    SDL_Log("Resampling %d seconds of %d channel float audio, SSE2 %s\n",
+            seconds, channels, SDL_HasSSE2() ? "available" : "not available");
+
+    for (q = 0; q < SDL_arraysize(qualities); q++) {
+        for (i = 0; i < SDL_arraysize(rates); i++) {
+            if (bench(qualities[q], rates[i].src_rate, rates[i].dst_rate, channels,
+                      input, seconds * rates[i].src_rate, output) < 0) {
+                SDL_free(input);
+                SDL_free(output);
+                SDL_Quit();
+                return 1;
+            }
+        }
+    }
+
+    SDL_free(input);
+    SDL_free(output);
+    SDL_Quit();
+    return 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,313 @@
+/*
+  Copyright (C) 1997-2016 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Times SDL_LoadWAV_RW() decoding MS ADPCM and IMA ADPCM files held in
+   memory, on one thread and on one thread per CPU, against a plain
+   decoder that works one nibble at a time through function calls (like
+   SDL's decoders used to), and checks that all of them produce the same
+   samples. */
+
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#define MS_ADPCM_CODE   0x0002
+#define IMA_ADPCM_CODE  0x0011
+
+static const Sint16 ms_coeffs[7][2] = {
+    { 256, 0 }, { 512, -256 }, { 0, 0 }, { 192, 64 },
+    { 240, 0 }, { 460, -208 }, { 392, -232 }
+};
+
+typedef struct
+{
+    Uint16 delta;
+    Sint16 samp1;
+    Sint16 samp2;
+    const Sint16 *coeff;
+} ms_state;
+
+static Sint16
+ms_nibble(ms_state *state, Uint8 nybble)
+{
+    const Sint32 adaptive[] = {
+        230, 230, 230, 230, 307, 409, 512, 614,
+        768, 614, 512, 409, 307, 230, 230, 230
+    };
+    Sint32 sample = ((state->samp1 * state->coeff[0]) + (state->samp2 * state->coeff[1])) / 256;
+    Sint32 delta;
+
+    sample += state->delta * ((nybble & 0x08) ? (nybble - 0x10) : nybble);
+    sample = SDL_max(-32768, SDL_min(32767, sample));
+    delta = ((Sint32) state->delta * adaptive[nybble]) / 256;
+    state->delta = (Uint16) SDL_max(16, delta);
+    state->samp2 = state->samp1;
+    state->samp1 = (Sint16) sample;
+    return (Sint16) sample;
+}
+
+typedef struct
+{
+    Sint32 sample;
+    int index;
+} ima_state;
+
+static Sint16
+ima_nibble(ima_state *state, Uint8 nybble)
+{
+    const int index_table[16] = {
+        -1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8
+    };
+    const Sint32 step_table[89] = {
+        7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31,
+        34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130,
+        143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408,
+        449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282,
+        1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+        3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630,
+        9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350,
+        22385, 24623, 27086, 29794, 32767
+    };
+    Sint32 step, delta;
+
+    state->index = SDL_max(0, SDL_min(88, state->index));
+    step = step_table[state->index];
+    delta = step >> 3;
+    if (nybble & 0x04)
+        delta += step;
+    if (nybble & 0x02)
+        delta += (step >> 1);
+    if (nybble & 0x01)
+        delta += (step >> 2);
+    if (nybble & 0x08)
+        delta = -delta;
+    state->sample = SDL_max(-32768, SDL_min(32767, state->sample + delta));
+    state->index += index_table[nybble];
+    return (Sint16) state->sample;
+}
+
+/* Decodes a data chunk of (blocks) blocks into native-endian samples. */
+static void
+decode_reference(Uint16 encoding, int channels, int blockalign, int spb,
+                 const Uint8 *encoded, int blocks, Sint16 *decoded)
+{
+    ms_state ms[8];
+    ima_state ima[8];
+    int b, c, i, k;
+
+    for (b = 0; b < blocks; b++, encoded += blockalign) {
+        const Uint8 *in = encoded;
+        Sint16 *out = decoded + (b * spb * channels);
+        if (encoding == MS_ADPCM_CODE) {
+            for (c = 0; c < channels; c++) {
+                ms[c].coeff = ms_coeffs[in[c]];
+                ms[c].delta = (Uint16) (in[channels + (c * 2)] | (in[channels + (c * 2) + 1] << 8));
+                ms[c].samp1 = (Sint16) (in[(channels * 3) + (c * 2)] | (in[(channels * 3) + (c * 2) + 1] << 8));
+                ms[c].samp2 = (Sint16) (in[(channels * 5) + (c * 2)] | (in[(channels * 5) + (c * 2) + 1] << 8));
+                out[c] = ms[c].samp2;
+                out[channels + c] = ms[c].samp1;
+            }
+            in += channels * 7;
+            out += channels * 2;
+            for (k = 0; k < (spb - 2) * channels; k++) {
+                const Uint8 nybble = (k & 1) ? (in[k / 2] & 0x0F) : (in[k / 2] >> 4);
+                out[k] = ms_nibble(&ms[k % channels], nybble);
+            }
+        } else {
+            for (c = 0; c < channels; c++) {
+                ima[c].sample = (Sint16) (in[0] | (in[1] << 8));
+                ima[c].index = (Sint8) in[2];
+                out[c] = (Sint16) ima[c].sample;
+                in += 4;
+            }
+            out += channels;
+            for (k = 0; k < (spb - 1) / 8; k++) {
+                for (c = 0; c < channels; c++) {
+                    for (i = 0; i < 8; i++) {
+                        const Uint8 nybble = (i & 1) ? (in[i / 2] >> 4) : (in[i / 2] & 0x0F);
+                        out[(((k * 8) + i) * channels) + c] = ima_nibble(&ima[c], nybble);
+                    }
+                    in += 4;
+                }
+            }
+        }
+    }
+}
+
+/* Random blocks, with headers a real encoder could have written. */
+static Uint8 *
+make_wav(Uint16 encoding, int channels, int blockalign, int spb, int blocks, Uint32 *wavlen)
+{
+    const int fmtlen = (encoding == MS_ADPCM_CODE) ? 50 : 20;
+    const Uint32 datalen = blocks * blockalign;
+    Uint8 *wav = (Uint8 *) SDL_malloc(datalen + 128);
+    SDL_RWops *rw;
+    Uint8 *data;
+    int b, c;
+
+    if (wav == NULL) {
+        return NULL;
+    }
+    rw = SDL_RWFromMem(wav, datalen + 128);
+    SDL_RWwrite(rw, "RIFF", 4, 1);
+    SDL_WriteLE32(rw, 4 + (8 + fmtlen) + (8 + datalen));
+    SDL_RWwrite(rw, "WAVEfmt ", 8, 1);
+    SDL_WriteLE32(rw, fmtlen);
+    SDL_WriteLE16(rw, encoding);
+    SDL_WriteLE16(rw, channels);
+    SDL_WriteLE32(rw, 44100);
+    SDL_WriteLE32(rw, (44100 / spb) * blockalign);
+    SDL_WriteLE16(rw, blockalign);
+    SDL_WriteLE16(rw, 4);
+    SDL_WriteLE16(rw, fmtlen - 18);
+    SDL_WriteLE16(rw, spb);
+    if (encoding == MS_ADPCM_CODE) {
+        SDL_WriteLE16(rw, 7);
+        for (c = 0; c < 7; c++) {
+            SDL_WriteLE16(rw, (Uint16) ms_coeffs[c][0]);
+            SDL_WriteLE16(rw, (Uint16) ms_coeffs[c][1]);
+        }
+    }
+    SDL_RWwrite(rw, "data", 4, 1);
+    SDL_WriteLE32(rw, datalen);
+    *wavlen = (Uint32) SDL_RWtell(rw) + datalen;
+    SDL_RWclose(rw);
+
+    data = wav + (*wavlen - datalen);
+    for (b = 0; b < (int) datalen; b++) {
+        data[b] = (Uint8) rand();
+    }
+    for (b = 0; b < blocks; b++, data += blockalign) {
+        for (c = 0; c < channels; c++) {
+            if (encoding == MS_ADPCM_CODE) {
+                data[c] = (Uint8) (data[c] % 7);
+                data[channels + (c * 2) + 1] &= 0x07;
+            } else {
+                data[(c * 4) + 2] = (Uint8) (data[(c * 4) + 2] % 89);
+                data[(c * 4) + 3] = 0;
+            }
+        }
+    }
+    return wav;
+}
+
+static double
+time_load(const Uint8 *wav, Uint32 wavlen, const char *threads, Uint8 **pcm, Uint32 *pcmlen)
+{
+    SDL_AudioSpec spec;
+    Uint64 start;
+
+    SDL_SetHint(SDL_HINT_WAVE_DECODE_THREADS, threads);
+    start = SDL_GetPerformanceCounter();
+    if (SDL_LoadWAV_RW(SDL_RWFromConstMem(wav, wavlen), 1, &spec, pcm, pcmlen) == NULL) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_LoadWAV_RW failed: %s\n", SDL_GetError());
+        *pcm = NULL;
+        return 0.0;
+    }
+    return ((double) (SDL_GetPerformanceCounter() - start)) / SDL_GetPerformanceFrequency();
+}
+
+static int
+bench(const char *name, Uint16 encoding, int channels, int blockalign, int spb, int seconds)
+{
+    const int blocks = (seconds * 44100) / spb;
+    const double samples = ((double) blocks) * spb * channels;
+    Uint32 wavlen, onelen = 0, manylen = 0, i;
+    Uint8 *wav, *one = NULL, *many = NULL;
+    Sint16 *ref;
+    double ref_time, one_time, many_time;
+    Uint64 start;
+    SDL_bool match;
+
+    wav = make_wav(encoding, channels, blockalign, spb, blocks, &wavlen);
+    ref = (Sint16 *) SDL_malloc(blocks * spb * channels * sizeof (Sint16));
+    if (!wav || !ref) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory!\n");
+        SDL_free(wav);
+        SDL_free(ref);
+        return -1;
+    }
+
+    start = SDL_GetPerformanceCounter();
+    decode_reference(encoding, channels, blockalign, spb, wav + (wavlen - (blocks * blockalign)), blocks, ref);
+    ref_time = ((double) (SDL_GetPerformanceCounter() - start)) / SDL_GetPerformanceFrequency();
+    one_time = time_load(wav, wavlen, "1", &one, &onelen);
+    many_time = time_load(wav, wavlen, "0", &many, &manylen);
+
+    match = (one && many && (onelen == blocks * spb * channels * sizeof (Sint16)) && (manylen == onelen)) ? SDL_TRUE : SDL_FALSE;
+    for (i = 0; match && (i < onelen / 2); i++) {
+        const Sint16 a = (Sint16) SDL_SwapLE16(((Sint16 *) one)[i]);
+        const Sint16 b = (Sint16) SDL_SwapLE16(((Sint16 *) many)[i]);
+        if ((a != ref[i]) || (b != ref[i])) {
+            match = SDL_FALSE;
+        }
+    }
+
+    SDL_Log("%-4s %d ch:  reference %7.1f  SDL %7.1f  SDL threaded %7.1f Msamples/sec  (%5.2fx, %5.2fx)  %s\n",
+            name, channels, samples / ref_time / 1000000.0,
+            one ? samples / one_time / 1000000.0 : 0.0,
+            many ? samples / many_time / 1000000.0 : 0.0,
+            one ? ref_time / one_time : 0.0, many ? ref_time / many_time : 0.0,
+            match ? "(output matches)" : "(OUTPUT DIFFERS!)");
+
+    SDL_FreeWAV(one);
+    SDL_FreeWAV(many);
+    SDL_free(wav);
+    SDL_free(ref);
+    return match ? 0 : -1;
+}
+
+int
+main(int argc, char **argv)
+{
+    static const int channels[] = { 1, 2, 6 };
+    int seconds = 120;
+    int retval = 0;
+    int i;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 1) {
+        seconds = SDL_atoi(argv[1]);
+    }
+    if ((argc > 2) || (seconds <= 0)) {
+        SDL_Log("USAGE: %s [seconds]\n", argv[0]);
+        return 1;
+    }
+
+    if (SDL_Init(0) == -1) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_Init() failed: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    SDL_Log("Decoding %d seconds of 44.1kHz ADPCM, %d CPUs\n", seconds, SDL_GetCPUCount());
+    srand(0);
+    for (i = 0; i < SDL_arraysize(channels); i++) {
+        /* the block sizes common encoders use: 256 bytes per channel for
+           MS ADPCM, 512 bytes per channel for IMA ADPCM (capped at 2048). */
+        const int c = channels[i];
+        const int ms_align = 256 * c;
+        const int ima_align = SDL_min(512 * c, 2048 - ((2048 - (4 * c)) % (4 * c)));
+        if (bench("MS", MS_ADPCM_CODE, c, ms_align, 2 + (((ms_align - (7 * c)) * 2) / c), seconds) < 0) {
+            retval = 1;
+        }
+        if (bench("IMA", IMA_ADPCM_CODE, c, ima_align, 1 + (((ima_align - (4 * c)) * 2) / c), seconds) < 0) {
+            retval = 1;
+        }
+    }
+
+    SDL_Quit();
+    return retval;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */